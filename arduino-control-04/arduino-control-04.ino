@@ -1,10 +1,18 @@
 #include <Servo.h>
 #include "Arduino.h"
 #include <avr/sleep.h>
+#include <RangeEstimator.h>
+#include "event_queue.h"
+#include "fast_io.h"
+#include "motor_pi.h"
+#include "ranging.h"
+#include "scheduler.h"
+#include "sweep.h"
+#include "telemetry.h"
 
 #define sleepPin A5  // When low, makes 328P go to sleep
 #define wakePin 2   // when low, makes 328P wake up, must be an interrupt pin (2 or 3 on ATMEGA328P)
-#define ledPin A4    // output pin for the LED (to show it is awake)
+#define ledPin A4    // output pin for the LED (to show it is awake), taken by an encoder with MOTOR_ENCODERS
 
 int distance = 20; // Khoảng cách phát hiện vật cản 12cm
 //Khai báo hàm
@@ -15,6 +23,21 @@ void object_follow();
 void sleep_mode_01();
 void sleepISR();
 void doBlink() ;
+void ranging_begin();
+void ranging_update();
+void motor_begin();
+void motor_task();
+void ir_begin();
+uint8_t ir_latch();
+void task_ir();
+void task_servo();
+void sched_report();
+void telem_pump();
+void telem_drain();
+void telem_text(uint8_t prio, const char *text);
+void telem_state();
+void telem_scan(const scan_t &s);
+void telem_sched(uint8_t task, const sched_task_t &t);
 
 //L298 kết nối arduino
 const int motorA1      = 3;  // kết nối chân IN1 với chân 3 arduino
@@ -39,19 +62,49 @@ int deg, dis;     //Biến lưu độ và khoảng cách (degree,distance)
 const int L_S = A0;  // cb dò line trái
 const int R_S = A1; // cb dò line phải
 const int ball_detect = A2; // cb dò line phải
+const uint32_t ir_pins = FastPins<L_S, R_S, ball_detect>::bits;   // cùng cổng C
+#define IR_CLEAR_US 20000UL   // vạch phải hết chừng này trước khi xe chạy lại sau khi ngắt dừng xe
+volatile uint8_t motor_hold;  // 1 khi ngắt cảm biến line đã cắt động cơ (sensor_IR.ino)
 
 int left_sensor_state; // biến lưu cảm biến hồng ngoại line trái
 int right_sensor_state; // biến lưu cảm biến hồng ngoại line phải
 int ball_detect_state;
+uint8_t drive_action = TELEM_STOP;  // hướng chạy hiện tại (telem_action_t)
 
-// Biến lưu thời gian và khoảng cách cho cảm biến siêu âm trên
-long up_duration; // biến lưu thời gian
+// Đo khoảng cách không chặn cho cả hai cảm biến siêu âm (ultrasonic_up.ino)
+Ranging ranging;
+Sweep sweep(90);  // servo bắt đầu ở 90 độ sau attach()
+
+// Hàng đợi telemetry nhị phân gửi qua Serial (telemetry.ino)
+TelemetryTx telem;
+
+// Khoảng cách đo được từ cảm biến siêu âm trên, đã lọc trung vị và Kalman
+// để một lần đo lỗi không làm xe quay đầu
+RangeEstimator up_range;
 int up_distance;  // biến khoảng cách
     
+// Bảng tác vụ, ưu tiên theo thứ tự (IR trước tiên). Không tác vụ nào được dùng delay()
+sched_task_t tasks[] = {
+  SCHED_TASK("ir",         task_ir,       1000UL,    0),  // 1 kHz, bám line và dừng khi có vật cản
+  SCHED_TASK("motor",      motor_task,    MOTOR_PERIOD_US, 0),  // 20 Hz, dốc tăng tốc và PI
+  SCHED_TASK("ultrasonic", ultrasonic_up, 1000UL,    0),  // 1 kHz, để xung trig phát ngay khi đến lượt
+  SCHED_TASK("servo",      task_servo,    2000UL,    0),  // 500 Hz, một bước máy trạng thái quét
+  SCHED_TASK("sleep",      sleep_mode_01, 100000UL,  0),  // 10 Hz
+  SCHED_TASK("led",        doBlink,       10000UL,   0),  // nhịp 1 Hz, bước 10 ms
+  SCHED_TASK("state",      telem_state,   50000UL,   0),  // 20 Hz, khung trạng thái
+  SCHED_TASK("telemetry",  telem_pump,    5000UL,    0),  // nạp bộ đệm truyền UART
+  SCHED_TASK("report",     sched_report,  5000000UL, 0),  // báo tác vụ trễ hạn
+};
+#define TASK_COUNT (sizeof(tasks) / sizeof(tasks[0]))
+
+Scheduler sched(tasks, TASK_COUNT, micros);
+
 // Hàm khởi tạo
 void setup() {
   pinMode(L_S,INPUT); // chân cảm biến khai báo là đầu vào
   pinMode(R_S,INPUT);
+  pinMode(ball_detect,INPUT);
+  ir_begin();      // sườn của cảm biến hồng ngoại báo qua ngắt
   pinMode(motorA1, OUTPUT); 
   pinMode(motorA2, OUTPUT);
   pinMode(motorB1, OUTPUT);
@@ -62,8 +115,7 @@ void setup() {
   pinMode(echo_up, INPUT); 
     
   Serial.begin(9600); 
-  analogWrite(motorAspeed, 120); // tốc độ động cơ a ban đầu 120 ( 0 - 255)
-  analogWrite(motorBspeed, 120);// tốc độ động cơ b ban đầu 120 ( 0 - 255)
+  motor_begin();   // tốc độ do motor_task() điều khiển, không còn đặt cố định 120
   delay(3000);                               
 
   // servo và cảm biến siêu âm dưới
@@ -71,6 +123,8 @@ void setup() {
   
   pinMode(trig_down,OUTPUT);   //Chân trig sẽ phát tín hiệu
   pinMode(echo_down,INPUT);    //Chân echo sẽ nhận tín hiệu
+  ranging_begin();             //Đo khoảng cách bằng ngắt, không dùng pulseIn
+  ranging.automatic(RANGING_DOWN, false);   //Cảm biến dưới chỉ đo khi servo đã ổn định
   //  Serial.begin(9600);     //Set Baudrate
  
   // Keep pins high until we ground them
@@ -78,25 +132,51 @@ void setup() {
   pinMode(wakePin, INPUT);
 
   // Flashing LED just to show the Micro Controller is running
+#if !MOTOR_ENCODERS
   digitalWrite(ledPin, LOW);
   pinMode(ledPin, OUTPUT);
+#endif
 
-  Serial.println("Setup completed.");
+  telem_text(TELEM_LOW, "Setup completed.");
+  sched.begin();
   }
 
 //Hàm lặp
 void loop() {
-  ultrasonic_up();
-  sensor_ir();
-  sleep_mode_01();
-  
-  // nếu khoảng cách nhỏ hơn giới hạn 
-  if(up_distance > distance){
-    
+  sched.run();
+}
+
+// Bám line, nhưng dừng xe nếu khoảng cách nhỏ hơn giới hạn
+void task_ir() {
+  if (up_distance > distance) {
+    sensor_ir();
+  } else {
+    ir_latch();    // vẫn lấy hết sườn trong hàng đợi
+    turn_180();
+    drive_action = TELEM_STOP;
+  }
+}
+
+// Chỉ quét servo khi phía trước không có vật cản
+void task_servo() {
+  if (up_distance > distance) {
     servo_control();
-    } 
-   else {turn_180();Serial.println("turn_180");}
-     }
+  }
+}
+
+// Gửi thống kê các tác vụ có thêm lần trễ hạn kể từ lần báo trước
+void sched_report() {
+  static uint16_t reported[TASK_COUNT];
+
+  for (uint8_t i = 0; i < sched.count(); i++) {
+    const sched_task_t &t = sched.task(i);
+    if (t.overruns == reported[i]) {
+      continue;
+    }
+    reported[i] = t.overruns;
+    telem_sched(i, t);
+  }
+}
 
 
 
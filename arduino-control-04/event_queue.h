@@ -0,0 +1,61 @@
+// Queue of events from an interrupt handler to the main loop.
+//
+// One producer (the interrupt, push()) and one consumer (the loop, pop()),
+// each owning one single byte index, so neither side has to turn
+// interrupts off. When the queue is full the new event is dropped and
+// counted; the producer never waits. N is a power of two up to 128.
+//
+// Plain C++, the compiler barriers only keep the element write ahead of
+// the index that publishes it.
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <stdint.h>
+
+template <typename T, uint8_t N>
+class EventQueue {
+    static_assert(N && N <= 128 && !(N & (N - 1)), "N must be a power of two up to 128");
+
+  public:
+    EventQueue() : head_(0), tail_(0), dropped_(0) {}
+
+    // Producer side
+    bool push(const T &event) {
+      uint8_t head = head_;
+      if ((uint8_t)(head - tail_) == N) {
+        dropped_++;
+        return false;
+      }
+      buf_[head & (N - 1)] = event;
+      __asm__ __volatile__("" ::: "memory");
+      head_ = head + 1;
+      return true;
+    }
+
+    // Consumer side
+    bool pop(T &event) {
+      uint8_t tail = tail_;
+      if (tail == head_) {
+        return false;
+      }
+      __asm__ __volatile__("" ::: "memory");
+      event = buf_[tail & (N - 1)];
+      __asm__ __volatile__("" ::: "memory");
+      tail_ = tail + 1;
+      return true;
+    }
+
+    // Events lost to a full queue, wraps
+    uint8_t dropped() const {
+      return dropped_;
+    }
+
+  private:
+    T buf_[N];
+    volatile uint8_t head_;     // written by the producer only
+    volatile uint8_t tail_;     // written by the consumer only
+    volatile uint8_t dropped_;
+};
+
+#endif
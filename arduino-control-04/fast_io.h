@@ -0,0 +1,91 @@
+// Direct port I/O for the ATmega328P (Uno, Nano) pin numbering.
+//
+// A pin resolves at compile time to its port and bit, and a set of pins to
+// one 24 bit value with a byte per port (B, C, D). fast_write() then changes
+// any set of output pins with a single masked write per port involved, and
+// fast_read() samples a set of inputs with a single read per port, instead
+// of a digitalWrite()/digitalRead() per pin with its table lookups. With
+// constant arguments each port access compiles to one in/out instruction.
+//
+// Only the register access needs the AVR; the pin arithmetic is constexpr
+// and builds on a PC, so it can be checked against the core's pin tables.
+
+#ifndef FAST_IO_H
+#define FAST_IO_H
+
+#include <stdint.h>
+
+enum fast_port_t {
+  FAST_PORT_B,
+  FAST_PORT_C,
+  FAST_PORT_D
+};
+
+// Digital 0-7 are PD0-7, 8-13 are PB0-5, A0-A5 (14-19) are PC0-5
+constexpr uint8_t fast_port(uint8_t pin) {
+  return pin < 8 ? FAST_PORT_D : pin < 14 ? FAST_PORT_B : FAST_PORT_C;
+}
+
+constexpr uint8_t fast_bit(uint8_t pin) {
+  return pin < 8 ? pin : pin < 14 ? pin - 8 : pin - 14;
+}
+
+// The pin's bit within the byte of its port
+constexpr uint32_t fast_bits(uint8_t pin) {
+  return (uint32_t)(1 << fast_bit(pin)) << (8 * fast_port(pin));
+}
+
+constexpr uint8_t fast_port_bits(uint32_t bits, uint8_t port) {
+  return bits >> (8 * port);
+}
+
+// Bits of a set of pins: FastPins<3, 4, 7, 8>::bits
+template <uint8_t... Pins> struct FastPins;
+
+template <> struct FastPins<> {
+  static constexpr uint32_t bits = 0;
+};
+
+template <uint8_t Pin, uint8_t... Rest> struct FastPins<Pin, Rest...> {
+  static constexpr uint32_t bits = fast_bits(Pin) | FastPins<Rest...>::bits;
+};
+
+#ifdef __AVR__
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+// Sets the pins in mask to the matching bits of value. Interrupts are held
+// off across the read-modify-write, since interrupt handlers (Servo) write
+// the same ports.
+static inline __attribute__((always_inline)) void fast_write(uint32_t mask, uint32_t value) {
+  uint8_t sreg = SREG;
+  cli();
+  if (fast_port_bits(mask, FAST_PORT_B)) {
+    PORTB = (PORTB & ~fast_port_bits(mask, FAST_PORT_B)) | (fast_port_bits(value, FAST_PORT_B) & fast_port_bits(mask, FAST_PORT_B));
+  }
+  if (fast_port_bits(mask, FAST_PORT_C)) {
+    PORTC = (PORTC & ~fast_port_bits(mask, FAST_PORT_C)) | (fast_port_bits(value, FAST_PORT_C) & fast_port_bits(mask, FAST_PORT_C));
+  }
+  if (fast_port_bits(mask, FAST_PORT_D)) {
+    PORTD = (PORTD & ~fast_port_bits(mask, FAST_PORT_D)) | (fast_port_bits(value, FAST_PORT_D) & fast_port_bits(mask, FAST_PORT_D));
+  }
+  SREG = sreg;
+}
+
+// Levels of the pins in mask, as fast_bits()
+static inline __attribute__((always_inline)) uint32_t fast_read(uint32_t mask) {
+  uint32_t value = 0;
+  if (fast_port_bits(mask, FAST_PORT_B)) {
+    value |= (uint32_t)(PINB & fast_port_bits(mask, FAST_PORT_B)) << (8 * FAST_PORT_B);
+  }
+  if (fast_port_bits(mask, FAST_PORT_C)) {
+    value |= (uint32_t)(PINC & fast_port_bits(mask, FAST_PORT_C)) << (8 * FAST_PORT_C);
+  }
+  if (fast_port_bits(mask, FAST_PORT_D)) {
+    value |= (uint32_t)(PIND & fast_port_bits(mask, FAST_PORT_D)) << (8 * FAST_PORT_D);
+  }
+  return value;
+}
+#endif
+
+#endif
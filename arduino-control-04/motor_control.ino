@@ -1,42 +1,112 @@
 // Chương trình con
+// Các hàm chạy chỉ đặt tốc độ đích cho hai bánh (tick encoder/giây, âm là
+// lùi); tác vụ motor_task() tăng tốc dần theo dốc và điều khiển PI (motor_pi.h)
+MotorPI motorA, motorB;
+
+// Bốn chân hướng của L298 (cổng D: 3, 4, 7; cổng B: 8), ghi cùng lúc (fast_io.h)
+const uint32_t motor_pins = FastPins<motorA1, motorA2, motorB1, motorB2>::bits;
+
+#if MOTOR_ENCODERS
+const int encoderA = A3;  // encoder bánh trái
+const int encoderB = A4;  // encoder bánh phải (dùng chân của LED)
+volatile uint16_t encoder_ticks[2];   // đếm cả hai sườn, trong ngắt PCINT1 (sensor_IR.ino)
+#endif
+
+void motor_begin() {
+#if MOTOR_ENCODERS
+  pinMode(encoderA, INPUT_PULLUP);
+  pinMode(encoderB, INPUT_PULLUP);
+  *digitalPinToPCMSK(encoderA) |= bit(digitalPinToPCMSKbit(encoderA));
+  *digitalPinToPCMSK(encoderB) |= bit(digitalPinToPCMSKbit(encoderB));
+  PCIFR = bit(digitalPinToPCICRbit(encoderA));
+  *digitalPinToPCICR(encoderA) |= bit(digitalPinToPCICRbit(encoderA));
+#endif
+}
+
+// Chiều quay và tốc độ của cả hai động cơ, pwm âm là lùi, 0 là thả trôi.
+// Các chân hướng được đổi bằng một lần ghi cho mỗi cổng. motor_hold được
+// xem lại khi đã tắt ngắt: nếu ngắt cảm biến line vừa cắt động cơ sau lúc
+// motor_task() kiểm tra, lần ghi này không được bật lại chân hướng
+void motor_apply(int16_t pwmA, int16_t pwmB) {
+  uint32_t dir = (pwmA < 0 ? fast_bits(motorA1) : 0) | (pwmA > 0 ? fast_bits(motorA2) : 0) |
+                 (pwmB < 0 ? fast_bits(motorB1) : 0) | (pwmB > 0 ? fast_bits(motorB2) : 0);
+  uint8_t sreg = SREG;
+  cli();
+  if (motor_hold) {
+    dir = 0;
+    pwmA = 0;
+    pwmB = 0;
+  }
+  fast_write(motor_pins, dir);
+  SREG = sreg;
+  analogWrite(motorAspeed, pwmA < 0 ? -pwmA : pwmA);
+  analogWrite(motorBspeed, pwmB < 0 ? -pwmB : pwmB);
+}
+
+// Gọi định kỳ MOTOR_PERIOD_US từ bộ lập lịch
+void motor_task() {
+  static uint32_t last;
+  uint32_t now = micros();
+  uint32_t dt = now - last;
+  last = now;
+
+  uint16_t ticks[2] = {0, 0};
+#if MOTOR_ENCODERS
+  noInterrupts();
+  ticks[0] = encoder_ticks[0];
+  ticks[1] = encoder_ticks[1];
+  encoder_ticks[0] = 0;
+  encoder_ticks[1] = 0;
+  interrupts();
+#endif
+  if (motor_hold) {   // ngắt cảm biến line đã dừng xe, giữ dừng đến khi hết vạch
+    Stop();
+    return;
+  }
+  int16_t pwmA = motorA.step(ticks[0], dt);
+  int16_t pwmB = motorB.step(ticks[1], dt);
+  motor_apply(pwmA, pwmB);
+}
+
+// Đặt tốc độ đích cho một bánh. sensor_ir() gửi lại cùng lệnh mỗi 1 ms, nên
+// đích không đổi thì giữ nguyên dốc đang dùng (xe vừa xuất phát vẫn tăng tốc
+// dần). Đích đổi khi xe đang chạy là lệnh bẻ lái, dùng dốc MOTOR_STEER_TPS2
+// để bánh đổi chiều trong một, hai chu kỳ thay vì nửa giây
+void drive_wheel(MotorPI &m, int16_t tps, bool moving) {
+  if (tps != m.target()) {
+    m.target(tps, moving ? MOTOR_STEER_TPS2 : MOTOR_ACCEL_TPS2);
+  }
+}
+
+void drive(int16_t tpsA, int16_t tpsB) {
+  bool moving = motorA.setpoint() || motorB.setpoint();
+  drive_wheel(motorA, tpsA, moving);
+  drive_wheel(motorB, tpsB, moving);
+}
+
 void forward(){ // chương trình con xe robot đi tiến
-  digitalWrite(motorA1,LOW);
-  digitalWrite(motorA2,HIGH);                       
-  digitalWrite(motorB2,HIGH);
-  digitalWrite(motorB1,LOW);
+  drive(MOTOR_CRUISE_TPS, MOTOR_CRUISE_TPS);
 }
 
-void back(){ // chương trình con xe robot đi tiến
-  digitalWrite(motorA2,LOW);
-  digitalWrite(motorA1,HIGH);                       
-  digitalWrite(motorB1,HIGH);
-  digitalWrite(motorB2,LOW);
+void back(){ // chương trình con xe robot đi lùi
+  drive(-MOTOR_CRUISE_TPS, -MOTOR_CRUISE_TPS);
 }
 
 void turnRight(){
-  digitalWrite(motorA1,HIGH);
-  digitalWrite(motorA2,LOW);                       
-  digitalWrite(motorB2,HIGH);
-  digitalWrite(motorB1,LOW);
+  drive(-MOTOR_CRUISE_TPS, MOTOR_CRUISE_TPS);
 }
 
 void turnLeft(){
-  digitalWrite(motorA1,LOW);
-  digitalWrite(motorA2,HIGH);                       
-  digitalWrite(motorB1,HIGH);
-  digitalWrite(motorB2,LOW);
+  drive(MOTOR_CRUISE_TPS, -MOTOR_CRUISE_TPS);
 }
 
+// Dừng ngay, không giảm tốc dần
 void Stop(){
-  digitalWrite(motorA1,LOW);
-  digitalWrite(motorA2,LOW);                       
-  digitalWrite(motorB1,LOW);
-  digitalWrite(motorB2,LOW);
+  motorA.stop();
+  motorB.stop();
+  motor_apply(0, 0);
 }
 
 void turn_180(){
-  digitalWrite(motorA1,LOW);
-  digitalWrite(motorA2,LOW);                       
-  digitalWrite(motorB1,LOW);
-  digitalWrite(motorB2,LOW);
+  Stop();
 }
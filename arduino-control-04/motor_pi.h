@@ -0,0 +1,125 @@
+// Speed control for one wheel: acceleration ramp, feed-forward and PI.
+//
+// The caller sets a signed target in encoder ticks per second. The setpoint
+// follows it no faster than the acceleration given with it: MOTOR_ACCEL_TPS2
+// by default, so the wheels do not slip when setting off, or the steeper
+// MOTOR_STEER_TPS2 for steering corrections while already moving, which
+// have to take effect within a step. stop() drops everything at once.
+// step() runs at a fixed rate with the ticks counted since the last call
+// and returns the signed PWM to apply. With MOTOR_ENCODERS 0 there is no
+// measurement and the feed-forward term alone drives the motor, ramped.
+//
+// Single channel encoders only give the speed, so its sign is taken from
+// the PWM being applied. Integer arithmetic, gains in Q8. Plain C++, so the
+// loop can be run on a PC against a model of the motor.
+
+#ifndef MOTOR_PI_H
+#define MOTOR_PI_H
+
+#include <stdint.h>
+
+#ifndef MOTOR_ENCODERS
+#define MOTOR_ENCODERS      0       // 1 with slotted wheel encoders on A3 and A4
+#endif
+
+#define MOTOR_PERIOD_US     50000UL // 20 Hz, a few ticks per period at cruise
+#define MOTOR_PWM_MAX       255
+#define MOTOR_TPS_MAX       200     // ticks per second at full PWM, both edges of 20 slots
+#define MOTOR_CRUISE_TPS    75      // about the old fixed PWM of 120
+#define MOTOR_ACCEL_TPS2    300     // setpoint ramp, setting off
+#define MOTOR_STEER_TPS2    3000    // setpoint ramp, steering while moving
+#define MOTOR_FF_START      40      // PWM at which the wheel starts to turn
+#define MOTOR_FF_Q8         275     // PWM per tick/s above that, Q8
+#define MOTOR_KP_Q8         205     // PWM per tick/s of error, Q8
+#define MOTOR_KI_Q8         512     // PWM per tick/s of error per second, Q8
+
+class MotorPI {
+  public:
+    MotorPI() : target_(0), accel_(MOTOR_ACCEL_TPS2), setpoint_(0), speed_(0), integral_(0), pwm_(0) {}
+
+    void target(int16_t tps, uint16_t accel_tps2 = MOTOR_ACCEL_TPS2) {
+      target_ = tps;
+      accel_ = accel_tps2;
+    }
+
+    // Stops at once, no ramp
+    void stop() {
+      target_ = 0;
+      setpoint_ = 0;
+      integral_ = 0;
+      pwm_ = 0;
+    }
+
+    // Fixed rate step, ticks seen over the last dt_us. Returns PWM,
+    // -MOTOR_PWM_MAX to MOTOR_PWM_MAX, negative for reverse.
+    int16_t step(uint16_t ticks, uint32_t dt_us) {
+      uint32_t dt_ms = dt_us > 2 * MOTOR_PERIOD_US ? MOTOR_PERIOD_US / 1000 : dt_us / 1000;   // first call
+      int32_t ramp = (int32_t)accel_ * (int32_t)dt_ms / 1000;
+      if (ramp < 1) {
+        ramp = 1;
+      }
+      int32_t diff = (int32_t)target_ - setpoint_;
+      setpoint_ += diff > ramp ? ramp : diff < -ramp ? -ramp : diff;
+
+      if (!setpoint_) {
+        integral_ = 0;
+        speed_ = 0;
+        pwm_ = 0;
+        return 0;
+      }
+      int8_t sign = setpoint_ < 0 ? -1 : 1;
+      int32_t sp = setpoint_ * sign;                  // magnitude from here on
+      int32_t u = MOTOR_FF_START + ((sp * MOTOR_FF_Q8) >> 8);
+
+#if MOTOR_ENCODERS
+      // Speed in ticks/s, halfway filtered against the quantisation
+      int32_t measured = dt_us ? (int32_t)((uint32_t)ticks * 1000000UL / dt_us) : 0;
+      if (pwm_ * sign < 0) {
+        measured = -measured;                       // still turning the old way
+      }
+      speed_ = (speed_ + measured) / 2;
+      int32_t e = sp - speed_;
+      u += (e * MOTOR_KP_Q8 + integral_) >> 8;
+
+      // Integrate only while it can still help (anti-windup)
+      if (!((u >= MOTOR_PWM_MAX && e > 0) || (u <= 0 && e < 0))) {
+        integral_ += e * MOTOR_KI_Q8 * (int32_t)dt_ms / 1000;
+      }
+#else
+      (void)ticks;
+      speed_ = sp;
+#endif
+      u = u > MOTOR_PWM_MAX ? MOTOR_PWM_MAX : u < 0 ? 0 : u;
+      pwm_ = u * sign;
+      return pwm_;
+    }
+
+    // Target as last set, ticks/s
+    int16_t target() const {
+      return target_;
+    }
+
+    // Ramped setpoint and measured speed, ticks/s (speed is the setpoint
+    // without encoders)
+    int16_t setpoint() const {
+      return setpoint_;
+    }
+
+    int16_t speed() const {
+      return speed_ * (setpoint_ < 0 ? -1 : 1);
+    }
+
+    int16_t pwm() const {
+      return pwm_;
+    }
+
+  private:
+    int16_t target_;
+    uint16_t accel_;      // ticks/s per second
+    int16_t setpoint_;
+    int32_t speed_;       // magnitude
+    int32_t integral_;    // Q8 PWM
+    int16_t pwm_;
+};
+
+#endif
@@ -0,0 +1,160 @@
+// Non-blocking ranging for the two HC-SR04 sensors (up and down).
+//
+// The main loop calls poll() as often as it likes; poll() says when to fire
+// a trigger pulse and which sensor, and publishes the distance once the echo
+// has been timed. The echo edges come in through edge(), called from the
+// pin change interrupt with a micros() timestamp. Only one sensor is in
+// flight at a time and there is a quiet gap after each one, so a ping from
+// one sensor is never heard by the other. Sensors take turns unless one is
+// asked for with request(); a sensor taken out of turn with automatic() is
+// only pinged on request.
+//
+// Echo times are turned into distances with the shared RangeEstimator
+// conversion; filtering is left to the caller, which knows whether
+// consecutive readings are of the same thing.
+//
+// Plain C++ with time passed in, so the timing can be run on a PC against a
+// simulated pin and clock.
+
+#ifndef RANGING_H
+#define RANGING_H
+
+#include <stdint.h>
+#include <RangeEstimator.h>
+
+#define RANGING_UP          0
+#define RANGING_DOWN        1
+#define RANGING_SENSORS     2
+
+#define RANGING_TIMEOUT_US  40000UL   // trigger to falling edge; no echo is a 38 ms pulse
+#define RANGING_GAP_US      10000UL   // quiet time before the next ping
+#define RANGING_NO_ECHO     0         // distance published when the echo never ended
+
+class Ranging {
+  public:
+    Ranging() : state_(IDLE), active_(RANGING_DOWN), requested_(-1), auto_(0xff), since_(0),
+      mm_per_us_(range_speed(RANGE_TEMP_C)), armed_(0), high_(0), done_(0), start_(0), width_(0) {
+      for (uint8_t i = 0; i < RANGING_SENSORS; i++) {
+        cm_[i] = RANGING_NO_ECHO;
+        width_us_[i] = 0;
+        count_[i] = 0;
+      }
+    }
+
+    // Main loop. Returns the sensor to trigger now, or -1.
+    int8_t poll(uint32_t now) {
+      if (state_ == WAIT) {
+        if (done_) {
+          publish(width_, now);
+        } else if (now - since_ >= RANGING_TIMEOUT_US) {
+          armed_ = 0;
+          publish(0, now);
+        }
+        return -1;
+      }
+
+      if (now - since_ < RANGING_GAP_US) {
+        return -1;
+      }
+      int8_t next = requested_;
+      if (next < 0) {
+        next = active_ ^ 1;
+        if (!(auto_ & (1 << next))) {
+          next = active_;
+        }
+        if (!(auto_ & (1 << next))) {
+          return -1;
+        }
+      }
+      active_ = next;
+      requested_ = -1;
+      done_ = 0;
+      high_ = 0;
+      armed_ = active_ + 1;
+      state_ = WAIT;
+      since_ = now;
+      return active_;
+    }
+
+    // Pin change interrupt, level is the echo pin after the change
+    void edge(uint8_t sensor, bool level, uint32_t now) {
+      if (armed_ != sensor + 1) {
+        return;
+      }
+      if (level) {
+        start_ = now;
+        high_ = 1;
+      } else if (high_) {
+        width_ = now - start_;
+        armed_ = 0;
+        done_ = 1;
+      }
+    }
+
+    // Ping this sensor next instead of taking turns
+    void request(uint8_t sensor) {
+      requested_ = sensor;
+    }
+
+    // Whether the sensor takes turns on its own (the default) or waits for
+    // request()
+    void automatic(uint8_t sensor, bool on) {
+      if (on) {
+        auto_ |= 1 << sensor;
+      } else {
+        auto_ &= ~(1 << sensor);
+      }
+    }
+
+    // Air temperature for the conversion
+    void temperature(int8_t celsius) {
+      mm_per_us_ = range_speed(celsius);
+    }
+
+    // Latest distance in cm, unfiltered; RANGING_NO_ECHO if the echo never ended
+    uint16_t cm(uint8_t sensor) const {
+      return cm_[sensor];
+    }
+
+    uint32_t echo_us(uint8_t sensor) const {
+      return width_us_[sensor];
+    }
+
+    // Goes up by one with every published distance, to spot fresh readings
+    uint8_t count(uint8_t sensor) const {
+      return count_[sensor];
+    }
+
+  private:
+    enum { IDLE, WAIT };
+
+    void publish(uint32_t width, uint32_t now) {
+      width_us_[active_] = width;
+      cm_[active_] = width ? (range_echo_mm(width, mm_per_us_) + 5) / 10 : RANGING_NO_ECHO;
+      count_[active_]++;
+      state_ = IDLE;
+      since_ = now;
+    }
+
+    uint8_t  state_;
+    uint8_t  active_;
+    int8_t   requested_;
+    uint8_t  auto_;         // bit per sensor that takes turns
+    uint32_t since_;        // trigger time while waiting, else end of the last ping
+    uint16_t mm_per_us_;    // range_speed()
+
+    // Shared with the interrupt. The loop reads width_ only once done_ is
+    // set, and the interrupt ignores edges once armed_ is 0, so single byte
+    // flags are all the locking needed.
+    volatile uint8_t  armed_;   // sensor + 1 whose edges are wanted, 0 for none
+    volatile uint8_t  high_;
+    volatile uint8_t  done_;
+    volatile uint32_t start_;
+    volatile uint32_t width_;
+
+    uint16_t cm_[RANGING_SENSORS];
+    uint32_t width_us_[RANGING_SENSORS];
+    uint8_t  count_[RANGING_SENSORS];
+};
+
+#endif
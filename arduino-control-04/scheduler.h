@@ -0,0 +1,102 @@
+// Fixed-rate cooperative scheduler for the main loop.
+//
+// Each task has a period and a deadline counted from its release time.
+// loop() calls run(), which runs every task that is due, once, in table
+// order, so the first entry is the most urgent. Tasks must return quickly
+// (no delay()); one that finishes past its deadline counts an overrun, and
+// releases missed altogether are dropped and counted rather than run back to
+// back. Releases stay on the period grid, so a late run does not shift the
+// next one.
+//
+// Plain C++ with the clock passed in: micros() on the robot, a virtual
+// clock on a PC.
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+typedef void (*sched_fn_t)();
+typedef uint32_t (*sched_clock_t)();
+
+typedef struct {
+  const char *name;
+  sched_fn_t  fn;
+  uint32_t    period_us;
+  uint32_t    deadline_us;  // 0 for the period
+
+  // Kept by the scheduler
+  uint32_t    release;      // next release time
+  uint32_t    max_us;       // longest run so far
+  uint16_t    overruns;     // runs that finished past their deadline
+  uint16_t    skipped;      // releases dropped because the task ran late
+} sched_task_t;
+
+#define SCHED_TASK(name, fn, period_us, deadline_us)  {name, fn, period_us, deadline_us, 0, 0, 0, 0}
+
+class Scheduler {
+  public:
+    Scheduler(sched_task_t *tasks, uint8_t count, sched_clock_t clock)
+      : tasks_(tasks), count_(count), clock_(clock) {}
+
+    // Releases every task now and clears the statistics
+    void begin() {
+      uint32_t now = clock_();
+      for (uint8_t i = 0; i < count_; i++) {
+        sched_task_t &t = tasks_[i];
+        t.release = now;
+        t.max_us = 0;
+        t.overruns = 0;
+        t.skipped = 0;
+      }
+    }
+
+    // Runs the tasks that are due, returns how many ran
+    uint8_t run() {
+      uint8_t ran = 0;
+      for (uint8_t i = 0; i < count_; i++) {
+        sched_task_t &t = tasks_[i];
+        uint32_t start = clock_();
+        if ((int32_t)(start - t.release) < 0) {
+          continue;
+        }
+
+        t.fn();
+        ran++;
+
+        uint32_t end = clock_();
+        uint32_t deadline = t.deadline_us ? t.deadline_us : t.period_us;
+        if (end - start > t.max_us) {
+          t.max_us = end - start;
+        }
+        if (end - t.release > deadline) {
+          t.overruns++;
+        }
+
+        // Next release on the grid, dropping any that have already gone by
+        uint32_t late = end - t.release;
+        if (late >= t.period_us) {
+          uint32_t missed = late / t.period_us;
+          t.release += missed * t.period_us;
+          t.skipped += missed;
+        }
+        t.release += t.period_us;
+      }
+      return ran;
+    }
+
+    uint8_t count() const {
+      return count_;
+    }
+
+    const sched_task_t &task(uint8_t i) const {
+      return tasks_[i];
+    }
+
+  private:
+    sched_task_t *tasks_;
+    uint8_t count_;
+    sched_clock_t clock_;
+};
+
+#endif
@@ -1,10 +1,90 @@
+// Ba cảm biến A0-A2 báo qua ngắt đổi mức PCINT1 (cổng C, chung với encoder).
+// Mỗi sườn được lưu cùng thời điểm vào hàng đợi ir_events, nên một vạch
+// trắng chạy qua giữa hai lần gọi sensor_ir() vẫn được thấy. Khi cả hai
+// cảm biến line cùng thấy vạch, ngắt cắt động cơ ngay, không chờ vòng lặp.
+typedef struct {
+  uint8_t  pins;    // mức của A0-A2 sau sườn (bit của cổng C)
+  uint32_t us;      // micros() lúc có sườn
+} ir_event_t;
+
+EventQueue<ir_event_t, 8> ir_events;
+
+const uint8_t ir_port_bits = fast_port_bits(ir_pins, FAST_PORT_C);
+const uint8_t ir_left_bit = fast_port_bits(fast_bits(L_S), FAST_PORT_C);
+const uint8_t ir_right_bit = fast_port_bits(fast_bits(R_S), FAST_PORT_C);
+const uint8_t ir_ball_bit = fast_port_bits(fast_bits(ball_detect), FAST_PORT_C);
+const uint8_t ir_line_bits = ir_left_bit | ir_right_bit;
+
+ISR(PCINT1_vect) {
+  static uint8_t last;
+  uint8_t pins = PINC;
+  uint8_t changed = pins ^ last;
+  last = pins;
+
+  if (changed & ir_port_bits) {
+    if ((pins & ir_line_bits) == ir_line_bits) {
+      fast_write(motor_pins, 0);    // dừng ngay, như Stop()
+      motor_hold = 1;
+    }
+    ir_event_t event = {(uint8_t)(pins & ir_port_bits), micros()};
+    ir_events.push(event);
+  }
+#if MOTOR_ENCODERS
+  if (changed & digitalPinToBitMask(encoderA)) {
+    encoder_ticks[0]++;
+  }
+  if (changed & digitalPinToBitMask(encoderB)) {
+    encoder_ticks[1]++;
+  }
+#endif
+}
+
+// Bật ngắt đổi mức cho ba cảm biến hồng ngoại
+void ir_begin() {
+  PCMSK1 |= ir_port_bits;
+  PCIFR = bit(PCIF1);
+  PCICR |= bit(PCIE1);
+}
+
+// Mức hiện tại của các cảm biến, cộng thêm cảm biến nào đã lên 1 kể từ lần
+// gọi trước dù giờ đã về 0
+uint8_t ir_latch() {
+  static uint32_t clear_since;
+  uint8_t seen = 0;
+  ir_event_t event;
+
+  while (ir_events.pop(event)) {
+    seen |= event.pins;
+    if (event.pins & ir_line_bits) {
+      clear_since = 0;
+    } else if (!clear_since) {
+      clear_since = event.us | 1;
+    }
+  }
+  uint8_t pins = fast_port_bits(fast_read(ir_pins), FAST_PORT_C);
+  if (pins & ir_line_bits) {
+    clear_since = 0;
+  } else if (!clear_since) {
+    clear_since = micros() | 1;     // sườn xuống bị mất khi hàng đợi đầy
+  }
+
+  // Bỏ lệnh dừng của ngắt khi vạch đã hết đủ lâu
+  if (motor_hold && clear_since && micros() - clear_since >= IR_CLEAR_US) {
+    motor_hold = 0;
+  }
+  return seen | pins;
+}
+
+// Gọi 1 kHz từ bộ lập lịch, không dùng delay(). Hướng chạy được gửi trong
+// khung trạng thái (telem_state)
 void sensor_ir(){
-  left_sensor_state = digitalRead(L_S);
-  right_sensor_state = digitalRead(R_S);
-  ball_detect_state = digitalRead(ball_detect);
+  uint8_t pins = ir_latch();
+  left_sensor_state = (pins & ir_left_bit) != 0;
+  right_sensor_state = (pins & ir_right_bit) != 0;
+  ball_detect_state = (pins & ir_ball_bit) != 0;
   
-  if ((digitalRead(L_S) == 0)&&(digitalRead(R_S) == 0)){forward();delay(10);Serial.println("forward");}// đi tiến 
-  if ((digitalRead(L_S) == 1)&&(digitalRead(R_S) == 0)){turnLeft();delay(10);Serial.println("turnLeft");} // rẻ trái
-  if ((digitalRead(L_S) == 0)&&(digitalRead(R_S) == 1)){turnRight();delay(10);Serial.println("turnRight");} // rẻ phải
-  if ((digitalRead(L_S) == 1)&&(digitalRead(R_S) == 1)){turn_180();delay(10); Serial.println("turn_180");} // quay xe
+  if ((left_sensor_state == 0)&&(right_sensor_state == 0)){forward();drive_action = TELEM_FORWARD;}// đi tiến 
+  if ((left_sensor_state == 1)&&(right_sensor_state == 0)){turnLeft();drive_action = TELEM_LEFT;} // rẻ trái
+  if ((left_sensor_state == 0)&&(right_sensor_state == 1)){turnRight();drive_action = TELEM_RIGHT;} // rẻ phải
+  if ((left_sensor_state == 1)&&(right_sensor_state == 1)){turn_180();drive_action = TELEM_STOP;} // quay xe
 }
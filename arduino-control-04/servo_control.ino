@@ -3,58 +3,25 @@
 
 //Khai báo servo
   
+// Mỗi lần gọi chạy một bước của máy trạng thái quét (sweep.h): quay servo,
+// chờ ổn định, đo cảm biến dưới rồi ghi vào bảng quét. Mỗi lần quét xong,
+// cả bảng được gửi trong một khung telemetry.
 void servo_control() 
-
 {
- 
- //Quay từ 0 độ đến 180 độ
- for (deg=90;deg <= 120; deg++)
- {
-  myser.write(deg);         //Quay servo đến deg độ
-  dis= down_distance();           //dis gán = khoảng cách
-  Serial.print(deg);        //Xuất ra serial cho Processing đọc
-  Serial.print(",");
-  Serial.print(dis);
-  Serial.print(".");
-  Serial.println("");
-  delay(15);
- }
+  static uint16_t sent = 0xffff;  // seq của lần quét đã gửi
 
- //Quay từ 180 độ về 0 độ (tương tự ở trên)
-  for (deg = 120 ; deg >= 60; deg--)
- {
-  myser.write(deg);
-  dis = down_distance();
-  Serial.print(deg);
-  Serial.print(",");
-  Serial.print(dis);
-  Serial.print(".");
-  Serial.println("");
-  delay(15);
- }
- for (deg=60;deg <= 90; deg++)
- {
-  myser.write(deg);         //Quay servo đến deg độ
-  dis= down_distance();           //dis gán = khoảng cách
-  Serial.print(deg);        //Xuất ra serial cho Processing đọc
-  Serial.print(",");
-  Serial.print(dis);
-  Serial.print(".");
-  Serial.println("");
-  delay(15);
- }
-}
+  if (sweep.tick(micros(), ranging)) {
+    myser.write(sweep.angle());   //Quay servo đến góc mới
+  }
+  if (!sweep.point()) {
+    return;
+  }
+  deg = sweep.angle();
+  dis = sweep.distance();
 
-int down_distance()
-{
-    unsigned long down_duration; //Biến đo thời gian
-  
-    digitalWrite(trig_down, 0);   //Tắt chân trig
-    delayMicroseconds(2);   //Chờ 2ms
-    digitalWrite(trig_down, 1);   //Phát xung từ chân trig
-    delayMicroseconds(5);   //Xung có độ dài 5 microSeconds
-    digitalWrite(trig_down, 0);   //Tắt chân trig
-    
-    down_duration = pulseIn(echo_down,HIGH);  //Đo độ rộng xung HIGH ở chân echo. 
-    return int(down_duration/2/29.412);  //Tính khoảng cách đến vật. 
+  const scan_t &scan = sweep.latest();
+  if (scan.dir && scan.seq != sent) {
+    sent = scan.seq;
+    telem_scan(scan);
+  }
 }
@@ -1,12 +1,9 @@
 #include "Arduino.h"
 #include <avr/sleep.h>
 
-// The loop just blinks an LED when not in sleep mode
+// Checks the sleep pin, run by the scheduler (the LED has its own task)
 void sleep_mode_01(){
 
-  // Just blink LED twice to show we're running
-  doBlink();
-
   // Is the "go to sleep" pin now LOW?
   if (digitalRead(sleepPin) == HIGH) {
 
@@ -26,8 +23,8 @@ void sleep_mode_01(){
     attachInterrupt(digitalPinToInterrupt(wakePin), sleepISR, HIGH);
 
     // Send a message just to show we are about to sleep
-    Serial.println("Good night!");
-    Serial.flush();
+    telem_text(TELEM_HIGH, "Good night!");
+    telem_drain();
 
     // Allow interrupts now
     interrupts();
@@ -35,7 +32,7 @@ void sleep_mode_01(){
     // And enter sleep mode as set above
     sleep_cpu();
 
-    Serial.println("I'm awake!");
+    telem_text(TELEM_HIGH, "I'm awake!");
 
     // Re-enable ADC if it was previously running
     ADCSRA = prevADCSRA;
@@ -57,20 +54,17 @@ void sleepISR() {
 }
 
 
-// Double blink just to show we are running. Note that we do NOT
-// use the delay for final delay here, this is done by checking
-// millis instead (non-blocking)
+// Double blink once a second just to show we are running. The scheduler
+// calls this every 10 ms, so it only switches the LED and never waits:
+// on for one tick, off for 20, on for one, off for the rest of the second.
+// The LED pin is an encoder input when MOTOR_ENCODERS is set.
 void doBlink() {
-  static unsigned long lastMillis = 0;
-
-  if (millis() > lastMillis + 1000) {
-    digitalWrite(ledPin, HIGH);
-    delay(10);
-    digitalWrite(ledPin, LOW);
-    delay(200);
-    digitalWrite(ledPin, HIGH);
-    delay(10);
-    digitalWrite(ledPin, LOW);
-    lastMillis = millis();
+#if !MOTOR_ENCODERS
+  static uint8_t tick = 0;
+
+  digitalWrite(ledPin, (tick == 0 || tick == 21) ? HIGH : LOW);
+  if (++tick == 100) {
+    tick = 0;
   }
+#endif
 }
@@ -0,0 +1,148 @@
+// Servo sweep for the down ultrasonic sensor, one small step per tick.
+//
+// The servo is moved to the next angle, left to settle for a time that
+// grows with the size of the move, then the down sensor is pinged through
+// Ranging and the distance is stored in place in the scan being filled.
+// When the sweep reaches either end that scan is complete and becomes the
+// one latest() returns, so readers always see a whole sweep, never a half
+// written one. Sweeps run back and forth between SCAN_MIN_DEG and
+// SCAN_MAX_DEG.
+//
+// The down sensor should be taken out of turn (Ranging::automatic) so it is
+// only ever pinged once the servo has settled.
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdint.h>
+#include "ranging.h"
+
+#define SCAN_MIN_DEG          60
+#define SCAN_MAX_DEG          120
+#define SCAN_STEP_DEG         5
+#define SCAN_POINTS           ((SCAN_MAX_DEG - SCAN_MIN_DEG) / SCAN_STEP_DEG + 1)
+#define SCAN_SETTLE_US        5000UL    // after any move
+#define SCAN_SETTLE_US_PER_DEG 2000UL   // SG90 turns about 60 degrees in 0.1 s
+
+typedef struct {
+  uint16_t cm[SCAN_POINTS];   // index (angle - SCAN_MIN_DEG) / SCAN_STEP_DEG
+  int8_t   dir;               // 1 swept upwards, -1 downwards, 0 no scan yet
+  uint16_t seq;               // complete scans before this one
+} scan_t;
+
+class Sweep {
+  public:
+    // start_deg is where the servo is now; the first sweep starts from
+    // SCAN_MIN_DEG so that it is a whole one.
+    Sweep(uint8_t start_deg) : state_(MOVE), angle_(start_deg), dir_(0), filling_(0),
+      moved_(0), settle_(0), count_(0), cm_(RANGING_NO_ECHO), point_(false) {
+      for (uint8_t b = 0; b < 2; b++) {
+        for (uint8_t i = 0; i < SCAN_POINTS; i++) {
+          scans_[b].cm[i] = RANGING_NO_ECHO;
+        }
+        scans_[b].dir = 0;
+        scans_[b].seq = 0;
+      }
+    }
+
+    // One step of the state machine. Returns true when the servo has to be
+    // written with angle().
+    bool tick(uint32_t now, Ranging &ranging) {
+      point_ = false;
+
+      switch (state_) {
+        case MOVE: {
+          uint8_t from = angle_;
+          if (!dir_) {
+            angle_ = SCAN_MIN_DEG;    // first move, then upwards
+            dir_ = 1;
+          } else {
+            if (angle_ <= SCAN_MIN_DEG) {
+              dir_ = 1;
+            } else if (angle_ >= SCAN_MAX_DEG) {
+              dir_ = -1;
+            }
+            int next = angle_ + dir_ * SCAN_STEP_DEG;
+            angle_ = next < SCAN_MIN_DEG ? SCAN_MIN_DEG : next > SCAN_MAX_DEG ? SCAN_MAX_DEG : next;
+          }
+          moved_ = now;
+          settle_ = SCAN_SETTLE_US + SCAN_SETTLE_US_PER_DEG * (from > angle_ ? from - angle_ : angle_ - from);
+          state_ = SETTLE;
+          return true;
+        }
+
+        case SETTLE:
+          if (now - moved_ >= settle_) {
+            count_ = ranging.count(RANGING_DOWN);
+            ranging.request(RANGING_DOWN);
+            state_ = WAIT;
+          }
+          break;
+
+        case WAIT:
+          if (ranging.count(RANGING_DOWN) != count_) {
+            store(ranging.cm(RANGING_DOWN));
+            state_ = MOVE;
+          }
+          break;
+      }
+      return false;
+    }
+
+    uint8_t angle() const {
+      return angle_;
+    }
+
+    // True for the tick that stored a new point (angle(), distance())
+    bool point() const {
+      return point_;
+    }
+
+    uint16_t distance() const {
+      return cm_;
+    }
+
+    // Most recent complete scan; dir is 0 until the first sweep ends
+    const scan_t &latest() const {
+      return scans_[filling_ ^ 1];
+    }
+
+  private:
+    enum { MOVE, SETTLE, WAIT };
+
+    static uint8_t index(uint8_t angle) {
+      return (angle - SCAN_MIN_DEG) / SCAN_STEP_DEG;
+    }
+
+    void store(uint16_t cm) {
+      scan_t &s = scans_[filling_];
+      s.cm[index(angle_)] = cm;
+      cm_ = cm;
+      point_ = true;
+
+      bool end = dir_ > 0 ? angle_ >= SCAN_MAX_DEG : dir_ < 0 && angle_ <= SCAN_MIN_DEG;
+      if (!end) {
+        return;
+      }
+      // Sweep finished: publish it and start the next in the other buffer,
+      // which begins where this one ended
+      s.dir = dir_;
+      scan_t &next = scans_[filling_ ^ 1];
+      next.seq = s.seq + 1;
+      next.cm[index(angle_)] = cm;
+      filling_ ^= 1;
+    }
+
+    uint8_t  state_;
+    uint8_t  angle_;
+    int8_t   dir_;
+    uint8_t  filling_;    // scan being written, the other one is latest()
+    uint32_t moved_;
+    uint32_t settle_;
+    uint8_t  count_;      // Ranging::count() when the ping was asked for
+    uint16_t cm_;         // last point stored
+    bool     point_;
+    scan_t   scans_[2];
+};
+
+#endif
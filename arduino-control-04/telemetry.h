@@ -0,0 +1,281 @@
+// Binary telemetry over the 9600 baud serial link.
+//
+// Frame: sync 0xA5, priority << 6 | type, seq, len, payload[len], crc8 over
+// type..payload (polynomial 0x07). Each priority numbers its own frames,
+// dropped ones included, so a gap on the receiving side counts frames dropped
+// on the robot even though priorities overtake each other. Multi-byte fields
+// are little endian; distances are in TELEM_CM_UNIT steps, 0 for no echo.
+//
+// Payloads:
+//   TELEM_STATE  u16 ms, u8 up distance, u8 IR bits (0 left, 1 right,
+//                2 ball), u8 drive action (telem_action_t)
+//   TELEM_SCAN   u16 scan seq, i8 dir, u8 first deg, u8 step deg, u8 n,
+//                u8 distance[n]
+//   TELEM_SCHED  u8 task, u16 overruns, u16 skipped, u16 max us (saturated)
+//   TELEM_TEXT   characters, no terminator
+//
+// TelemetryTx queues frames in one ring per priority and hands out bytes
+// highest priority first, never splitting a frame. A frame that does not fit
+// in its ring is dropped, so under load the low priority traffic goes first.
+// Bytes handed to Serial are past reordering, so the sketch keeps at most
+// TELEM_BACKLOG of them there: enough to keep the UART busy between pumps
+// every 5 ms (4.8 bytes at 9600 baud), little enough that a sweep does not
+// wait behind a Serial buffer full of low priority text.
+// TelemetryRx is the matching incremental decoder. Both are plain C++ and
+// build on a PC as well as on the robot.
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define TELEM_SYNC          0xA5
+#define TELEM_MAX_PAYLOAD   32
+#define TELEM_OVERHEAD      5     // sync, type, seq, len, crc
+#define TELEM_RING_BYTES    48    // per priority
+#define TELEM_BACKLOG       8     // bytes left queued in Serial, see below
+#define TELEM_CM_UNIT       2
+#define TELEM_PRIO_SHIFT    6
+#define TELEM_TYPE_MASK     0x3f
+
+enum telem_type_t {
+  TELEM_STATE = 1,
+  TELEM_SCAN  = 2,
+  TELEM_SCHED = 3,
+  TELEM_TEXT  = 4
+};
+
+enum telem_prio_t {
+  TELEM_HIGH,
+  TELEM_MID,
+  TELEM_LOW,
+  TELEM_PRIOS
+};
+
+enum telem_action_t {
+  TELEM_FORWARD,
+  TELEM_LEFT,
+  TELEM_RIGHT,
+  TELEM_STOP
+};
+
+static inline uint8_t telem_crc8(uint8_t crc, uint8_t b) {
+  crc ^= b;
+  for (uint8_t i = 0; i < 8; i++) {
+    crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+  }
+  return crc;
+}
+
+// Distance in cm to one byte, saturating
+static inline uint8_t telem_cm(uint16_t cm) {
+  uint16_t u = (cm + TELEM_CM_UNIT / 2) / TELEM_CM_UNIT;
+  return u > 255 ? 255 : u;
+}
+
+class TelemetryTx {
+  public:
+    TelemetryTx() : sending_(-1), left_(0) {
+      for (uint8_t p = 0; p < TELEM_PRIOS; p++) {
+        head_[p] = 0;
+        used_[p] = 0;
+        dropped_[p] = 0;
+        seq_[p] = 0;
+      }
+    }
+
+    // Queues a frame, false (and counted) if its priority ring is full
+    bool send(uint8_t prio, uint8_t type, const uint8_t *payload, uint8_t len) {
+      uint8_t seq = seq_[prio]++;
+      if (len > TELEM_MAX_PAYLOAD || TELEM_RING_BYTES - used_[prio] < len + TELEM_OVERHEAD) {
+        dropped_[prio]++;
+        return false;
+      }
+      uint8_t crc = 0;
+      type |= prio << TELEM_PRIO_SHIFT;
+      put(prio, TELEM_SYNC);
+      put(prio, type);
+      crc = telem_crc8(crc, type);
+      put(prio, seq);
+      crc = telem_crc8(crc, seq);
+      put(prio, len);
+      crc = telem_crc8(crc, len);
+      for (uint8_t i = 0; i < len; i++) {
+        put(prio, payload[i]);
+        crc = telem_crc8(crc, payload[i]);
+      }
+      put(prio, crc);
+      return true;
+    }
+
+    // Next byte for the UART, -1 when there is nothing to send
+    int next() {
+      if (sending_ < 0) {
+        for (uint8_t p = 0; p < TELEM_PRIOS; p++) {
+          if (used_[p]) {
+            sending_ = p;
+            left_ = peek(p, 3) + TELEM_OVERHEAD;
+            break;
+          }
+        }
+        if (sending_ < 0) {
+          return -1;
+        }
+      }
+      uint8_t b = take(sending_);
+      if (!--left_) {
+        sending_ = -1;
+      }
+      return b;
+    }
+
+    bool idle() const {
+      return sending_ < 0 && !used_[TELEM_HIGH] && !used_[TELEM_MID] && !used_[TELEM_LOW];
+    }
+
+    uint16_t dropped(uint8_t prio) const {
+      return dropped_[prio];
+    }
+
+  private:
+    uint8_t tail(uint8_t p) const {
+      return (head_[p] + TELEM_RING_BYTES - used_[p]) % TELEM_RING_BYTES;
+    }
+
+    void put(uint8_t p, uint8_t b) {
+      ring_[p][head_[p]] = b;
+      head_[p] = (head_[p] + 1) % TELEM_RING_BYTES;
+      used_[p]++;
+    }
+
+    uint8_t peek(uint8_t p, uint8_t i) const {
+      return ring_[p][(tail(p) + i) % TELEM_RING_BYTES];
+    }
+
+    uint8_t take(uint8_t p) {
+      uint8_t b = ring_[p][tail(p)];
+      used_[p]--;
+      return b;
+    }
+
+    uint8_t  ring_[TELEM_PRIOS][TELEM_RING_BYTES];
+    uint8_t  head_[TELEM_PRIOS];
+    uint8_t  used_[TELEM_PRIOS];
+    uint16_t dropped_[TELEM_PRIOS];
+    uint8_t  seq_[TELEM_PRIOS];
+    int8_t   sending_;    // priority of the frame going out, -1 between frames
+    uint8_t  left_;       // its bytes still to go
+};
+
+class TelemetryRx {
+  public:
+    TelemetryRx() : state_(SYNC), pos_(0), crc_(0), synced_(0),
+      frames_(0), crc_errors_(0), lost_(0) {
+      memset(&frame_, 0, sizeof(frame_));
+      memset(expect_, 0, sizeof(expect_));
+    }
+
+    // Feeds one byte, true when it completed a good frame (see frame())
+    bool feed(uint8_t b) {
+      switch (state_) {
+        case SYNC:
+          if (b == TELEM_SYNC) {
+            state_ = TYPE;
+            crc_ = 0;
+          }
+          return false;
+        case TYPE:
+          if ((b >> TELEM_PRIO_SHIFT) >= TELEM_PRIOS) {
+            state_ = SYNC;
+            return false;
+          }
+          frame_.prio = b >> TELEM_PRIO_SHIFT;
+          frame_.type = b & TELEM_TYPE_MASK;
+          crc_ = telem_crc8(crc_, b);
+          state_ = SEQ;
+          return false;
+        case SEQ:
+          frame_.seq = b;
+          crc_ = telem_crc8(crc_, b);
+          state_ = LEN;
+          return false;
+        case LEN:
+          if (b > TELEM_MAX_PAYLOAD) {
+            state_ = SYNC;
+            return false;
+          }
+          frame_.len = b;
+          crc_ = telem_crc8(crc_, b);
+          pos_ = 0;
+          state_ = b ? DATA : CRC;
+          return false;
+        case DATA:
+          frame_.payload[pos_++] = b;
+          crc_ = telem_crc8(crc_, b);
+          if (pos_ == frame_.len) {
+            state_ = CRC;
+          }
+          return false;
+        case CRC:
+          state_ = SYNC;
+          if (b != crc_) {
+            crc_errors_++;
+            return false;
+          }
+          if (synced_ & (1 << frame_.prio)) {
+            lost_ += (uint8_t)(frame_.seq - expect_[frame_.prio]);
+          }
+          expect_[frame_.prio] = frame_.seq + 1;
+          synced_ |= 1 << frame_.prio;
+          frames_++;
+          return true;
+      }
+      return false;
+    }
+
+    struct Frame {
+      uint8_t prio;
+      uint8_t type;
+      uint8_t seq;
+      uint8_t len;
+      uint8_t payload[TELEM_MAX_PAYLOAD];
+    };
+
+    const Frame &frame() const {
+      return frame_;
+    }
+
+    // True between a sync byte and the end of its frame
+    bool in_frame() const {
+      return state_ != SYNC;
+    }
+
+    uint32_t frames() const {
+      return frames_;
+    }
+
+    uint32_t crc_errors() const {
+      return crc_errors_;
+    }
+
+    // Frames the sequence numbers say went missing
+    uint32_t lost() const {
+      return lost_;
+    }
+
+  private:
+    enum { SYNC, TYPE, SEQ, LEN, DATA, CRC };
+
+    uint8_t  state_;
+    uint8_t  pos_;
+    uint8_t  crc_;
+    uint8_t  expect_[TELEM_PRIOS];
+    uint8_t  synced_;     // bit per priority seen
+    Frame    frame_;
+    uint32_t frames_;
+    uint32_t crc_errors_;
+    uint32_t lost_;
+};
+
+#endif
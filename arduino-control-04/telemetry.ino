@@ -0,0 +1,69 @@
+// Telemetry nhị phân (telemetry.h). Chỉ ghi vào UART khi bộ đệm truyền của
+// Serial còn chỗ, nên không bao giờ phải chờ; phần còn lại được ngắt UART
+// gửi đi.
+
+// Đẩy các byte đang chờ vào bộ đệm truyền, gọi thường xuyên từ bộ lập lịch.
+// Chỉ để tối đa TELEM_BACKLOG byte nằm trong bộ đệm của Serial, phần còn lại
+// ở trong telem để khung ưu tiên cao vẫn chen lên trước được.
+void telem_pump() {
+  while (SERIAL_TX_BUFFER_SIZE - 1 - Serial.availableForWrite() < TELEM_BACKLOG) {
+    int b = telem.next();
+    if (b < 0) {
+      break;
+    }
+    Serial.write((uint8_t)b);
+  }
+}
+
+// Gửi hết hàng đợi, chỉ dùng khi sắp ngủ
+void telem_drain() {
+  while (!telem.idle()) {
+    telem_pump();
+  }
+  Serial.flush();
+}
+
+void telem_text(uint8_t prio, const char *text) {
+  telem.send(prio, TELEM_TEXT, (const uint8_t *)text, strlen(text));
+}
+
+// Trạng thái cảm biến và hướng chạy, 20 Hz
+void telem_state() {
+  uint16_t ms = millis();
+  uint8_t p[5];
+  p[0] = ms;
+  p[1] = ms >> 8;
+  p[2] = telem_cm(up_distance > 0 ? up_distance : 0);
+  p[3] = left_sensor_state | right_sensor_state << 1 | ball_detect_state << 2;
+  p[4] = drive_action;
+  telem.send(TELEM_HIGH, TELEM_STATE, p, sizeof(p));
+}
+
+// Một lần quét servo đầy đủ
+void telem_scan(const scan_t &s) {
+  uint8_t p[6 + SCAN_POINTS];
+  p[0] = s.seq;
+  p[1] = s.seq >> 8;
+  p[2] = s.dir;
+  p[3] = SCAN_MIN_DEG;
+  p[4] = SCAN_STEP_DEG;
+  p[5] = SCAN_POINTS;
+  for (uint8_t i = 0; i < SCAN_POINTS; i++) {
+    p[6 + i] = telem_cm(s.cm[i]);
+  }
+  telem.send(TELEM_MID, TELEM_SCAN, p, sizeof(p));
+}
+
+// Thống kê trễ hạn của một tác vụ
+void telem_sched(uint8_t task, const sched_task_t &t) {
+  uint16_t max_us = t.max_us > 0xffff ? 0xffff : t.max_us;
+  uint8_t p[7];
+  p[0] = task;
+  p[1] = t.overruns;
+  p[2] = t.overruns >> 8;
+  p[3] = t.skipped;
+  p[4] = t.skipped >> 8;
+  p[5] = max_us;
+  p[6] = max_us >> 8;
+  telem.send(TELEM_LOW, TELEM_SCHED, p, sizeof(p));
+}
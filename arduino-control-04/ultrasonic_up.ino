@@ -1,14 +1,48 @@
+// Cả hai chân echo (12 = PB4, 10 = PB2) nằm trên cổng B, dùng chung ngắt PCINT0
+
+ISR(PCINT0_vect) {
+  static uint8_t last;
+  uint8_t pins = PINB;
+  uint32_t now = micros();
+  uint8_t changed = pins ^ last;
+  last = pins;
+
+  if (changed & digitalPinToBitMask(echo_up)) {
+    ranging.edge(RANGING_UP, pins & digitalPinToBitMask(echo_up), now);
+  }
+  if (changed & digitalPinToBitMask(echo_down)) {
+    ranging.edge(RANGING_DOWN, pins & digitalPinToBitMask(echo_down), now);
+  }
+}
+
+// Bật ngắt đổi mức cho hai chân echo
+void ranging_begin() {
+  *digitalPinToPCMSK(echo_up) |= bit(digitalPinToPCMSKbit(echo_up));
+  *digitalPinToPCMSK(echo_down) |= bit(digitalPinToPCMSKbit(echo_down));
+  PCIFR = bit(digitalPinToPCICRbit(echo_up));
+  *digitalPinToPCICR(echo_up) |= bit(digitalPinToPCICRbit(echo_up));
+}
+
+// Gọi thường xuyên: phát xung trig khi đến lượt, không chờ echo
+void ranging_update() {
+  int8_t sensor = ranging.poll(micros());
+  if (sensor < 0) {
+    return;
+  }
+  int trig = sensor == RANGING_UP ? trig_up : trig_down;
+  digitalWrite(trig, HIGH);
+  delayMicroseconds(10);
+  digitalWrite(trig, LOW);
+}
 
 void ultrasonic_up()
 { 
-  digitalWrite(trig_up, LOW);
-  delayMicroseconds(2);
-  digitalWrite(trig_up, HIGH);
-  delayMicroseconds(10);
-  digitalWrite(trig_up, LOW);
-  up_duration = pulseIn(echo_up, HIGH);
-  up_distance= up_duration*0.034/2;
-  
-  Serial.print("Up_Distance: ");
-  Serial.println(up_distance);
+  static uint8_t last_count;
+
+  ranging_update();
+  if (ranging.count(RANGING_UP) != last_count) {    //Có kết quả đo mới
+    last_count = ranging.count(RANGING_UP);
+    up_range.update(ranging.echo_us(RANGING_UP), micros());
+    up_distance = up_range.cm();   //Gửi đi trong khung trạng thái
+  }
   }
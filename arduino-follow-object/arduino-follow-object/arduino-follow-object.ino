@@ -1,4 +1,5 @@
 #include <Servo.h>  //servo library
+#include <RangeEstimator.h>
 Servo myservo;      // create servo object to control servo
 
 //Ultrasonic sensor variables
@@ -16,6 +17,7 @@ int Trig = A5;
 #define carSpeed2 150
 
 int rightDistance = 0, leftDistance = 0;
+RangeEstimator rightRange, leftRange;   // one filter per servo position
 
 
  void setup() { 
@@ -35,11 +37,11 @@ void loop() {
   
     myservo.write(60);  //setservo position to right side
     delay(200); 
-    rightDistance = Distance_test();
+    rightDistance = Distance_test(rightRange);
 
     myservo.write(120);  //setservo position to left side
     delay(200); 
-    leftDistance = Distance_test();
+    leftDistance = Distance_test(leftRange);
 
 
     if((rightDistance > 70)&&(leftDistance > 70)){
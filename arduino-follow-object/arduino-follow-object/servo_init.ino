@@ -1,11 +1,12 @@
-//Ultrasonic distance measurement method
-int Distance_test() {
+//Ultrasonic distance measurement method, in cm, filtered by the estimator
+//kept for this servo direction
+int Distance_test(RangeEstimator &range) {
   digitalWrite(Trig, LOW);   
   delayMicroseconds(2);
   digitalWrite(Trig, HIGH);  
   delayMicroseconds(20);
   digitalWrite(Trig, LOW);   
-  float Fdistance = pulseIn(Echo, HIGH);  
-  Fdistance= Fdistance / 58;       
-  return (int)Fdistance;
+  unsigned long echo = pulseIn(Echo, HIGH, RANGE_TIMEOUT_US);
+  range.update(echo, micros());
+  return range.cm();
 }
@@ -8,13 +8,28 @@
   https://dronebotworkshop.com
 */
 
-#include "dl_lib_matrix3d.h"
 #include <esp32-hal-ledc.h>
 #include "esp_http_server.h"
 #include "esp_timer.h"
 #include "esp_camera.h"
 #include "img_converters.h"
+#include "esp_jpg_decode.h"
+#include "esp_heap_caps.h"
 #include "Arduino.h"
+#include "lwip/sockets.h"
+#include "freertos/event_groups.h"
+#include "frame_ring.h"
+#include "stream_fanout.h"
+#include "motion_sched.h"
+#include "cmd_table.h"
+#include "ball_detect.h"
+#include "jpeg_dc.h"
+#include "ball_tracker.h"
+#include "stream_adapt.h"
+#include "app_tasks.h"
+#include "app_log.h"
+#include "metrics.h"
+#include "html_control_gz.h"
 
 // TB6612FNG H-Bridge Connections (both PWM inputs driven by GPIO 2)
 #define MTR_PWM     16
@@ -35,8 +50,6 @@ const int motorPWMChannnel = 8;
 const int lresolution = 8;
 
 volatile unsigned int  motor_speed   = 200;
-volatile unsigned long previous_time = 0;
-volatile unsigned long move_interval = 250;
 
 // Placeholder for functions
 void robot_setup();
@@ -45,183 +58,846 @@ void robot_fwd();
 void robot_back();
 void robot_left();
 void robot_right();
+bool robot_command(unsigned int op, int new_speed, int duration);
+void startControlServer();
 
-uint8_t robo = 0;
+// Motion opcodes shared by /control?var=car and the binary control channel
+// (ws_control.cpp). The index is the opcode; ms is how long the move runs
+// before the motion timer stops it, 0 for primitives that are not timed.
+typedef struct {
+  void (*fn)();
+  uint16_t ms;
+} robot_op_t;
 
+static const robot_op_t robot_ops[] = {
+  {NULL,        0},     // 0: no-op, keeps the channel alive
+  {robot_fwd,   250},   // 1
+  {robot_left,  200},   // 2
+  {robot_stop,  0},     // 3
+  {robot_right, 200},   // 4
+  {robot_back,  250}    // 5
+};
+#define ROBOT_OP_COUNT (sizeof(robot_ops) / sizeof(robot_ops[0]))
 
-typedef struct {
-  httpd_req_t *req;
-  size_t len;
-} jpg_chunking_t;
+// Counters and latency histograms served at /metrics (metrics.h), also fed
+// by ws_control.cpp
+robot_metrics_t metrics;
 
-#define PART_BOUNDARY "123456789000000000000987654321"
-static const char* _STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
-static const char* _STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
-static const char* _STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n";
+// Motion queue
+// Moves are timed steps in a MotionScheduler. A one-shot esp_timer fires at
+// the deadline of the running step and wakes the motor task, which starts
+// the next queued step or stops the motors once the queue is empty. The
+// timer runs on core 0 with the network; the motor task owns the motor pins
+// on core 1 (app_tasks.h), so streaming does not delay a stop. The lock is
+// a mutex rather than a spinlock because ledcWrite may block.
+enum motion_mode_t {MOTION_REPLACE, MOTION_APPEND, MOTION_FLUSH};
 
-httpd_handle_t stream_httpd = NULL;
-httpd_handle_t camera_httpd = NULL;
+static MotionScheduler motion;
+static esp_timer_handle_t motion_timer = NULL;
+static SemaphoreHandle_t motion_lock = NULL;
+static TaskHandle_t motion_task = NULL;
 
-static size_t jpg_encode_stream(void * arg, size_t index, const void* data, size_t len) {
-  jpg_chunking_t *j = (jpg_chunking_t *)arg;
-  if (!index) {
-    j->len = 0;
+static void robot_apply(const motion_step_t &step) {
+  if (step.speed) {
+    speed = step.speed;
+    ledcWrite(8, speed);
   }
-  if (httpd_resp_send_chunk(j->req, (const char *)data, len) != ESP_OK) {
-    return 0;
+  robot_ops[step.op].fn();
+}
+
+// Runs with motion_lock held, MOTION_STOP when it stopped the motors
+static motion_result_t motion_run() {
+  motion_step_t step;
+  int64_t delay;
+  while (true) {
+    switch (motion.poll(esp_timer_get_time(), &step, &delay)) {
+      case MOTION_RUN:
+        robot_apply(step);
+        if (!delay) {
+          continue;     // zero length step, go straight to the next one
+        }
+        // fall through
+      case MOTION_WAIT:
+        esp_timer_stop(motion_timer);
+        esp_timer_start_once(motion_timer, delay);
+        return MOTION_WAIT;
+      case MOTION_STOP:
+        robot_stop();
+        return MOTION_STOP;
+      default:
+        return MOTION_IDLE;
+    }
   }
-  j->len += len;
-  return len;
 }
 
-static esp_err_t capture_handler(httpd_req_t *req) {
-  camera_fb_t * fb = NULL;
-  esp_err_t res = ESP_OK;
-  int64_t fr_start = esp_timer_get_time();
+static void motion_expire(void *arg) {
+  xTaskNotifyGive(motion_task);
+}
 
-  fb = esp_camera_fb_get();
-  if (!fb) {
-    Serial.println("Camera capture failed");
-    httpd_resp_send_500(req);
-    return ESP_FAIL;
+static void motor_task(void *arg) {
+  app_task_t *me = app_task_self(APP_TASK_MOTOR);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    int64_t start = esp_timer_get_time();
+    xSemaphoreTake(motion_lock, portMAX_DELAY);
+    // How late the motors stop against the deadline of the last step, timer
+    // and task wake-up included
+    bool timed = motion.active();
+    int64_t due = motion.deadline();
+    if (motion_run() == MOTION_STOP && timed) {
+      metrics.stop_late_us.add_us(esp_timer_get_time() - due);
+    }
+    xSemaphoreGive(motion_lock);
+    app_task_active(me, esp_timer_get_time() - start);
   }
+}
 
-  httpd_resp_set_type(req, "image/jpeg");
-  httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=capture.jpg");
+// Queues steps; steps with ms 0 get the default duration of their opcode.
+// Returns how many steps were accepted.
+static int motion_submit(const motion_step_t *steps, int n, motion_mode_t mode) {
+  int accepted = 0;
+  xSemaphoreTake(motion_lock, portMAX_DELAY);
+  if (mode == MOTION_REPLACE) {
+    esp_timer_stop(motion_timer);
+    motion.clear();
+  } else if (mode == MOTION_FLUSH) {
+    motion.flush();
+  }
+  for (; accepted < n; accepted++) {
+    motion_step_t step = steps[accepted];
+    if (!step.ms) {
+      step.ms = robot_ops[step.op].ms;
+    }
+    if (!motion.push(step)) {
+      break;
+    }
+  }
+  bool idle = !motion.active();
+  xSemaphoreGive(motion_lock);
+  if (idle) {
+    xTaskNotifyGive(motion_task);
+  }
+  return accepted;
+}
 
-  size_t out_len, out_width, out_height;
-  uint8_t * out_buf;
-  bool s;
-  {
-    size_t fb_len = 0;
-    if (fb->format == PIXFORMAT_JPEG) {
-      fb_len = fb->len;
-      res = httpd_resp_send(req, (const char *)fb->buf, fb->len);
+static void motion_init() {
+  esp_timer_create_args_t args = {};
+  args.callback = motion_expire;
+  args.name = "motion";
+  motion_lock = xSemaphoreCreateMutex();
+  esp_timer_create(&args, &motion_timer);
+  motion_task = app_task_start(APP_TASK_MOTOR, motor_task, NULL);
+}
+
+httpd_handle_t stream_httpd = NULL;
+httpd_handle_t camera_httpd = NULL;
+
+// Stream fan-out
+// Capture runs in its own task and publishes into a ring of the newest
+// frames. Every /stream viewer pins the newest complete frame, sends it and
+// unpins it, skipping whatever it missed while sending; a slow viewer never
+// stalls capture or the other viewers. The ring holds copies: the driver has
+// only one or two frame buffers, so each goes straight back to it and a
+// pinned frame never keeps esp_camera_fb_get() waiting.
+#define STREAM_MAX_CLIENTS   4      // bounded by the lwIP socket budget
+#define STREAM_SEND_TIMEOUT  5      // seconds before a stalled viewer is dropped
+#define FRAME_RING_SLOTS     (STREAM_MAX_CLIENTS + 4)   // viewers, vision, /capture, newest, next
+#define FRAME_READY_BIT      BIT0
+
+typedef struct {
+  uint8_t *buf;         // heap, PSRAM when there is some
+  size_t len;
+  uint16_t width;
+  uint16_t height;
+  int64_t stamp;        // esp_timer time the grab started
+} captured_frame_t;
+
+typedef FrameRing<captured_frame_t, FRAME_RING_SLOTS> frame_ring_t;
+typedef frame_ring_t::Slot frame_slot_t;
+
+static frame_ring_t *frame_ring = NULL;
+static EventGroupHandle_t frame_events = NULL;
+static TaskHandle_t capture_task = NULL;
+static SemaphoreHandle_t frame_lock = NULL;
+static volatile int frame_consumers = 0;
+static int stream_clients = 0;
+
+static void frame_return(const captured_frame_t &f) {
+  free(f.buf);
+}
+
+static void camera_capture_task(void *arg) {
+  app_task_t *me = app_task_self(APP_TASK_CAPTURE);
+  while (true) {
+    if (!frame_consumers) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+
+    frame_ring->collect(frame_return);
+    int64_t grab = esp_timer_get_time();
+    camera_fb_t *fb = esp_camera_fb_get();
+    captured_frame_t f = {NULL, 0, 0, 0, grab};
+    if (!fb) {
+      metrics.capture_failed.add();
+      LOG_LIMIT(LOG_ERROR, 1000, "Camera capture failed");
+      vTaskDelay(pdMS_TO_TICKS(10));
+      continue;
+    }
+    int64_t start = esp_timer_get_time();
+    f.width = fb->width;
+    f.height = fb->height;
+    bool jpeg_ok;
+    if (fb->format != PIXFORMAT_JPEG) {
+      jpeg_ok = frame2jpg(fb, 80, &f.buf, &f.len);
     } else {
-      jpg_chunking_t jchunk = {req, 0};
-      res = frame2jpg_cb(fb, 80, jpg_encode_stream, &jchunk) ? ESP_OK : ESP_FAIL;
-      httpd_resp_send_chunk(req, NULL, 0);
-      fb_len = jchunk.len;
+      f.buf = (uint8_t *)heap_caps_malloc(fb->len, psramFound() ? MALLOC_CAP_SPIRAM : MALLOC_CAP_8BIT);
+      jpeg_ok = f.buf != NULL;
+      if (jpeg_ok) {
+        memcpy(f.buf, fb->buf, fb->len);
+        f.len = fb->len;
+      }
     }
     esp_camera_fb_return(fb);
-    int64_t fr_end = esp_timer_get_time();
-    Serial.printf("JPG: %uB %ums\n", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start) / 1000));
-    return res;
+    if (!jpeg_ok) {
+      metrics.capture_failed.add();
+      LOG_LIMIT(LOG_ERROR, 1000, "JPEG compression or copy failed");
+      continue;
+    }
+
+    metrics.capture_us.add_us(esp_timer_get_time() - grab);
+    metrics.frames_captured.add();
+
+    if (!frame_ring->publish(f)) {
+      metrics.ring_full.add();
+      frame_return(f);
+      continue;
+    }
+    xEventGroupSetBits(frame_events, FRAME_READY_BIT);
+    xEventGroupClearBits(frame_events, FRAME_READY_BIT);
+    app_task_active(me, esp_timer_get_time() - start);
   }
+}
 
-  dl_matrix3du_t *image_matrix = dl_matrix3du_alloc(1, fb->width, fb->height, 3);
-  if (!image_matrix) {
-    esp_camera_fb_return(fb);
-    Serial.println("dl_matrix3du_alloc failed");
-    httpd_resp_send_500(req);
-    return ESP_FAIL;
+static void frame_consumer_add(int n) {
+  xSemaphoreTake(frame_lock, portMAX_DELAY);
+  frame_consumers += n;
+  xSemaphoreGive(frame_lock);
+  if (n > 0) {
+    xTaskNotifyGive(capture_task);
   }
+}
 
-  out_buf = image_matrix->item;
-  out_len = fb->width * fb->height * 3;
-  out_width = fb->width;
-  out_height = fb->height;
+// Waits up to wait_ms for the capture task to publish a frame.
+static void frame_wait(uint32_t wait_ms) {
+  xEventGroupWaitBits(frame_events, FRAME_READY_BIT, pdFALSE, pdFALSE, pdMS_TO_TICKS(wait_ms));
+}
 
-  s = fmt2rgb888(fb->buf, fb->len, fb->format, out_buf);
-  esp_camera_fb_return(fb);
+// Newest frame after last_seq, waiting up to wait_ms for the capture task.
+static frame_slot_t *frame_acquire(uint32_t last_seq, uint32_t wait_ms) {
+  frame_slot_t *s = frame_ring->acquire(last_seq);
   if (!s) {
-    dl_matrix3du_free(image_matrix);
-    Serial.println("to rgb888 failed");
-    httpd_resp_send_500(req);
+    frame_wait(wait_ms);
+    s = frame_ring->acquire(last_seq);
+  }
+  return s;
+}
+
+static void frame_release(frame_slot_t *s) {
+  frame_ring->release(s, frame_return);
+}
+
+// Stream quality
+// With "adaptive" on, every viewer reports how long its frames take to send
+// and StreamAdapt trades JPEG quality, then framesize, for frame rate. The
+// framesize and quality last set by hand are the most it will use. With
+// several viewers the slowest one sets the pace, since the camera settings
+// are shared.
+#define ADAPT_FRAMESIZE_MIN  FRAMESIZE_QVGA   // smallest the ball detector is useful on
+
+static StreamAdapt stream_adapt;
+static SemaphoreHandle_t adapt_lock = NULL;
+static volatile bool stream_adaptive = false;
+
+static void stream_adapt_apply(const adapt_setting_t &a) {
+  sensor_t *s = esp_camera_sensor_get();
+  if (s->status.quality != a.quality) {
+    s->set_quality(s, a.quality);
+  }
+  if (s->status.framesize != a.framesize) {
+    s->set_framesize(s, (framesize_t)a.framesize);
+  }
+}
+
+static void stream_adapt_frame(size_t len, int64_t send_us, int64_t wait_us) {
+  if (!stream_adaptive) {
+    return;
+  }
+  xSemaphoreTake(adapt_lock, portMAX_DELAY);
+  if (stream_adaptive && stream_adapt.frame(len, (uint32_t)send_us, (uint32_t)wait_us)) {
+    stream_adapt_apply(stream_adapt.setting());
+  }
+  xSemaphoreGive(adapt_lock);
+}
+
+// Applies the operator's framesize and quality (-1 keeps the last one) and
+// makes them the ceiling the controller starts from
+static void stream_adapt_set(bool on, int framesize, int quality) {
+  xSemaphoreTake(adapt_lock, portMAX_DELAY);
+  adapt_setting_t top = stream_adapt.limit();
+  top.framesize = framesize < 0 ? top.framesize : framesize;
+  top.quality = quality < 0 ? top.quality : quality;
+  stream_adapt.limits(ADAPT_FRAMESIZE_MIN, top.framesize, top.quality, ADAPT_QUALITY_WORST);
+  stream_adapt.reset(top.framesize, top.quality);
+  stream_adaptive = on;
+  stream_adapt_apply(top);
+  xSemaphoreGive(adapt_lock);
+}
+
+static bool stream_send(int fd, const char *data, size_t len) {
+  while (len) {
+    int n = send(fd, data, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+// A viewer's socket stays a session of the stream server, which deletes it
+// when the client hangs up, maybe before the sender task notices. The viewer
+// is the session's context, so httpd tells us through stream_viewer_free()
+// as it deletes the session, before it closes the socket. Every send holds
+// the viewer's lock and checks the session is still open, so a sender never
+// writes to, or asks to close, a descriptor httpd has already reused.
+typedef struct {
+  int fd;
+  SemaphoreHandle_t lock;
+  bool open;            // httpd has not deleted the session yet
+  uint8_t refs;         // the session and the sender task
+} stream_viewer_t;
+
+static void stream_viewer_put(stream_viewer_t *v) {
+  xSemaphoreTake(v->lock, portMAX_DELAY);
+  bool last = --v->refs == 0;
+  xSemaphoreGive(v->lock);
+  if (last) {
+    vSemaphoreDelete(v->lock);
+    free(v);
+  }
+}
+
+// free_ctx of the session, called on the stream server task
+static void stream_viewer_free(void *ctx) {
+  stream_viewer_t *v = (stream_viewer_t *)ctx;
+  xSemaphoreTake(v->lock, portMAX_DELAY);
+  v->open = false;
+  xSemaphoreGive(v->lock);
+  stream_viewer_put(v);
+}
+
+static bool stream_viewer_send(stream_viewer_t *v, const char *data, size_t len) {
+  xSemaphoreTake(v->lock, portMAX_DELAY);
+  bool ok = v->open && stream_send(v->fd, data, len);
+  xSemaphoreGive(v->lock);
+  return ok;
+}
+
+static void stream_client_task(void *arg) {
+  app_task_t *me = app_task_self(APP_TASK_STREAM);
+  stream_viewer_t *v = (stream_viewer_t *)arg;
+  StreamCursor<frame_ring_t> cursor(frame_ring);
+  char part_buf[STREAM_PART_LEN];
+  int64_t last_frame = esp_timer_get_time();
+
+  while (true) {
+    frame_slot_t *f = cursor.next();
+    if (!f) {
+      frame_wait(100);
+      continue;
+    }
+    if (cursor.gap()) {
+      metrics.frames_skipped.add(cursor.gap());
+    }
+
+    // The header waits while the last frame is still draining from the socket
+    size_t hlen = stream_part_header(part_buf, f->item.len);
+    int64_t fr_start = esp_timer_get_time();
+    bool ok = stream_viewer_send(v, part_buf, hlen);
+    int64_t fr_wait = esp_timer_get_time() - fr_start;
+    ok = ok && stream_viewer_send(v, (const char *)f->item.buf, f->item.len) &&
+         stream_viewer_send(v, STREAM_BOUNDARY, strlen(STREAM_BOUNDARY));
+    size_t frame_len = f->item.len;
+    cursor.done(f, ok, frame_return);
+    if (!ok) {
+      break;
+    }
+
+    int64_t fr_end = esp_timer_get_time();
+    app_task_active(me, fr_end - fr_start);
+    metrics.send_us.add_us(fr_end - fr_start);
+    metrics.frames_sent.add();
+    stream_adapt_frame(frame_len, fr_end - fr_start, fr_wait);
+    int64_t frame_time = (fr_end - last_frame) / 1000;
+    last_frame = fr_end;
+    LOG_LIMIT(LOG_DEBUG, 1000, "MJPG[%d]: %uB %ums (%.1ffps)", v->fd,
+              (uint32_t)(frame_len),
+              (uint32_t)frame_time, 1000.0 / (uint32_t)frame_time
+             );
+  }
+
+  xSemaphoreTake(frame_lock, portMAX_DELAY);
+  stream_clients--;
+  xSemaphoreGive(frame_lock);
+  frame_consumer_add(-1);
+  xSemaphoreTake(v->lock, portMAX_DELAY);
+  if (v->open) {
+    httpd_sess_trigger_close(stream_httpd, v->fd);
+  }
+  xSemaphoreGive(v->lock);
+  stream_viewer_put(v);
+  app_task_exit(me);
+  vTaskDelete(NULL);
+}
+
+// Hands the connection to its own sender task so the stream server stays free
+// to accept more viewers. The session keeps the viewer as its context, set
+// through req so httpd does not drop it when the handler returns.
+static esp_err_t stream_handler(httpd_req_t *req) {
+  static const char *hdr = "HTTP/1.1 200 OK\r\n"
+                           "Content-Type: multipart/x-mixed-replace;boundary=" PART_BOUNDARY "\r\n"
+                           "Access-Control-Allow-Origin: *\r\n\r\n";
+  int fd = httpd_req_to_sockfd(req);
+  app_task_self(APP_TASK_STREAM_HTTPD);
+
+  xSemaphoreTake(frame_lock, portMAX_DELAY);
+  bool full = stream_clients >= STREAM_MAX_CLIENTS;
+  if (!full) {
+    stream_clients++;
+  }
+  xSemaphoreGive(frame_lock);
+  if (full) {
+    LOG_W("Too many stream clients");
+    httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Too many viewers");
     return ESP_FAIL;
   }
 
-  jpg_chunking_t jchunk = {req, 0};
-  s = fmt2jpg_cb(out_buf, out_len, out_width, out_height, PIXFORMAT_RGB888, 90, jpg_encode_stream, &jchunk);
-  dl_matrix3du_free(image_matrix);
-  if (!s) {
-    Serial.println("JPEG compression failed");
+  struct timeval tv = {STREAM_SEND_TIMEOUT, 0};
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  stream_viewer_t *v = (stream_viewer_t *)malloc(sizeof(stream_viewer_t));
+  SemaphoreHandle_t lock = v ? xSemaphoreCreateMutex() : NULL;
+  if (lock) {
+    *v = {fd, lock, true, 2};
+  }
+  if (!lock || !stream_send(fd, hdr, strlen(hdr)) ||
+      !app_task_start(APP_TASK_STREAM, stream_client_task, v)) {
+    if (lock) {
+      vSemaphoreDelete(lock);
+    }
+    free(v);
+    xSemaphoreTake(frame_lock, portMAX_DELAY);
+    stream_clients--;
+    xSemaphoreGive(frame_lock);
     return ESP_FAIL;
   }
+  frame_consumer_add(1);
+  req->sess_ctx = v;
+  req->free_ctx = stream_viewer_free;
+  return ESP_OK;
+}
 
-  int64_t fr_end = esp_timer_get_time();
-  return res;
+// Ball detection
+// The vision task is one more reader of the frame ring. It copies the newest
+// JPEG out (so it never holds a ring slot while decoding). While the
+// tracker has the ball, only the window it predicts is decoded and searched.
+// Otherwise the ball is first looked for in the 1/8 scale thumbnail built
+// from the DC coefficients, and frames with nothing ball coloured stop there.
+// Decodes are scaled down to about VISION_WIDTH pixels across whatever the
+// framesize, keep only the window and give up once past its bottom edge.
+// Buffers are only ever grown; results are published in full frame pixels.
+#define VISION_WIDTH      160
+#define VISION_MARGIN     2     // thumbnail blocks added around a candidate
+
+typedef struct {
+  const uint8_t *in;
+  uint8_t *out;         // r plane, then g, then b, w * h each
+  size_t out_size;
+  int x0;               // window kept, decoder pixels
+  int y0;
+  int w;
+  int h;
+  bool done;            // decode stopped below the window
+} vision_decode_t;
+
+static BallDetector *ball_detector = NULL;
+static BallDetector *coarse_detector = NULL;
+static BallTracker ball_tracker;    // vision task only
+static JpegDc *jpeg_dc = NULL;
+static uint8_t *vision_jpg = NULL;
+static size_t vision_jpg_size = 0;
+static uint8_t *vision_thumb = NULL;
+static size_t vision_thumb_size = 0;
+static uint8_t *vision_rgb = NULL;
+static size_t vision_rgb_size = 0;
+static uint8_t *vision_mask = NULL;
+static size_t vision_mask_size = 0;
+
+static portMUX_TYPE ball_mux = portMUX_INITIALIZER_UNLOCKED;
+static ball_t ball_latest = {0, 0, 0, 0, 0};
+static uint32_t ball_frame = 0;
+static track_stats_t track_latest;
+
+static bool vision_reserve(uint8_t **buf, size_t *size, size_t need) {
+  if (need <= *size) {
+    return true;
+  }
+  uint8_t *p = (uint8_t *)heap_caps_realloc(*buf, need, psramFound() ? MALLOC_CAP_SPIRAM : MALLOC_CAP_8BIT);
+  if (!p) {
+    return false;
+  }
+  *buf = p;
+  *size = need;
+  return true;
 }
 
-static esp_err_t stream_handler(httpd_req_t *req) {
-  camera_fb_t * fb = NULL;
-  esp_err_t res = ESP_OK;
-  size_t _jpg_buf_len = 0;
-  uint8_t * _jpg_buf = NULL;
-  char * part_buf[64];
-  dl_matrix3du_t *image_matrix = NULL;
+static size_t vision_jpg_read(void *arg, size_t index, uint8_t *buf, size_t len) {
+  vision_decode_t *d = (vision_decode_t *)arg;
+  if (buf) {
+    memcpy(buf, d->in + index, len);
+  }
+  return len;
+}
 
-  static int64_t last_frame = 0;
-  if (!last_frame) {
-    last_frame = esp_timer_get_time();
+static bool vision_rgb_write(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data) {
+  vision_decode_t *d = (vision_decode_t *)arg;
+  if (!data) {
+    if (x == 0 && y == 0) {
+      if (d->x0 + d->w > w) d->w = w - d->x0;
+      if (d->y0 + d->h > h) d->h = h - d->y0;
+      return d->w > 0 && d->h > 0 && (size_t)d->w * d->h * 3 <= d->out_size;
+    }
+    return true;
+  }
+  if (y >= d->y0 + d->h) {
+    d->done = true;
+    return false;       // blocks come top to bottom, the rest is not needed
+  }
+  int xa = x > d->x0 ? x : d->x0;
+  int xb = x + w < d->x0 + d->w ? x + w : d->x0 + d->w;
+  int ya = y > d->y0 ? y : d->y0;
+  int yb = y + h < d->y0 + d->h ? y + h : d->y0 + d->h;
+  if (xa >= xb || ya >= yb) {
+    return true;
   }
+  // Split the part of the block inside the window into the three planes
+  size_t plane = (size_t)d->w * d->h;
+  for (int iy = ya; iy < yb; iy++) {
+    uint8_t *r = d->out + (size_t)(iy - d->y0) * d->w + (xa - d->x0);
+    uint8_t *g = r + plane;
+    uint8_t *b = g + plane;
+    const uint8_t *src = data + ((size_t)(iy - y) * w + (xa - x)) * 3;
+    for (int ix = 0; ix < xb - xa; ix++) {
+      r[ix] = src[0];
+      g[ix] = src[1];
+      b[ix] = src[2];
+      src += 3;
+    }
+  }
+  return true;
+}
 
-  res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
-  if (res != ESP_OK) {
-    return res;
+// Decoder scale (as a shift) for a frame fw pixels wide
+static int vision_shift(int fw) {
+  int shift = 1;
+  while (shift < JPG_SCALE_MAX && (fw >> shift) > VISION_WIDTH) {
+    shift++;
   }
+  return shift;
+}
 
-  while (true) {
-    fb = esp_camera_fb_get();
-    if (!fb) {
-      Serial.println("Camera capture failed");
-      res = ESP_FAIL;
-    } else {
-      {
-        if (fb->format != PIXFORMAT_JPEG) {
-          bool jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
-          esp_camera_fb_return(fb);
-          fb = NULL;
-          if (!jpeg_converted) {
-            Serial.println("JPEG compression failed");
-            res = ESP_FAIL;
-          }
-        } else {
-          _jpg_buf_len = fb->len;
-          _jpg_buf = fb->buf;
-        }
-      }
+// Searches the tracker's window, or failing that does a coarse search on the
+// DC thumbnail and runs the full detector on the window around what it
+// found. Falls back to the whole frame when the thumbnail can not be built.
+// Returns false when the frame could not be decoded.
+static bool vision_detect(uint32_t seq, size_t len, int fw, int fh, ball_t *ball) {
+  int tw = (fw + 7) >> 3;
+  int th = (fh + 7) >> 3;
+  size_t tplane = (size_t)tw * th;
+  int shift = vision_shift(fw);
+  uint32_t pixels = 0;
+  int x0 = 0;
+  int y0 = 0;
+  int x1 = fw;
+  int y1 = fh;
+
+  static int last_fw = 0;
+  if (fw != last_fw) {
+    ball_tracker.reset();   // framesize changed, the track is in old pixels
+    last_fw = fw;
+  }
+
+  track_window_t win;
+  bool windowed = ball_tracker.predict(seq, fw, fh, &win);
+  if (windowed) {
+    x0 = win.x0;
+    y0 = win.y0;
+    x1 = win.x1;
+    y1 = win.y1;
+  } else if (jpeg_dc->decode(vision_jpg, len, vision_thumb, vision_thumb + tplane, vision_thumb + 2 * tplane, tplane) == JPEG_DC_OK &&
+      jpeg_dc->width() == tw && jpeg_dc->height() == th) {
+    ball_t c = coarse_detector->detect(vision_thumb, vision_thumb + tplane, vision_thumb + 2 * tplane,
+                                       tw, th, (uint32_t *)vision_mask);
+    pixels = tplane;
+    if (!c.confidence) {
+      ball_tracker.update(seq, c, false, pixels);
+      *ball = c;
+      return true;
     }
-    if (res == ESP_OK) {
-      size_t hlen = snprintf((char *)part_buf, 64, _STREAM_PART, _jpg_buf_len);
-      res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
+    int m = c.r + VISION_MARGIN;
+    x0 = c.x > m ? (c.x - m) * 8 : 0;
+    y0 = c.y > m ? (c.y - m) * 8 : 0;
+    x1 = (c.x + m + 1) * 8 < fw ? (c.x + m + 1) * 8 : fw;
+    y1 = (c.y + m + 1) * 8 < fh ? (c.y + m + 1) * 8 : fh;
+  }
+
+  vision_decode_t d = {vision_jpg, vision_rgb, vision_rgb_size,
+                       x0 >> shift, y0 >> shift,
+                       ((x1 - x0) >> shift) + 1, ((y1 - y0) >> shift) + 1, false};
+  if (esp_jpg_decode(len, (jpg_scale_t)shift, vision_jpg_read, vision_rgb_write, &d) != ESP_OK && !d.done) {
+    return false;
+  }
+  size_t plane = (size_t)d.w * d.h;
+  ball_t b = ball_detector->detect(vision_rgb, vision_rgb + plane, vision_rgb + 2 * plane,
+                                   d.w, d.h, (uint32_t *)vision_mask);
+  pixels += plane;
+  if (b.confidence) {
+    b.x = (b.x + d.x0) << shift;
+    b.y = (b.y + d.y0) << shift;
+    b.r <<= shift;
+    b.area <<= 2 * shift;
+  }
+  ball_tracker.update(seq, b, windowed, pixels);
+  *ball = b;
+  return true;
+}
+
+static void vision_task(void *arg) {
+  app_task_t *me = app_task_self(APP_TASK_VISION);
+  uint32_t last_seq = 0;
+  frame_consumer_add(1);
+
+  while (true) {
+    frame_slot_t *f = frame_acquire(last_seq, 100);
+    if (!f) {
+      continue;
     }
-    if (res == ESP_OK) {
-      res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
+    int64_t start = esp_timer_get_time();
+    last_seq = f->seq;
+    size_t len = f->item.len;
+    int fw = f->item.width;
+    int fh = f->item.height;
+    int shift = vision_shift(fw);
+    int vw = (fw >> shift) + 1;
+    int vh = (fh >> shift) + 1;
+    size_t tplane = (size_t)((fw + 7) >> 3) * ((fh + 7) >> 3);
+    bool ok = vision_reserve(&vision_jpg, &vision_jpg_size, len) &&
+              vision_reserve(&vision_thumb, &vision_thumb_size, tplane * 3) &&
+              vision_reserve(&vision_rgb, &vision_rgb_size, (size_t)vw * vh * 3) &&
+              vision_reserve(&vision_mask, &vision_mask_size, (size_t)vh * BALL_MASK_WORDS(vw) * 4);
+    if (ok) {
+      memcpy(vision_jpg, f->item.buf, len);
     }
-    if (res == ESP_OK) {
-      res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+    frame_release(f);
+    if (!ok) {
+      LOG_E("vision buffer alloc failed");
+      vTaskDelay(pdMS_TO_TICKS(1000));
+      continue;
     }
-    if (fb) {
-      esp_camera_fb_return(fb);
-      fb = NULL;
-      _jpg_buf = NULL;
-    } else if (_jpg_buf) {
-      free(_jpg_buf);
-      _jpg_buf = NULL;
+
+    ball_t b;
+    bool found = vision_detect(last_seq, len, fw, fh, &b);
+    if (found) {
+      portENTER_CRITICAL(&ball_mux);
+      ball_latest = b;
+      ball_frame = last_seq;
+      track_latest = ball_tracker.stats();
+      portEXIT_CRITICAL(&ball_mux);
     }
-    if (res != ESP_OK) {
-      break;
+    app_task_active(me, esp_timer_get_time() - start);
+  }
+}
+
+// Still pictures
+// /capture sends the newest frame in the ring, pinned the way a /stream
+// viewer pins it, so a still grab never takes a driver buffer from the
+// stream and nothing is copied again. Only when that frame is more than
+// snap_age ms old, or there is none because nothing is streaming, is the
+// capture task woken, and then /capture waits at most SNAP_WAIT_MS for a
+// frame that started after the request did. Nothing is locked while it
+// waits or sends, so the other handlers on port 80 never queue behind it.
+#define SNAP_AGE_MS   200
+#define SNAP_WAIT_MS  100       // a frame period at 10 fps, then the old frame is sent after all
+
+static volatile int snap_age_ms = SNAP_AGE_MS;
+
+// Pins the frame to send for a request made at now, NULL if there is none
+static frame_slot_t *snap_acquire(int64_t now) {
+  frame_slot_t *f = frame_ring->acquire(0);
+  if (f && now - f->item.stamp <= (int64_t)snap_age_ms * 1000) {
+    return f;
+  }
+
+  metrics.snap_waits.add();
+  frame_consumer_add(1);
+  int64_t until = now + SNAP_WAIT_MS * 1000LL;
+  int64_t left;
+  while ((!f || f->item.stamp < now) && (left = until - esp_timer_get_time()) > 0) {
+    frame_slot_t *next = frame_acquire(f ? f->seq : 0, left / 1000 + 1);
+    if (next) {
+      if (f) {
+        frame_release(f);
+      }
+      f = next;
     }
-    int64_t fr_end = esp_timer_get_time();
-    int64_t frame_time = fr_end - last_frame;
-    last_frame = fr_end;
-    frame_time /= 1000;
-    Serial.printf("MJPG: %uB %ums (%.1ffps)\n",
-                  (uint32_t)(_jpg_buf_len),
-                  (uint32_t)frame_time, 1000.0 / (uint32_t)frame_time
-                 );
   }
+  frame_consumer_add(-1);
+  if (f && f->item.stamp < now) {
+    LOG_LIMIT(LOG_WARN, 1000, "no new frame for /capture, sending seq %u", f->seq);
+  }
+  return f;
+}
+
+static esp_err_t capture_handler(httpd_req_t *req) {
+  app_task_self(APP_TASK_HTTPD);
+  int64_t fr_start = esp_timer_get_time();
 
-  last_frame = 0;
+  frame_slot_t *f = snap_acquire(fr_start);
+  if (!f) {
+    LOG_E("Camera capture failed");
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+
+  char stamp[24];
+  char seq[12];
+  snprintf(stamp, sizeof(stamp), "%u.%06u", (uint32_t)(f->item.stamp / 1000000), (uint32_t)(f->item.stamp % 1000000));
+  snprintf(seq, sizeof(seq), "%u", f->seq);
+  httpd_resp_set_type(req, "image/jpeg");
+  httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=capture.jpg");
+  httpd_resp_set_hdr(req, "X-Timestamp", stamp);
+  httpd_resp_set_hdr(req, "X-Sequence", seq);
+  size_t fb_len = f->item.len;
+  esp_err_t res = httpd_resp_send(req, (const char *)f->item.buf, f->item.len);
+  frame_release(f);
+  metrics.snapshots.add();
+
+  int64_t fr_end = esp_timer_get_time();
+  LOG_LIMIT(LOG_INFO, 1000, "JPG: %uB %ums", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start) / 1000));
   return res;
 }
 
+// Latest detector output and the frame sequence number it came from
+uint32_t ball_get(ball_t *b) {
+  portENTER_CRITICAL(&ball_mux);
+  *b = ball_latest;
+  uint32_t seq = ball_frame;
+  portEXIT_CRITICAL(&ball_mux);
+  return seq;
+}
+
+void track_get(track_stats_t *t) {
+  portENTER_CRITICAL(&ball_mux);
+  *t = track_latest;
+  portEXIT_CRITICAL(&ball_mux);
+}
+
 enum state {fwd, rev, stp};
 state actstate = stp;
 
+// Handlers of the control variables in cmd_table.h
+typedef int (*cmd_fn_t)(int val);
+
+// While adaptive, framesize and quality set the controller's ceiling
+static int cmd_framesize(int val) {
+  sensor_t * s = esp_camera_sensor_get();
+  if (s->pixformat != PIXFORMAT_JPEG) {
+    return 0;
+  }
+  if (stream_adaptive) {
+    stream_adapt_set(true, val, -1);
+    return 0;
+  }
+  return s->set_framesize(s, (framesize_t)val);
+}
+
+static int cmd_quality(int val) {
+  sensor_t * s = esp_camera_sensor_get();
+  if (stream_adaptive) {
+    stream_adapt_set(true, -1, val);
+    return 0;
+  }
+  return s->set_quality(s, val);
+}
+
+static int cmd_adaptive(int val) {
+  sensor_t * s = esp_camera_sensor_get();
+  if (s->pixformat != PIXFORMAT_JPEG || (val != 0) == stream_adaptive) {
+    return 0;
+  }
+  if (val) {
+    stream_adapt_set(true, s->status.framesize, s->status.quality);
+  } else {
+    stream_adapt_set(false, -1, -1);    // back to the operator's setting
+  }
+  return 0;
+}
+
+static int cmd_flash(int val) {
+  ledcWrite(7, val);
+  return 0;
+}
+
+static int cmd_speed(int val) {
+  speed = val;
+  ledcWrite(8, speed);
+  return 0;
+}
+
+static int cmd_nostop(int val) {
+  noStop = val;
+  return 0;
+}
+
+static int cmd_car(int val) {
+  return robot_command(val, 0, 0) ? 0 : -1;
+}
+
+static int cmd_snap_age(int val) {
+  snap_age_ms = val;
+  return 0;
+}
+
+static_assert(CMD_FRAMESIZE_MAX == FRAMESIZE_UXGA, "framesize range in cmd_table.h");
+
+static const cmd_fn_t cmd_fns[CMD_COUNT] = {
+  cmd_framesize,    // CMD_FRAMESIZE
+  cmd_quality,      // CMD_QUALITY
+  cmd_flash,        // CMD_FLASH
+  cmd_flash,        // CMD_FLASHOFF
+  cmd_flash,        // CMD_AUTO_ON
+  cmd_flash,        // CMD_AUTO_OFF
+  cmd_speed,        // CMD_SPEED
+  cmd_nostop,       // CMD_NOSTOP
+  cmd_car,          // CMD_CAR
+  cmd_adaptive,     // CMD_ADAPTIVE
+  cmd_snap_age,     // CMD_SNAP_AGE
+};
+
 static esp_err_t cmd_handler(httpd_req_t *req)
 {
+  int64_t start = esp_timer_get_time();
   char*  buf;
   size_t buf_len;
   char variable[32] = {0,};
@@ -254,82 +930,18 @@ static esp_err_t cmd_handler(httpd_req_t *req)
   }
 
   int val = atoi(value);
-  sensor_t * s = esp_camera_sensor_get();
   int res = 0;
 
-// Look at values within URL to determine function
-  if (!strcmp(variable, "framesize"))
-  {
-    Serial.println("framesize");
-    if (s->pixformat == PIXFORMAT_JPEG) res = s->set_framesize(s, (framesize_t)val);
-  }
-  else if (!strcmp(variable, "quality"))
-  {
-    Serial.println("quality");
-    res = s->set_quality(s, val);
-  }
-  else if (!strcmp(variable, "flash"))
-  {
-    ledcWrite(7, val);
-  }
-  else if (!strcmp(variable, "flashoff"))
-  {
-    ledcWrite(7, val);
-  }
-
-  else if (!strcmp(variable, "auto_on"))
-  {
-    ledcWrite(7, val);
-  }
-  else if (!strcmp(variable, "auto_off"))
-  {
-    ledcWrite(7, val);
-  }
-  
-  else if (!strcmp(variable, "speed"))
-  {
-    if      (val > 255) val = 255;
-    else if (val <   0) val = 0;
-    speed = val;
-    ledcWrite(8, speed);
-  }
-  else if (!strcmp(variable, "nostop"))
-  {
-    noStop = val;
-  }
-  else if (!strcmp(variable, "car")) {
-    if (val == 1) {
-      Serial.println("Forward");
-      robot_fwd();
-      robo = 1;
-    }
-    else if (val == 2) {
-      Serial.println("TurnLeft");
-      robot_left();
-      robo = 1;
-    }
-    else if (val == 3) {
-      Serial.println("Stop");
-      robot_stop();
-    }
-    else if (val == 4) {
-      Serial.println("TurnRight");
-      robot_right();
-      robo = 1;
-    }
-    else if (val == 5) {
-      Serial.println("Backward");
-      robot_back();
-      robo = 1;
-    }
-    if (noStop != 1)
-    {
-
-    }
+  // Look at values within URL to determine function
+  const cmd_var_t *v = cmd_lookup(variable);
+  if (v) {
+    if      (val > v->max) val = v->max;
+    else if (val < v->min) val = v->min;
+    res = cmd_fns[v->id](val);
   }
   else
   {
-    Serial.println("variable");
+    LOG_W("unknown variable %s", variable);
     res = -1;
   }
 
@@ -338,11 +950,76 @@ static esp_err_t cmd_handler(httpd_req_t *req)
   }
 
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, NULL, 0);
+  esp_err_t ret = httpd_resp_send(req, NULL, 0);
+  metrics.control_us.add_us(esp_timer_get_time() - start);
+  return ret;
 }
 
+// /move?steps=1:400,4:150,1:300[&mode=replace|append|flush]
+// Each step is opcode:ms[:speed]; the whole batch runs back to back on the
+// motion timer without a round trip between steps. mode defaults to replace,
+// flush drops queued steps and lets the running one finish.
+static esp_err_t move_handler(httpd_req_t *req)
+{
+  int64_t start = esp_timer_get_time();
+  char query[256] = {0,};
+  char list[200] = {0,};
+  char mode_str[16] = "replace";
+  motion_step_t steps[MOTION_QUEUE_LEN];
+  int n = 0;
+
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+    httpd_resp_send_404(req);
+    return ESP_FAIL;
+  }
+  httpd_query_key_value(query, "mode", mode_str, sizeof(mode_str));
+  motion_mode_t mode = !strcmp(mode_str, "append") ? MOTION_APPEND :
+                       !strcmp(mode_str, "flush")  ? MOTION_FLUSH : MOTION_REPLACE;
+
+  if (httpd_query_key_value(query, "steps", list, sizeof(list)) == ESP_OK) {
+    char *p = list;
+    while (*p && n < MOTION_QUEUE_LEN) {
+      char *end;
+      long op = strtol(p, &end, 10);
+      long ms = 0;
+      long sp = 0;
+      if (*end == ':') ms = strtol(end + 1, &end, 10);
+      if (*end == ':') sp = strtol(end + 1, &end, 10);
+      if (end == p || op < 0 || op >= (long)ROBOT_OP_COUNT || !robot_ops[op].fn ||
+          ms < 0 || ms > 65535 || sp < 0 || sp > 255 || (*end && *end != ',')) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+      }
+      steps[n++] = {(uint8_t)op, (uint8_t)sp, (uint16_t)ms};
+      p = *end ? end + 1 : end;
+    }
+  } else if (mode != MOTION_FLUSH) {
+    httpd_resp_send_404(req);
+    return ESP_FAIL;
+  }
+
+  int accepted = motion_submit(steps, n, mode);
+  char rsp[32];
+  int len = snprintf(rsp, sizeof(rsp), "{\"queued\":%d}", accepted);
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  esp_err_t ret = httpd_resp_send(req, rsp, len);
+  metrics.control_us.add_us(esp_timer_get_time() - start);
+  return ret;
+}
+
+// Status and metrics replies are built in a heap buffer per request rather
+// than a static one, so two requests in flight never share it.
+#define STATUS_LEN   2048
+#define METRICS_LEN  1536
+
 static esp_err_t status_handler(httpd_req_t *req) {
-  static char json_response[1024];
+  app_task_self(APP_TASK_HTTPD);
+  char *json_response = (char *)malloc(STATUS_LEN);
+  if (!json_response) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
 
   sensor_t * s = esp_camera_sensor_get();
   char * p = json_response;
@@ -350,23 +1027,120 @@ static esp_err_t status_handler(httpd_req_t *req) {
 
   p += sprintf(p, "\"framesize\":%u,", s->status.framesize);
   p += sprintf(p, "\"quality\":%u,", s->status.quality);
+
+  xSemaphoreTake(adapt_lock, portMAX_DELAY);
+  p += sprintf(p, "\"adaptive\":%u,\"send_ms\":%u,\"kbps\":%u,", stream_adaptive ? 1 : 0,
+               stream_adapt.send_us() / 1000, stream_adapt.rate_kbps());
+  xSemaphoreGive(adapt_lock);
+
+  ball_t b;
+  uint32_t ball_seq = ball_get(&b);
+  p += sprintf(p, "\"ball\":{\"x\":%d,\"y\":%d,\"r\":%d,\"conf\":%u,\"frame\":%u},",
+               b.x, b.y, b.r, b.confidence, ball_seq);
+
+  track_stats_t t;
+  track_get(&t);
+  p += sprintf(p, "\"track\":{\"frames\":%u,\"windowed\":%u,\"hits\":%u,\"lost\":%u,\"pixels\":%u,\"avg_pixels\":%u}",
+               t.frames, t.windowed, t.hits, t.lost, t.pixels,
+               t.frames ? (uint32_t)(t.pixels_total / t.frames) : 0);
+  p += sprintf(p, ",\"tasks\":");
+  p += app_task_report(p, json_response + STATUS_LEN - 2 - p);
   *p++ = '}';
   *p++ = 0;
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, json_response, strlen(json_response));
+  esp_err_t res = httpd_resp_send(req, json_response, strlen(json_response));
+  free(json_response);
+  return res;
 }
 
+// Plain text, one metric per line (metrics.h), small enough to poll at 10 Hz
+static esp_err_t metrics_handler(httpd_req_t *req) {
+  app_task_self(APP_TASK_HTTPD);
+  char *buf = (char *)malloc(METRICS_LEN);
+  if (!buf) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
 
+  size_t len = snprintf(buf, METRICS_LEN, "counter uptime_ms %u\n", (uint32_t)(esp_timer_get_time() / 1000));
+  const struct {
+    const char *name;
+    const Counter &c;
+  } counters[] = {
+    {"frames_captured", metrics.frames_captured},
+    {"frames_sent",     metrics.frames_sent},
+    {"frames_skipped",  metrics.frames_skipped},
+    {"capture_failed",  metrics.capture_failed},
+    {"ring_full",       metrics.ring_full},
+    {"snapshots",       metrics.snapshots},
+    {"snap_waits",      metrics.snap_waits},
+  };
+  for (size_t i = 0; i < sizeof(counters) / sizeof(counters[0]) && len < METRICS_LEN; i++) {
+    len += counters[i].c.format(buf + len, METRICS_LEN - len, counters[i].name);
+  }
+  if (len < METRICS_LEN) {
+    len += snprintf(buf + len, METRICS_LEN - len, "counter log_dropped %u\n", log_dropped());
+  }
+  const struct {
+    const char *name;
+    const Histogram &h;
+  } hists[] = {
+    {"capture_us",   metrics.capture_us},
+    {"send_us",      metrics.send_us},
+    {"control_us",   metrics.control_us},
+    {"stop_late_us", metrics.stop_late_us},
+  };
+  for (size_t i = 0; i < sizeof(hists) / sizeof(hists[0]) && len < METRICS_LEN; i++) {
+    len += hists[i].h.format(buf + len, METRICS_LEN - len, hists[i].name);
+  }
+  if (len >= METRICS_LEN) {
+    len = METRICS_LEN - 1;
+  }
+
+  httpd_resp_set_type(req, "text/plain");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  esp_err_t res = httpd_resp_send(req, buf, len);
+  free(buf);
+  return res;
+}
 
+
+
+// Control page
+// Sent gzipped as page-gzip built it from html_control.ino, half the
+// bytes on the radio the stream shares. The ETag changes with the page and
+// no-cache makes the browser ask each time, so a reload costs a 304 with no
+// body and a reflashed page still shows at once.
 static esp_err_t index_handler(httpd_req_t *req){
+    char match[64];
+    httpd_resp_set_hdr(req, "ETag", INDEX_HTML_ETAG);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", match, sizeof(match)) == ESP_OK &&
+        strstr(match, INDEX_HTML_ETAG)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
     httpd_resp_set_type(req, "text/html");
-    return httpd_resp_send(req, (const char *)INDEX_HTML, strlen(INDEX_HTML));
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    return httpd_resp_send(req, (const char *)INDEX_HTML_GZ, INDEX_HTML_GZ_LEN);
 }
 
 void startCameraServer()
 {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.core_id = app_task_specs[APP_TASK_HTTPD].core;
+    config.task_priority = app_task_specs[APP_TASK_HTTPD].prio;
+    config.stack_size = app_task_specs[APP_TASK_HTTPD].stack;
+
+    motion_init();
+    adapt_lock = xSemaphoreCreateMutex();
+
+    frame_ring = new frame_ring_t();
+    frame_events = xEventGroupCreate();
+    frame_lock = xSemaphoreCreateMutex();
+    capture_task = app_task_start(APP_TASK_CAPTURE, camera_capture_task, NULL);
 
     httpd_uri_t index_uri = {
         .uri       = "/",
@@ -389,6 +1163,20 @@ void startCameraServer()
         .user_ctx  = NULL
     };
 
+    httpd_uri_t move_uri = {
+        .uri       = "/move",
+        .method    = HTTP_GET,
+        .handler   = move_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t metrics_uri = {
+        .uri       = "/metrics",
+        .method    = HTTP_GET,
+        .handler   = metrics_handler,
+        .user_ctx  = NULL
+    };
+
     httpd_uri_t capture_uri = {
         .uri       = "/capture",
         .method    = HTTP_GET,
@@ -403,20 +1191,37 @@ void startCameraServer()
         .user_ctx  = NULL
     };
     
-    Serial.printf("Starting web server on port: '%d'\n", config.server_port);
+    LOG_I("Starting web server on port: '%d'", config.server_port);
     if (httpd_start(&camera_httpd, &config) == ESP_OK) {
         httpd_register_uri_handler(camera_httpd, &index_uri);
         httpd_register_uri_handler(camera_httpd, &cmd_uri);
+        httpd_register_uri_handler(camera_httpd, &move_uri);
         httpd_register_uri_handler(camera_httpd, &status_uri);
+        httpd_register_uri_handler(camera_httpd, &metrics_uri);
         httpd_register_uri_handler(camera_httpd, &capture_uri);
     }
 
+
+    ball_detector = new BallDetector();
+    coarse_detector = new BallDetector();
+    ball_color_t coarse = ball_detector->color();
+    coarse.area_min = 1;    // one thumbnail block is 8x8 pixels
+    coarse_detector->set_color(coarse);
+    jpeg_dc = new JpegDc();
+    app_task_start(APP_TASK_VISION, vision_task, NULL);
+
     config.server_port += 1;
     config.ctrl_port += 1;
-    Serial.printf("Starting stream server on port: '%d'\n", config.server_port);
+    config.max_open_sockets = STREAM_MAX_CLIENTS + 1;
+    config.core_id = app_task_specs[APP_TASK_STREAM_HTTPD].core;
+    config.task_priority = app_task_specs[APP_TASK_STREAM_HTTPD].prio;
+    config.stack_size = app_task_specs[APP_TASK_STREAM_HTTPD].stack;
+    LOG_I("Starting stream server on port: '%d'", config.server_port);
     if (httpd_start(&stream_httpd, &config) == ESP_OK) {
         httpd_register_uri_handler(stream_httpd, &stream_uri);
     }
+
+    startControlServer();
 }
 
 unsigned int get_speed(unsigned int sp)
@@ -464,8 +1269,6 @@ void robot_back()
   digitalWrite(LEFT_M1,LOW);
   digitalWrite(RIGHT_M0,HIGH);
   digitalWrite(RIGHT_M1,LOW);
-  move_interval=250;
-  previous_time = millis();  
 }
 
 void robot_fwd()
@@ -474,8 +1277,6 @@ void robot_fwd()
   digitalWrite(LEFT_M1,HIGH);
   digitalWrite(RIGHT_M0,LOW);
   digitalWrite(RIGHT_M1,HIGH);
-  move_interval=250;
-   previous_time = millis();  
 }
 
 void robot_right()
@@ -484,8 +1285,6 @@ void robot_right()
   digitalWrite(LEFT_M1,LOW);
   digitalWrite(RIGHT_M0,LOW);
   digitalWrite(RIGHT_M1,HIGH);
-  move_interval=200;
-   previous_time = millis();
 }
 
 void robot_left()
@@ -494,6 +1293,23 @@ void robot_left()
   digitalWrite(LEFT_M1,HIGH);
   digitalWrite(RIGHT_M0,HIGH);
   digitalWrite(RIGHT_M1,LOW);
-  move_interval=200;
-   previous_time = millis();
+}
+
+// Runs one motion opcode, replacing whatever motion is in progress. speed 0
+// keeps the current speed and duration 0 keeps the default for the opcode.
+bool robot_command(unsigned int op, int new_speed, int duration)
+{
+  if (op >= ROBOT_OP_COUNT) {
+    return false;
+  }
+  motion_step_t step = {(uint8_t)op, (uint8_t)(new_speed > 255 ? 255 : new_speed), (uint16_t)duration};
+  if (!robot_ops[op].fn) {
+    if (step.speed) {
+      speed = step.speed;
+      ledcWrite(8, speed);
+    }
+    return true;
+  }
+  motion_submit(&step, 1, MOTION_REPLACE);
+  return true;
 }
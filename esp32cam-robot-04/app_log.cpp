@@ -0,0 +1,57 @@
+/*
+  ESP32CAM Robot Car
+  app_log.cpp (requires app_httpd.cpp)
+  Log ring and the task that drains it to Serial, see app_log.h.
+*/
+
+#include "esp_timer.h"
+#include "app_log.h"
+#include "app_tasks.h"
+
+#define LOG_SLOTS     32
+#define LOG_LEN       96      // longer messages are cut
+#define LOG_DRAIN_MS  20
+
+static LogRing<LOG_SLOTS, LOG_LEN> log_ring;
+static volatile uint32_t log_lost = 0;
+volatile uint8_t log_level = LOG_INFO;
+
+void log_write(uint8_t level, uint16_t skipped, const char *fmt, ...) {
+  log_meta_t meta = {millis(), skipped, level};
+  va_list args;
+  va_start(args, fmt);
+  log_ring.push(meta, fmt, args);
+  va_end(args);
+}
+
+uint32_t log_dropped() {
+  return log_lost;
+}
+
+static void log_task(void *arg) {
+  app_task_t *me = app_task_self(APP_TASK_LOG);
+  log_meta_t meta;
+  char text[LOG_LEN];
+
+  while (true) {
+    vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_MS));
+    int64_t start = esp_timer_get_time();
+    uint32_t lost = log_ring.take_dropped();
+    if (lost) {
+      log_lost += lost;
+      Serial.printf("log: %u messages dropped\n", lost);
+    }
+    while (log_ring.pop(&meta, text)) {
+      Serial.printf("%u.%03u %c %s", meta.ms / 1000, meta.ms % 1000, "EWID"[meta.level & 3], text);
+      if (meta.skipped) {
+        Serial.printf(" (+%u more)", meta.skipped);
+      }
+      Serial.println();
+    }
+    app_task_active(me, esp_timer_get_time() - start);
+  }
+}
+
+void log_begin() {
+  app_task_start(APP_TASK_LOG, log_task, NULL);
+}
@@ -0,0 +1,47 @@
+/*
+  ESP32CAM Robot Car
+  app_log.h (used by app_httpd.cpp, ws_control.cpp and esp32cam-robot-04.ino)
+  Logging that never waits on the UART.
+
+  LOG_E/W/I/D format the message into a LogRing (log_ring.h) and return; a
+  low priority task on core 0 writes the ring out to Serial. A full ring
+  drops the message and the drain reports how many were lost. LOG_LIMIT
+  lets its call site through at most once per period, for messages on a per
+  frame path, and the line that gets through says how many were held back.
+  Messages take no trailing newline.
+*/
+
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#include "Arduino.h"
+#include "log_ring.h"
+
+extern volatile uint8_t log_level;    // messages above this are not formatted
+
+void log_begin();
+void log_write(uint8_t level, uint16_t skipped, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+// Messages lost to a full ring since boot
+uint32_t log_dropped();
+
+#define LOG(level, fmt, ...) do { \
+    if ((level) <= log_level) { \
+      log_write((level), 0, fmt, ##__VA_ARGS__); \
+    } \
+  } while (0)
+
+#define LOG_E(fmt, ...) LOG(LOG_ERROR, fmt, ##__VA_ARGS__)
+#define LOG_W(fmt, ...) LOG(LOG_WARN, fmt, ##__VA_ARGS__)
+#define LOG_I(fmt, ...) LOG(LOG_INFO, fmt, ##__VA_ARGS__)
+#define LOG_D(fmt, ...) LOG(LOG_DEBUG, fmt, ##__VA_ARGS__)
+
+#define LOG_LIMIT(level, period_ms, fmt, ...) do { \
+    static LogLimit log_limit_; \
+    uint16_t log_skipped_; \
+    if ((level) <= log_level && log_limit_.allow(millis(), (period_ms), &log_skipped_)) { \
+      log_write((level), log_skipped_, fmt, ##__VA_ARGS__); \
+    } \
+  } while (0)
+
+#endif
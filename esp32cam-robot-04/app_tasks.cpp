@@ -0,0 +1,126 @@
+/*
+  ESP32CAM Robot Car
+  app_tasks.cpp (requires app_httpd.cpp)
+  Task table and the per-task report for /status, see app_tasks.h.
+*/
+
+#include "Arduino.h"
+#include "app_tasks.h"
+
+// Stacks in bytes. For reference WiFi runs at 23 and esp_timer at 22, both
+// on core 0.
+const app_task_spec_t app_task_specs[APP_TASK_KINDS] = {
+  {"motor",        2048, 20, CORE_CONTROL},
+  {"ws_control",   4096, 10, CORE_CONTROL},
+  {"httpd",        4096, 8,  CORE_CONTROL},
+  {"vision",       4096, 1,  CORE_CONTROL},
+  {"capture",      4096, 6,  CORE_MEDIA},
+  {"stream_httpd", 4096, 5,  CORE_MEDIA},
+  {"stream",       4096, 5,  CORE_MEDIA},
+  {"log",          3072, 1,  CORE_MEDIA},
+};
+
+static app_task_t app_tasks[APP_TASK_SLOTS];
+static portMUX_TYPE app_task_mux = portMUX_INITIALIZER_UNLOCKED;
+// Held by the report while it reads the stacks of the tasks it copied, and
+// by a task leaving, so none is deleted under the report
+static SemaphoreHandle_t app_task_report_lock = NULL;
+
+// Slot of the task, taken if it has none yet. A task that was just created
+// can ask before app_task_start() has stored its handle, so both sides go
+// through here and whichever comes first takes the slot.
+static app_task_t *app_task_slot(app_task_kind_t kind, TaskHandle_t handle) {
+  app_task_t *t = NULL;
+  app_task_t *free_slot = NULL;
+  portENTER_CRITICAL(&app_task_mux);
+  for (int i = 0; i < APP_TASK_SLOTS && !t; i++) {
+    if (app_tasks[i].handle == handle) {
+      t = &app_tasks[i];
+    } else if (!app_tasks[i].handle && !free_slot) {
+      free_slot = &app_tasks[i];
+    }
+  }
+  if (!t && free_slot) {
+    t = free_slot;
+    t->kind = kind;
+    t->handle = handle;
+    t->active_ms = 0;
+    t->active_us = 0;
+  }
+  portEXIT_CRITICAL(&app_task_mux);
+  return t;
+}
+
+TaskHandle_t app_task_start(app_task_kind_t kind, TaskFunction_t fn, void *arg) {
+  const app_task_spec_t &spec = app_task_specs[kind];
+  TaskHandle_t handle = NULL;
+  if (!app_task_report_lock) {
+    app_task_report_lock = xSemaphoreCreateMutex();   // first call is from setup()
+  }
+  if (xTaskCreatePinnedToCore(fn, spec.name, spec.stack, arg, spec.prio, &handle, spec.core) != pdPASS) {
+    return NULL;
+  }
+  app_task_slot(kind, handle);
+  return handle;
+}
+
+app_task_t *app_task_self(app_task_kind_t kind) {
+  return app_task_slot(kind, xTaskGetCurrentTaskHandle());
+}
+
+void app_task_exit(app_task_t *t) {
+  if (!t) {
+    return;
+  }
+  xSemaphoreTake(app_task_report_lock, portMAX_DELAY);
+  portENTER_CRITICAL(&app_task_mux);
+  t->handle = NULL;
+  portEXIT_CRITICAL(&app_task_mux);
+  xSemaphoreGive(app_task_report_lock);
+}
+
+void app_task_active(app_task_t *t, int64_t us) {
+  if (!t || us <= 0) {
+    return;
+  }
+  uint64_t total = t->active_us + (uint64_t)us;
+  t->active_us = total % 1000;
+  t->active_ms += total / 1000;
+}
+
+int app_task_report(char *buf, size_t size) {
+  app_task_t tasks[APP_TASK_SLOTS];
+  UBaseType_t stack_free[APP_TASK_SLOTS];
+
+  if (!app_task_report_lock) {
+    return snprintf(buf, size, "[]");
+  }
+  // Only the copy is made with interrupts off. The stacks are read after,
+  // which walks up to 4 KB each; a task frees its slot through the report
+  // lock before it is deleted, so the handles copied stay good until then.
+  xSemaphoreTake(app_task_report_lock, portMAX_DELAY);
+  portENTER_CRITICAL(&app_task_mux);
+  memcpy(tasks, app_tasks, sizeof(tasks));
+  portEXIT_CRITICAL(&app_task_mux);
+  for (int i = 0; i < APP_TASK_SLOTS; i++) {
+    stack_free[i] = tasks[i].handle ? uxTaskGetStackHighWaterMark(tasks[i].handle) : 0;
+  }
+  xSemaphoreGive(app_task_report_lock);
+
+  size_t len = snprintf(buf, size, "[");
+  for (int i = 0; i < APP_TASK_SLOTS && len < size; i++) {
+    const app_task_t &t = tasks[i];
+    if (!t.handle) {
+      continue;
+    }
+    const app_task_spec_t &spec = app_task_specs[t.kind];
+    len += snprintf(buf + len, size - len,
+                    "%s{\"name\":\"%s\",\"core\":%d,\"prio\":%u,\"stack\":%u,\"stack_free\":%u,\"active_ms\":%u}",
+                    len > 1 ? "," : "", spec.name, spec.core, spec.prio, spec.stack,
+                    stack_free[i], t.active_ms);
+  }
+  if (len < size) {
+    len += snprintf(buf + len, size - len, "]");
+  }
+  return len < size ? len : size - 1;
+}
@@ -0,0 +1,77 @@
+/*
+  ESP32CAM Robot Car
+  app_tasks.h (used by app_httpd.cpp and ws_control.cpp)
+  Which core, priority and stack each of the robot's tasks runs with.
+
+  Core 0 already carries the WiFi driver, lwIP and the esp_timer task, so
+  camera capture and everything that sends video stays there with them,
+  and the log drain below all of it.
+  Core 1 is kept for what steers the robot: the motor task at a high
+  priority, then the WebSocket control channel and the web server that
+  takes /control and /move. Vision runs there too, at the lowest priority,
+  so it only gets what the motor and control tasks leave.
+
+  Tasks are started or, for the httpd workers, registered here so /status
+  can list each one with its stack high-water mark and the time it spent
+  awake: from being woken for a job to waiting for the next one, time
+  blocked inside send() included. The httpd workers report their stack only.
+*/
+
+#ifndef APP_TASKS_H
+#define APP_TASKS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define CORE_MEDIA      0
+#define CORE_CONTROL    1
+#define APP_TASK_SLOTS  12      // running tasks tracked at once
+
+enum app_task_kind_t {
+  APP_TASK_MOTOR,         // runs the motion queue when its timer fires
+  APP_TASK_WS_CONTROL,
+  APP_TASK_HTTPD,         // port 80: page, /control, /move, /status, /metrics, /capture
+  APP_TASK_VISION,
+  APP_TASK_CAPTURE,
+  APP_TASK_STREAM_HTTPD,  // port 81, accepts viewers
+  APP_TASK_STREAM,        // one per viewer
+  APP_TASK_LOG,           // writes the log ring out to Serial
+  APP_TASK_KINDS
+};
+
+typedef struct {
+  const char *name;
+  uint32_t stack;         // bytes
+  UBaseType_t prio;
+  BaseType_t core;
+} app_task_spec_t;
+
+typedef struct {
+  uint8_t kind;
+  TaskHandle_t handle;    // NULL when the slot is free
+  volatile uint32_t active_ms;
+  uint32_t active_us;     // below a millisecond, not yet in active_ms
+} app_task_t;
+
+extern const app_task_spec_t app_task_specs[APP_TASK_KINDS];
+
+// Creates a task of the kind pinned to its core, NULL if it could not be
+// created. The task finds its slot with app_task_self().
+TaskHandle_t app_task_start(app_task_kind_t kind, TaskFunction_t fn, void *arg);
+
+// The calling task's slot, taken on first use for tasks created elsewhere
+app_task_t *app_task_self(app_task_kind_t kind);
+
+// Frees the slot, after a report that is reading its stack; call right
+// before vTaskDelete(NULL)
+void app_task_exit(app_task_t *t);
+
+// Adds time the task spent working, only ever called by the task itself
+void app_task_active(app_task_t *t, int64_t us);
+
+// JSON array with one object per running task, returns the length written
+int app_task_report(char *buf, size_t size);
+
+#endif
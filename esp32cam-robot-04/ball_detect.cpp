@@ -0,0 +1,156 @@
+/*
+  ESP32CAM Robot Car
+  ball_detect.cpp (see ball_detect.h)
+*/
+
+#include "ball_detect.h"
+
+static const ball_color_t BALL_COLOR_DEFAULT = {45, 85, 90, 80, 12};
+
+BallDetector::BallDetector() : color_(BALL_COLOR_DEFAULT), nruns_(0) {
+}
+
+int BallDetector::add_run(int x0, int x1, int y) {
+  if (nruns_ == BALL_MAX_RUNS) {
+    return -1;
+  }
+  Run &r = runs_[nruns_];
+  int len = x1 - x0 + 1;
+  r.x0 = x0;
+  r.x1 = x1;
+  r.y = y;
+  r.parent = nruns_;
+  r.area = len;
+  r.sum_x = (uint32_t)(x0 + x1) * len / 2;
+  r.sum_y = (uint32_t)y * len;
+  r.min_x = x0;
+  r.max_x = x1;
+  r.min_y = y;
+  r.max_y = y;
+  return nruns_++;
+}
+
+int BallDetector::find(int i) {
+  while (runs_[i].parent != i) {
+    runs_[i].parent = runs_[runs_[i].parent].parent;
+    i = runs_[i].parent;
+  }
+  return i;
+}
+
+// The lower index always becomes the root, so roots come before their runs
+void BallDetector::unite(int a, int b) {
+  a = find(a);
+  b = find(b);
+  if (a < b) {
+    runs_[b].parent = a;
+  } else if (b < a) {
+    runs_[a].parent = b;
+  }
+}
+
+ball_t BallDetector::detect(const uint8_t *r, const uint8_t *g, const uint8_t *b, int w, int h, uint32_t *mask) {
+  int words = BALL_MASK_WORDS(w);
+  for (int y = 0; y < h; y++) {
+    size_t o = (size_t)y * w;
+    ball_segment(r + o, g + o, b + o, w, color_, mask + (size_t)y * words);
+  }
+  return detect_mask(mask, w, h);
+}
+
+ball_t BallDetector::detect_mask(const uint32_t *mask, int w, int h) {
+  int words = BALL_MASK_WORDS(w);
+  nruns_ = 0;
+  int prev_start = 0;
+  int prev_end = 0;
+
+  for (int y = 0; y < h; y++) {
+    const uint32_t *row = mask + (size_t)y * words;
+    int cur_start = nruns_;
+    int k = prev_start;
+    int x0 = -1;
+
+    // Walk set and clear bit boundaries a word at a time
+    for (int wi = 0; wi <= words && nruns_ < BALL_MAX_RUNS; wi++) {
+      uint32_t word = wi < words ? row[wi] : 0;
+      int base = wi * 32;
+      int bit = 0;
+      while (bit < 32) {
+        uint32_t rest = word >> bit;
+        if (x0 < 0) {
+          if (!rest) {
+            break;
+          }
+          bit += __builtin_ctz(rest);
+          x0 = base + bit;
+        } else {
+          uint32_t clear = ~rest & (0xffffffffu >> bit);
+          if (!clear) {
+            break;      // run carries on into the next word
+          }
+          bit += __builtin_ctz(clear);
+          int x1 = base + bit - 1;
+          int cur = add_run(x0, x1 < w ? x1 : w - 1, y);
+          x0 = -1;
+          if (cur < 0) {
+            break;
+          }
+          // 8-connected overlap with runs of the previous row, both lists sorted by x
+          while (k < prev_end && runs_[k].x1 < runs_[cur].x0 - 1) {
+            k++;
+          }
+          for (int j = k; j < prev_end && runs_[j].x0 <= runs_[cur].x1 + 1; j++) {
+            unite(j, cur);
+          }
+        }
+      }
+    }
+    prev_start = cur_start;
+    prev_end = nruns_;
+  }
+
+  return best_blob();
+}
+
+ball_t BallDetector::best_blob() {
+  ball_t ball = {0, 0, 0, 0, 0};
+  int best = -1;
+
+  for (int i = 0; i < nruns_; i++) {
+    int root = find(i);
+    if (root == i) {
+      continue;
+    }
+    Run &r = runs_[root];
+    const Run &s = runs_[i];
+    r.area += s.area;
+    r.sum_x += s.sum_x;
+    r.sum_y += s.sum_y;
+    if (s.min_x < r.min_x) r.min_x = s.min_x;
+    if (s.max_x > r.max_x) r.max_x = s.max_x;
+    if (s.max_y > r.max_y) r.max_y = s.max_y;
+  }
+  for (int i = 0; i < nruns_; i++) {
+    if (runs_[i].parent == i && (best < 0 || runs_[i].area > runs_[best].area)) {
+      best = i;
+    }
+  }
+  if (best < 0 || runs_[best].area < color_.area_min) {
+    return ball;
+  }
+
+  const Run &r = runs_[best];
+  int bw = r.max_x - r.min_x + 1;
+  int bh = r.max_y - r.min_y + 1;
+  ball.x = r.sum_x / r.area;
+  ball.y = r.sum_y / r.area;
+  ball.r = (bw + bh) / 4;
+  ball.area = r.area;
+
+  // A disc fills pi/4 of its bounding box and has a square box
+  float fill = (float)r.area / (0.785f * bw * bh);
+  float aspect = bw < bh ? (float)bw / bh : (float)bh / bw;
+  float conf = (fill > 1.0f ? 1.0f : fill) * aspect * 100.0f;
+  ball.confidence = conf < 1.0f ? 1 : (uint8_t)conf;
+  return ball;
+}
@@ -0,0 +1,67 @@
+/*
+  ESP32CAM Robot Car
+  ball_detect.h (used by app_httpd.cpp)
+  Tennis ball detector: colour segmentation plus connected blob search.
+
+  Plain C++ with no camera or FreeRTOS dependencies, so the same code runs
+  on the robot and on a PC against recorded frames. The caller owns the
+  image planes and the mask; the detector keeps only fixed-size bookkeeping
+  between frames.
+*/
+
+#ifndef BALL_DETECT_H
+#define BALL_DETECT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ball_segment.h"
+
+#define BALL_MAX_RUNS  512    // pixel runs tracked per frame
+
+typedef struct {
+  int16_t  x;           // centroid, detector pixels
+  int16_t  y;
+  int16_t  r;           // radius, detector pixels
+  uint8_t  confidence;  // 0..100, 0 when no ball was found
+  uint32_t area;
+} ball_t;
+
+class BallDetector {
+  public:
+    BallDetector();
+
+    void set_color(const ball_color_t &color) {
+      color_ = color;
+    }
+
+    const ball_color_t &color() const {
+      return color_;
+    }
+
+    // Segments planar RGB (w * h per plane) into mask, then finds the ball.
+    // mask needs h * BALL_MASK_WORDS(w) words.
+    ball_t detect(const uint8_t *r, const uint8_t *g, const uint8_t *b, int w, int h, uint32_t *mask);
+
+    // Finds the ball in an already segmented mask, one padded row of
+    // BALL_MASK_WORDS(w) words per image row.
+    ball_t detect_mask(const uint32_t *mask, int w, int h);
+
+  private:
+    struct Run {
+      int16_t  x0, x1, y;
+      int16_t  parent;
+      uint32_t area, sum_x, sum_y;
+      int16_t  min_x, max_x, min_y, max_y;
+    };
+
+    int  add_run(int x0, int x1, int y);
+    int  find(int i);
+    void unite(int a, int b);
+    ball_t best_blob();
+
+    ball_color_t color_;
+    Run runs_[BALL_MAX_RUNS];
+    int nruns_;
+};
+
+#endif
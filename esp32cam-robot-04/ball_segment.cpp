@@ -0,0 +1,113 @@
+/*
+  ESP32CAM Robot Car
+  ball_segment.cpp (see ball_segment.h)
+
+  With blue the smallest channel, hue * delta = 60 * (delta + g - r) for hues
+  between 0 and 120 degrees, so the HSV window becomes five compares:
+    b <= r, b <= g, max >= val_min,
+    delta * 255 >= sat_min * max,
+    hue_min * delta <= 60 * (delta + g - r) <= hue_max * delta
+  Grey pixels (delta 0) are rejected explicitly so sat_min 0 is still safe.
+*/
+
+#include <string.h>
+#include "ball_segment.h"
+
+static inline uint32_t ball_classify(int r, int g, int b, const ball_color_t &c) {
+  int mx = r > g ? r : g;
+  int delta = mx - b;
+  int hue = 60 * (delta + g - r);
+  return (uint32_t)((b <= r) & (b <= g) & (delta > 0) &
+                    (mx >= c.val_min) &
+                    (delta * 255 >= c.sat_min * mx) &
+                    (hue >= c.hue_min * delta) &
+                    (hue <= c.hue_max * delta));
+}
+
+void ball_segment_scalar(const uint8_t *r, const uint8_t *g, const uint8_t *b, int n,
+                         const ball_color_t &c, uint32_t *mask) {
+  int i = 0;
+  for (; i + 32 <= n; i += 32) {
+    uint32_t word = 0;
+    for (int k = 0; k < 32; k++) {
+      word |= ball_classify(r[i + k], g[i + k], b[i + k], c) << k;
+    }
+    *mask++ = word;
+  }
+  if (i < n) {
+    uint32_t word = 0;
+    for (int k = 0; i + k < n; k++) {
+      word |= ball_classify(r[i + k], g[i + k], b[i + k], c) << k;
+    }
+    *mask = word;
+  }
+}
+
+#if BALL_SEGMENT_VECTOR
+
+// Every term of the test fits in 16 unsigned bits for pixels that pass the
+// b <= r, b <= g checks (255 * 255 and 60 * 510 at most), and lanes that fail
+// those checks are masked out whatever the other terms wrap to.
+typedef uint8_t  ball_u8x16 __attribute__((vector_size(16)));
+typedef uint16_t ball_u16x8 __attribute__((vector_size(16)));
+typedef int16_t  ball_i16x8 __attribute__((vector_size(16)));
+
+static inline void ball_widen(const uint8_t *p, ball_u16x8 *lo, ball_u16x8 *hi) {
+  const ball_u8x16 zero = {0};
+  const ball_u8x16 lo_idx = {0, 16, 1, 16, 2, 16, 3, 16, 4, 16, 5, 16, 6, 16, 7, 16};
+  const ball_u8x16 hi_idx = {8, 16, 9, 16, 10, 16, 11, 16, 12, 16, 13, 16, 14, 16, 15, 16};
+  ball_u8x16 v;
+  memcpy(&v, p, sizeof(v));
+  *lo = (ball_u16x8)__builtin_shuffle(v, zero, lo_idx);
+  *hi = (ball_u16x8)__builtin_shuffle(v, zero, hi_idx);
+}
+
+// 8 pixels to 8 mask bits
+static inline uint32_t ball_classify8(ball_u16x8 r, ball_u16x8 g, ball_u16x8 b, const ball_u16x8 *k) {
+  const ball_i16x8 lane = {1, 2, 4, 8, 16, 32, 64, 128};
+  const ball_i16x8 swap4 = {4, 5, 6, 7, 0, 1, 2, 3};
+  const ball_i16x8 swap2 = {2, 3, 0, 1, 6, 7, 4, 5};
+  const ball_i16x8 swap1 = {1, 0, 3, 2, 5, 4, 7, 6};
+  const ball_u16x8 zero = {0};
+
+  ball_u16x8 mx = r > g ? r : g;
+  ball_u16x8 delta = mx - b;
+  ball_u16x8 hue = 60 * (delta + g - r);
+  ball_i16x8 m = (b <= r) & (b <= g) & (delta > zero) &
+                 (mx >= k[0]) &
+                 (delta * 255 >= k[1] * mx) &
+                 (hue >= k[2] * delta) &
+                 (hue <= k[3] * delta);
+  m &= lane;
+  m |= __builtin_shuffle(m, swap4);
+  m |= __builtin_shuffle(m, swap2);
+  m |= __builtin_shuffle(m, swap1);
+  return (uint16_t)m[0];
+}
+
+void ball_segment_vector(const uint8_t *r, const uint8_t *g, const uint8_t *b, int n,
+                         const ball_color_t &c, uint32_t *mask) {
+  const ball_u16x8 zero = {0};
+  const ball_u16x8 k[4] = {
+    zero + c.val_min, zero + c.sat_min, zero + c.hue_min, zero + c.hue_max
+  };
+
+  int i = 0;
+  for (; i + 32 <= n; i += 32) {
+    uint32_t word = 0;
+    for (int j = 0; j < 32; j += 16) {
+      ball_u16x8 r0, r1, g0, g1, b0, b1;
+      ball_widen(r + i + j, &r0, &r1);
+      ball_widen(g + i + j, &g0, &g1);
+      ball_widen(b + i + j, &b0, &b1);
+      word |= ball_classify8(r0, g0, b0, k) << j;
+      word |= ball_classify8(r1, g1, b1, k) << (j + 8);
+    }
+    *mask++ = word;
+  }
+  if (i < n) {
+    ball_segment_scalar(r + i, g + i, b + i, n - i, c, mask);
+  }
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+  ESP32CAM Robot Car
+  ball_segment.h (used by ball_detect.cpp and app_httpd.cpp)
+  Ball colour segmentation on planar (structure of arrays) RGB.
+
+  Pixels are classified 32 at a time with branch-free integer compares and
+  packed into one mask word per block, bit i of word k being pixel 32k + i.
+  The scalar path is what runs on the ESP32; on a PC built with GCC a vector
+  path is used as well, and both produce identical masks.
+*/
+
+#ifndef BALL_SEGMENT_H
+#define BALL_SEGMENT_H
+
+#include <stdint.h>
+
+// HSV window for the ball. Hue is in degrees and must sit between red and
+// green (0..120) with blue the weakest channel, which covers the
+// yellow-green of a tennis ball. sat_min and val_min are 0..255.
+typedef struct {
+  uint8_t  hue_min;
+  uint8_t  hue_max;
+  uint8_t  sat_min;
+  uint8_t  val_min;
+  uint16_t area_min;    // smallest blob reported, in detector pixels
+} ball_color_t;
+
+#if defined(__GNUC__) && !defined(__clang__) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+#define BALL_SEGMENT_VECTOR 1
+#else
+#define BALL_SEGMENT_VECTOR 0
+#endif
+
+#define BALL_MASK_WORDS(n)  (((n) + 31) / 32)
+
+// n pixels from the r, g and b planes into BALL_MASK_WORDS(n) mask words;
+// unused bits of the last word are cleared.
+void ball_segment_scalar(const uint8_t *r, const uint8_t *g, const uint8_t *b, int n,
+                         const ball_color_t &c, uint32_t *mask);
+#if BALL_SEGMENT_VECTOR
+void ball_segment_vector(const uint8_t *r, const uint8_t *g, const uint8_t *b, int n,
+                         const ball_color_t &c, uint32_t *mask);
+#endif
+
+// Fastest path available on this target
+static inline void ball_segment(const uint8_t *r, const uint8_t *g, const uint8_t *b, int n,
+                                const ball_color_t &c, uint32_t *mask) {
+#if BALL_SEGMENT_VECTOR
+  ball_segment_vector(r, g, b, n, c, mask);
+#else
+  ball_segment_scalar(r, g, b, n, c, mask);
+#endif
+}
+
+#endif
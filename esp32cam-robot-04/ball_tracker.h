@@ -0,0 +1,143 @@
+/*
+  ESP32CAM Robot Car
+  ball_tracker.h (used by app_httpd.cpp)
+  Predicts where the ball will be in the next frame so that only a window
+  around it has to be searched.
+
+  Constant velocity alpha-beta filter in full frame pixels, stepped by frame
+  sequence number so frames the vision task never saw still count. The
+  window widens with every miss; after TRACK_MISSES_MAX misses in a row the
+  track is dropped and the caller goes back to whole frame searches. Plain
+  C++ like the detector, so recorded sequences can be replayed on a PC.
+*/
+
+#ifndef BALL_TRACKER_H
+#define BALL_TRACKER_H
+
+#include <stdint.h>
+#include "ball_detect.h"
+
+#define TRACK_MISSES_MAX  3     // misses before falling back to whole frames
+#define TRACK_MARGIN      16    // pixels kept around the predicted ball
+#define TRACK_DT_MAX      8     // frames a prediction is extrapolated at most
+
+typedef struct {
+  int16_t x0, y0;       // full frame pixels, x1 and y1 exclusive
+  int16_t x1, y1;
+} track_window_t;
+
+typedef struct {
+  uint32_t frames;      // results fed to update()
+  uint32_t windowed;    // of those, searched in a predicted window
+  uint32_t hits;        // of those, ball found in the window
+  uint32_t lost;        // tracks dropped after too many misses
+  uint32_t pixels;      // touched by the last frame
+  uint64_t pixels_total;
+} track_stats_t;
+
+class BallTracker {
+  public:
+    BallTracker() : x_(0), y_(0), vx_(0), vy_(0), r_(0), seq_(0), misses_(0), tracking_(false) {
+      stats_ = track_stats_t();
+    }
+
+    void reset() {
+      tracking_ = false;
+      misses_ = 0;
+    }
+
+    // Window to search in frame seq. False when there is no track and the
+    // whole frame has to be searched.
+    bool predict(uint32_t seq, int fw, int fh, track_window_t *win) const {
+      if (!tracking_) {
+        return false;
+      }
+      int dt = elapsed(seq);
+      int32_t px = (x_ + vx_ * dt) >> 4;
+      int32_t py = (y_ + vy_ * dt) >> 4;
+      int32_t speed = (abs32(vx_) + abs32(vy_)) * dt >> 4;
+      int32_t half = (2 * r_ + TRACK_MARGIN + speed) << misses_;
+
+      win->x0 = clamp(px - half, 0, fw);
+      win->x1 = clamp(px + half + 1, 0, fw);
+      win->y0 = clamp(py - half, 0, fh);
+      win->y1 = clamp(py + half + 1, 0, fh);
+      return win->x0 < win->x1 && win->y0 < win->y1;
+    }
+
+    // Detector result for frame seq, in full frame pixels. windowed says
+    // whether it came from a predict() window, pixels is the work it took.
+    void update(uint32_t seq, const ball_t &ball, bool windowed, uint32_t pixels) {
+      stats_.frames++;
+      stats_.pixels = pixels;
+      stats_.pixels_total += pixels;
+      if (windowed) {
+        stats_.windowed++;
+      }
+
+      if (!ball.confidence) {
+        if (tracking_ && ++misses_ > TRACK_MISSES_MAX) {
+          tracking_ = false;
+          stats_.lost++;
+        }
+        return;
+      }
+      if (windowed) {
+        stats_.hits++;
+      }
+
+      int32_t mx = (int32_t)ball.x << 4;
+      int32_t my = (int32_t)ball.y << 4;
+      if (!tracking_) {
+        x_ = mx;
+        y_ = my;
+        vx_ = 0;
+        vy_ = 0;
+      } else {
+        // alpha 3/4 on position, beta 1/4 on velocity
+        int dt = elapsed(seq);
+        int32_t px = x_ + vx_ * dt;
+        int32_t py = y_ + vy_ * dt;
+        x_ = px + (mx - px) * 3 / 4;
+        y_ = py + (my - py) * 3 / 4;
+        vx_ += (mx - px) / (4 * dt);
+        vy_ += (my - py) / (4 * dt);
+      }
+      r_ = ball.r;
+      seq_ = seq;
+      misses_ = 0;
+      tracking_ = true;
+    }
+
+    bool tracking() const {
+      return tracking_;
+    }
+
+    const track_stats_t &stats() const {
+      return stats_;
+    }
+
+  private:
+    int elapsed(uint32_t seq) const {
+      uint32_t dt = seq - seq_;
+      return dt < 1 ? 1 : dt > TRACK_DT_MAX ? TRACK_DT_MAX : (int)dt;
+    }
+
+    static int32_t abs32(int32_t v) {
+      return v < 0 ? -v : v;
+    }
+
+    static int16_t clamp(int32_t v, int32_t lo, int32_t hi) {
+      return v < lo ? lo : v > hi ? hi : v;
+    }
+
+    int32_t x_, y_;       // 1/16 pixel
+    int32_t vx_, vy_;     // 1/16 pixel per frame
+    int16_t r_;
+    uint32_t seq_;        // frame of the last hit
+    int misses_;
+    bool tracking_;
+    track_stats_t stats_;
+};
+
+#endif
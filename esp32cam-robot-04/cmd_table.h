@@ -0,0 +1,131 @@
+/*
+  ESP32CAM Robot Car
+  cmd_table.h (used by app_httpd.cpp)
+  Control variables for /control?var=<name>&val=<n> and their lookup.
+
+  Names are hashed at compile time into a 64 entry table and the build fails
+  if two of them land in the same bucket, so a lookup is one hash and one
+  strcmp however many knobs we add. Values are clamped to [min, max] before
+  the handler runs. The handlers stay in app_httpd.cpp, indexed by cmd_id_t
+  in the order of cmd_vars.
+*/
+
+#ifndef CMD_TABLE_H
+#define CMD_TABLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define CMD_BUCKETS     64
+#define CMD_HASH_SEED   2166136261u   // FNV-1a offset basis, change on a collision
+#define CMD_FRAMESIZE_MAX  13         // FRAMESIZE_UXGA, checked in app_httpd.cpp
+
+enum cmd_id_t {
+  CMD_FRAMESIZE,
+  CMD_QUALITY,
+  CMD_FLASH,
+  CMD_FLASHOFF,
+  CMD_AUTO_ON,
+  CMD_AUTO_OFF,
+  CMD_SPEED,
+  CMD_NOSTOP,
+  CMD_CAR,
+  CMD_ADAPTIVE,
+  CMD_SNAP_AGE,
+  CMD_COUNT         // also "no such variable"
+};
+
+typedef struct {
+  uint8_t id;
+  const char *name;
+  int min;
+  int max;
+} cmd_var_t;
+
+static constexpr cmd_var_t cmd_vars[] = {
+  {CMD_FRAMESIZE, "framesize", 0,  CMD_FRAMESIZE_MAX},
+  {CMD_QUALITY,   "quality",   0,  63},
+  {CMD_FLASH,     "flash",     0,  255},
+  {CMD_FLASHOFF,  "flashoff",  0,  255},
+  {CMD_AUTO_ON,   "auto_on",   0,  255},
+  {CMD_AUTO_OFF,  "auto_off",  0,  255},
+  {CMD_SPEED,     "speed",     0,  255},
+  {CMD_NOSTOP,    "nostop",    0,  1},
+  {CMD_CAR,       "car",       0,  5},
+  {CMD_ADAPTIVE,  "adaptive",  0,  1},
+  {CMD_SNAP_AGE,  "snap_age",  0,  5000},
+};
+
+static constexpr bool cmd_in_order(size_t i = 0) {
+  return i == CMD_COUNT || (cmd_vars[i].id == i && cmd_in_order(i + 1));
+}
+
+static_assert(sizeof(cmd_vars) / sizeof(cmd_vars[0]) == CMD_COUNT && cmd_in_order(),
+              "cmd_vars has to list every cmd_id_t once, in order");
+
+static constexpr uint32_t cmd_hash(const char *str, uint32_t h = CMD_HASH_SEED) {
+  return *str ? cmd_hash(str + 1, (h ^ (uint8_t)*str) * 16777619u) : h;
+}
+
+static constexpr uint32_t cmd_bucket(const char *str) {
+  return cmd_hash(str) & (CMD_BUCKETS - 1);
+}
+
+// Index of the variable in bucket b, CMD_COUNT if the bucket is empty
+static constexpr uint8_t cmd_find(uint32_t b, size_t i = 0) {
+  return i == CMD_COUNT ? (uint8_t)CMD_COUNT :
+         cmd_bucket(cmd_vars[i].name) == b ? i : cmd_find(b, i + 1);
+}
+
+static constexpr bool cmd_perfect(size_t i = 0, size_t j = 1) {
+  return i + 1 >= CMD_COUNT ? true :
+         j == CMD_COUNT ? cmd_perfect(i + 1, i + 2) :
+         cmd_bucket(cmd_vars[i].name) != cmd_bucket(cmd_vars[j].name) && cmd_perfect(i, j + 1);
+}
+
+static_assert(cmd_perfect(), "control variable names collide, change CMD_HASH_SEED");
+static_assert(CMD_COUNT < 255, "too many control variables for the bucket table");
+
+// cmd_lookup() done at compile time: the index a name resolves to, CMD_COUNT
+// when it is not a variable. Every name has to find itself, and names that
+// are not variables, even one landing in a taken bucket ("al" shares one
+// with "speed"), must find nothing.
+static constexpr bool cmd_equal(const char *a, const char *b) {
+  return *a == *b && (!*a || cmd_equal(a + 1, b + 1));
+}
+
+static constexpr size_t cmd_index(const char *name, size_t i) {
+  return i < CMD_COUNT && cmd_equal(cmd_vars[i].name, name) ? i : (size_t)CMD_COUNT;
+}
+
+static constexpr size_t cmd_index(const char *name) {
+  return cmd_index(name, cmd_find(cmd_bucket(name)));
+}
+
+static constexpr bool cmd_all_found(size_t i = 0) {
+  return i == CMD_COUNT || (cmd_index(cmd_vars[i].name) == i && cmd_all_found(i + 1));
+}
+
+static_assert(cmd_all_found(), "a control variable does not resolve to itself");
+static_assert(cmd_index("") == CMD_COUNT && cmd_index("al") == CMD_COUNT &&
+              cmd_index("fram") == CMD_COUNT && cmd_index("framesizes") == CMD_COUNT &&
+              cmd_index("Car") == CMD_COUNT && cmd_index("flashof") == CMD_COUNT,
+              "a name that is not a control variable resolves to one");
+
+#define CMD_B4(n)  cmd_find(n), cmd_find(n + 1), cmd_find(n + 2), cmd_find(n + 3)
+#define CMD_B16(n) CMD_B4(n), CMD_B4(n + 4), CMD_B4(n + 8), CMD_B4(n + 12)
+
+static const uint8_t cmd_buckets[CMD_BUCKETS] = {
+  CMD_B16(0), CMD_B16(16), CMD_B16(32), CMD_B16(48)
+};
+
+static inline const cmd_var_t *cmd_lookup(const char *name) {
+  uint8_t i = cmd_buckets[cmd_bucket(name)];
+  if (i == CMD_COUNT || strcmp(cmd_vars[i].name, name)) {
+    return NULL;
+  }
+  return &cmd_vars[i];
+}
+
+#endif
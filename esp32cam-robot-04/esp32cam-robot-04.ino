@@ -13,17 +13,13 @@
 #include <WiFi.h>
 #include "soc/soc.h"
 #include "soc/rtc_cntl_reg.h"
+#include "app_log.h"
 
 // Setup Access Point Credentials
 const char* ssid1 = "Hoangkhai99";
 const char* password1 = "1234567890";
 
-extern volatile unsigned int  motor_speed;
-extern void robot_stop();
 extern void robot_setup();
-extern uint8_t robo;
-extern volatile unsigned long previous_time;        
-extern volatile unsigned long move_interval; 
 
 #define CAMERA_MODEL_AI_THINKER
 #define PWDN_GPIO_NUM     32
@@ -51,8 +47,9 @@ void setup()
   WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 0); // prevent brownouts by silencing them
   
   Serial.begin(115200);
-  Serial.setDebugOutput(true);
+  Serial.setDebugOutput(false);   // driver logs would block on the UART too
   Serial.println();
+  log_begin();
 
 
 
@@ -91,7 +88,7 @@ void setup()
   // camera init
   esp_err_t err = esp_camera_init(&config);
   if (err != ESP_OK) {
-    Serial.printf("Camera init failed with error 0x%x", err);
+    LOG_E("Camera init failed with error 0x%x", err);
     return;
   }
 
@@ -103,8 +100,7 @@ void setup()
 
   WiFi.softAP(ssid1, password1);
   IPAddress myIP = WiFi.softAPIP();
-  Serial.print("AP IP address: ");
-  Serial.println(myIP);
+  LOG_I("AP IP address: %s", myIP.toString().c_str());
   
   startCameraServer();
 
@@ -119,23 +115,9 @@ void setup()
     ledcWrite(7,0);
     delay(50);    
   }
-      
-  previous_time = millis();
 }
 
 void loop() {
-  if(robo)
-  {
-    unsigned long currentMillis = millis();
-    if (currentMillis - previous_time >= move_interval) {
-      previous_time = currentMillis;
-      robot_stop();
-      char rsp[32];
-      sprintf(rsp,"SPPED: %d",motor_speed);
-      Serial.println("Stop");
-      robo=0;
-    }
-  }
-  delay(1);
-  yield();
+  // Motion timing runs on esp_timer (see app_httpd.cpp), nothing to poll here
+  vTaskDelete(NULL);
 }
@@ -0,0 +1,152 @@
+/*
+  ESP32CAM Robot Car
+  frame_ring.h (used by app_httpd.cpp)
+  Single-producer / multi-consumer ring holding the newest camera frames.
+
+  The capture task publishes frames, network senders pin the newest one,
+  send it and unpin it. Stale frames are handed back through a release
+  callback as soon as nobody holds them, so the producer never waits on a
+  slow reader and readers never see a half-written slot. Only std::atomic
+  is used, so the ring runs unchanged on a host with threads.
+*/
+
+#ifndef FRAME_RING_H
+#define FRAME_RING_H
+
+#include <atomic>
+#include <stdint.h>
+#include <stddef.h>
+
+template <typename T, int N>
+class FrameRing {
+  public:
+    struct Slot {
+      T item;
+      uint32_t seq;
+      // [31:16] generation, bit 15 FREE, bit 14 BUSY, [13:0] reader count.
+      // The generation changes on every publish so a stale compare-and-swap
+      // from a reader can never hit a refilled slot.
+      std::atomic<uint32_t> state;
+    };
+
+    // keep_latest = false gives the newest frame back too once it is
+    // unreferenced; needed when the driver has a single frame buffer.
+    explicit FrameRing(bool keep_latest = true)
+      : latest_(-1), seq_(0), keep_latest_(keep_latest) {
+      for (int i = 0; i < N; i++) {
+        slots_[i].seq = 0;
+        slots_[i].state.store(FREE);
+      }
+    }
+
+    // Producer: hand back every stale frame no reader holds.
+    template <typename Release>
+    int collect(Release release) {
+      int latest = latest_.load(std::memory_order_acquire);
+      int n = 0;
+      for (int i = 0; i < N; i++) {
+        if (keep_latest_ && i == latest) {
+          continue;
+        }
+        uint32_t w = slots_[i].state.load(std::memory_order_acquire);
+        if ((w & (FLAGS | COUNT)) == 0 && reclaim(i, w, release)) {
+          n++;
+        }
+      }
+      return n;
+    }
+
+    // Producer: make item the newest frame. Returns false when every slot
+    // is pinned; the caller still owns item then.
+    bool publish(const T &item) {
+      for (int i = 0; i < N; i++) {
+        uint32_t w = slots_[i].state.load(std::memory_order_acquire);
+        if (!(w & FREE)) {
+          continue;
+        }
+        slots_[i].item = item;
+        slots_[i].seq = ++seq_;
+        slots_[i].state.store((w & GEN) + GEN_ONE, std::memory_order_release);
+        latest_.store(i, std::memory_order_release);
+        return true;
+      }
+      return false;
+    }
+
+    // Consumer: pin the newest frame if it is newer than last_seq.
+    Slot *acquire(uint32_t last_seq) {
+      while (true) {
+        int i = latest_.load(std::memory_order_acquire);
+        if (i < 0) {
+          return NULL;
+        }
+        Slot *s = &slots_[i];
+        uint32_t w = s->state.load(std::memory_order_acquire);
+        if (w & FLAGS) {
+          if (latest_.load(std::memory_order_acquire) == i) {
+            return NULL;  // newest frame is being given back
+          }
+          continue;
+        }
+        if (!s->state.compare_exchange_weak(w, w + 1, std::memory_order_acq_rel)) {
+          continue;
+        }
+        if (s->seq == last_seq) {
+          unpin(s);
+          return NULL;
+        }
+        return s;
+      }
+    }
+
+    // Consumer: unpin. The last reader of a stale frame gives it back itself
+    // so a producer blocked on the driver is not left waiting.
+    template <typename Release>
+    void release(Slot *s, Release release) {
+      uint32_t w = unpin(s);
+      if (w & COUNT) {
+        return;
+      }
+      int i = s - slots_;
+      if (keep_latest_ && i == latest_.load(std::memory_order_acquire)) {
+        return;
+      }
+      reclaim(i, w, release);
+    }
+
+    uint32_t seq() const {
+      return seq_;
+    }
+
+  private:
+    static const uint32_t COUNT   = 0x3fff;
+    static const uint32_t BUSY    = 0x4000;
+    static const uint32_t FREE    = 0x8000;
+    static const uint32_t FLAGS   = FREE | BUSY;
+    static const uint32_t GEN     = 0xffff0000;
+    static const uint32_t GEN_ONE = 0x10000;
+
+    uint32_t unpin(Slot *s) {
+      return s->state.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    }
+
+    // w is the idle state the caller saw; fails if the slot moved on since.
+    template <typename Release>
+    bool reclaim(int i, uint32_t w, Release release) {
+      if (!slots_[i].state.compare_exchange_strong(w, w | BUSY, std::memory_order_acq_rel)) {
+        return false;
+      }
+      int latest = i;
+      latest_.compare_exchange_strong(latest, -1, std::memory_order_acq_rel);
+      release(slots_[i].item);
+      slots_[i].state.store((w & GEN) | FREE, std::memory_order_release);
+      return true;
+    }
+
+    Slot slots_[N];
+    std::atomic<int> latest_;
+    volatile uint32_t seq_;
+    bool keep_latest_;
+};
+
+#endif
@@ -1,3 +1,5 @@
+// The control page. The server sends html_control_gz.h, built from this by
+// page-gzip/page_gzip.cpp; run it again after editing the page.
 static const char PROGMEM INDEX_HTML[] = R"rawliteral(
 
 <!doctype html>
@@ -115,15 +117,15 @@ static const char PROGMEM INDEX_HTML[] = R"rawliteral(
                       <td align="center"><button  id="toggle-stream">Start</button></td>
                       <td></td></tr>
                   
-                  <tr><td></td><td align="center"><button class="button button2" id="forward" onclick="fetch(document.location.origin+'/control?var=car&val=1');">FORWARD</button></td><td></td></tr>
+                  <tr><td></td><td align="center"><button class="button button2" id="forward" onclick="car(1);">FORWARD</button></td><td></td></tr>
                   
-                  <tr><td align="center"><button class="button button2" id="turnleft" onclick="fetch(document.location.origin+'/control?var=car&val=2');">LEFT</button></td>
-                      <td align="center"><button class="button button4"id="stop">STOP</button></td>
-                      <td align="center"><button class="button button2" id="turnright" onclick="fetch(document.location.origin+'/control?var=car&val=4');">RIGHT</button></td></tr>
+                  <tr><td align="center"><button class="button button2" id="turnleft" onclick="car(2);">LEFT</button></td>
+                      <td align="center"><button class="button button4"id="stop" onclick="car(3);">STOP</button></td>
+                      <td align="center"><button class="button button2" id="turnright" onclick="car(4);">RIGHT</button></td></tr>
                   
                   <tr>
                       <td align="center"><button class="button button4" id="auto_on"  onclick="fetch(document.location.origin+'/control?var=auto_on&val=1');";>AUTO ON</button></td>
-                      <td align="center"><button class="button button2" id="backward" onclick="fetch(document.location.origin+'/control?var=car&val=5');">REVERSE</button></td>
+                      <td align="center"><button class="button button2" id="backward" onclick="car(5);">REVERSE</button></td>
                       <td align="center"><button class="button button4" id="auto_off" onclick="fetch(document.location.origin+'/control?var=auto_off&val=0');">AUTO OFF</button></td></tr>
 
                   <tr><td></td><td align="center"><button class="button button4" id="flash" onclick="fetch(document.location.origin+'/control?var=flash&val=1');">FLASH ON</button></td><td></td></tr>
@@ -140,12 +142,19 @@ static const char PROGMEM INDEX_HTML[] = R"rawliteral(
                     <tr><td></td><td >Motor Speed:</td><td align="center" colspan="2"><input type="range" id="speed" min="0" max="255" value="200" onchange="try{fetch(document.location.origin+'/control?var=speed&val='+this.value);}catch(e){}"></td><td></td></tr>
                     <tr><td></td><td >Vid Quality:</td><td align="center" colspan="2"><input type="range" id="quality" min="10" max="63" value="10" onchange="try{fetch(document.location.origin+'/control?var=quality&val='+this.value);}catch(e){}"></td><td></td></tr>
                     <tr><td></td><td >Vid Size:</td><td align="center" colspan="2"><input type="range" id="framesize" min="0" max="6" value="5" onchange="try{fetch(document.location.origin+'/control?var=framesize&val='+this.value);}catch(e){}"></td></tr>
+                    <tr><td></td><td >Auto Quality:</td><td align="center" colspan="2"><input type="checkbox" id="adaptive" class="default-action" onchange="try{fetch(document.location.origin+'/control?var=adaptive&val='+(this.checked?1:0));}catch(e){}"></td></tr>
                  
                   </table>
                 </div>
               
             </section>         
         </section>
+        <script>
+        var ws=null,wsSeq=0;
+        function wsOpen(){ws=new WebSocket('ws://'+document.location.hostname+':82/');ws.binaryType='arraybuffer';ws.onclose=function(){ws=null;setTimeout(wsOpen,1000)}}
+        function car(op,speed,ms){if(ws&&ws.readyState===1){var d=new DataView(new ArrayBuffer(8));d.setUint8(0,op);d.setUint8(1,speed||0);d.setUint16(2,ms||0,true);d.setUint32(4,++wsSeq,true);ws.send(d.buffer)}else{fetch(document.location.origin+'/control?var=car&val='+op)}}
+        wsOpen();
+        </script>
         <script> document.addEventListener('DOMContentLoaded',function(){function b(B){let C;switch(B.type){case'checkbox':C=B.checked?1:0;break;case'range':case'select-one':C=B.value;break;case'button':case'submit':C='1';break;default:return;}const D=`${c}/control?var=${B.id}&val=${C}`;fetch(D).then(E=>{console.log(`request to ${D} finished, status: ${E.status}`)})}
         var c=document.location.origin;const e=B=>{B.classList.add('hidden')},f=B=>{B.classList.remove('hidden')},g=B=>{B.classList.add('disabled'),B.disabled=!0},h=B=>{B.classList.remove('disabled'),B.disabled=!1},i=(B,C,D)=>{D=!(null!=D)||D;let E;'checkbox'===B.type?(E=B.checked,C=!!C,B.checked=C):(E=B.value,B.value=C),D&&E!==C?b(B):!D&&('aec'===B.id?C?e(v):f(v):'agc'===B.id?C?(f(t),e(s)):(e(t),f(s)):'awb_gain'===B.id?C?f(x):e(x):'face_recognize'===B.id&&(C?h(n):g(n)))};
         document.querySelectorAll('.close').forEach(B=>{B.onclick=()=>{e(B.parentNode)}}),fetch(`${c}/status`).then(function(B){return B.json()}).then(function(B){document.querySelectorAll('.default-action').forEach(C=>{i(C,B[C.id],!1)})});
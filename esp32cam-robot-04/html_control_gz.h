@@ -0,0 +1,669 @@
+/*
+  ESP32CAM Robot Car
+  generated from html_control.ino by page-gzip/page_gzip.cpp, do not edit
+  Gzipped pages with their ETags, sent by app_httpd.cpp.
+*/
+
+#ifndef HTML_CONTROL_GZ_H
+#define HTML_CONTROL_GZ_H
+
+#include <stdint.h>
+
+// INDEX_HTML: 21624 bytes, 10402 gzipped
+#define INDEX_HTML_GZ_LEN 10402
+#define INDEX_HTML_ETAG "\"dc4481da35f39e15\""
+static const uint8_t PROGMEM INDEX_HTML_GZ[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x7c, 0x69, 0x97, 0xda, 0xca,
+  0xb5, 0xe8, 0xf7, 0xfc, 0x0a, 0x8e, 0x93, 0x1b, 0x77, 0x3f, 0xba, 0x5b, 0x33, 0x82, 0xb6, 0xdb,
+  0xe7, 0x09, 0x84, 0x10, 0x20, 0x04, 0x48, 0x20, 0x09, 0xee, 0xba, 0x2b, 0xd1, 0x3c, 0xa0, 0x79,
+  0x16, 0x8e, 0x7f, 0xc7, 0xfb, 0x41, 0xef, 0x8f, 0xbd, 0x12, 0xd0, 0xb3, 0x7d, 0x9c, 0xe4, 0xdc,
+  0xe4, 0xae, 0xf5, 0xba, 0x97, 0x9b, 0x52, 0xd5, 0xae, 0x3d, 0xef, 0x5d, 0xbb, 0xe4, 0x2a, 0xfe,
+  0xf0, 0x87, 0xcf, 0xbf, 0x18, 0x91, 0x9e, 0x37, 0xb1, 0xd9, 0x71, 0xf2, 0xc0, 0xff, 0xf2, 0x87,
+  0xcf, 0xe7, 0x8f, 0x0e, 0xf8, 0xf9, 0xec, 0x98, 0xaa, 0x71, 0x6e, 0x9e, 0x1e, 0x03, 0x33, 0x57,
+  0x3b, 0xba, 0xa3, 0xa6, 0x99, 0x99, 0x3f, 0x7c, 0x28, 0x72, 0xeb, 0xb6, 0xff, 0xe1, 0xed, 0x70,
+  0xa8, 0x06, 0xe6, 0xc3, 0x87, 0xd2, 0x35, 0xab, 0x38, 0x4a, 0xf3, 0x0f, 0x1d, 0x3d, 0x0a, 0x73,
+  0x33, 0x04, 0xe0, 0x95, 0x6b, 0xe4, 0xce, 0x83, 0x61, 0x96, 0xae, 0x6e, 0xde, 0x9e, 0x1e, 0x6e,
+  0xdc, 0xd0, 0xcd, 0x5d, 0xd5, 0xbf, 0xcd, 0x74, 0xd5, 0x37, 0x1f, 0x90, 0x97, 0xb8, 0x72, 0x37,
+  0xf7, 0xcd, 0x2f, 0x1b, 0x33, 0x0c, 0xdd, 0xac, 0x23, 0x98, 0x79, 0xea, 0x9a, 0xa5, 0x99, 0x76,
+  0x84, 0x48, 0x8b, 0xf2, 0xce, 0x6d, 0x87, 0xb7, 0x8b, 0xc6, 0x0c, 0x3b, 0x9c, 0xd9, 0x61, 0x23,
+  0x35, 0xb4, 0x3b, 0x73, 0x47, 0x75, 0x41, 0x37, 0x3b, 0x5a, 0x6c, 0x37, 0x9f, 0xa1, 0xf3, 0xe4,
+  0x67, 0x64, 0x59, 0xde, 0x3c, 0x3e, 0x6b, 0x91, 0xd1, 0x7c, 0xb5, 0x00, 0x4f, 0xb7, 0x96, 0x1a,
+  0xb8, 0x7e, 0x73, 0x4f, 0xa5, 0x80, 0x83, 0x9b, 0x0e, 0x6b, 0xfa, 0xa5, 0x99, 0xbb, 0xba, 0x7a,
+  0x93, 0xa9, 0x61, 0x76, 0x9b, 0x99, 0xa9, 0x6b, 0x7d, 0xea, 0x68, 0xaa, 0x7e, 0xb0, 0xd3, 0xa8,
+  0x08, 0x8d, 0xfb, 0x3f, 0x22, 0xfd, 0xf6, 0xf7, 0x13, 0x10, 0xc8, 0x8f, 0xd2, 0xfb, 0x3f, 0x9a,
+  0x56, 0xfb, 0xfb, 0xa9, 0x73, 0xc2, 0x95, 0xb9, 0x47, 0xf3, 0x1e, 0xe9, 0xc5, 0xf5, 0xb7, 0x13,
+  0x11, 0x07, 0xfd, 0xfa, 0xa2, 0xbb, 0x0f, 0xba, 0x33, 0x53, 0xcf, 0xdd, 0x28, 0xbc, 0x0b, 0x54,
+  0x37, 0xfc, 0x6a, 0xb8, 0x59, 0xec, 0xab, 0xcd, 0xbd, 0xe5, 0x9b, 0xf5, 0xb7, 0x3f, 0x06, 0x66,
+  0x58, 0xdc, 0xbc, 0x1a, 0x6f, 0xfb, 0x6f, 0x0d, 0x37, 0x3d, 0xf7, 0xdd, 0x03, 0x82, 0x45, 0x10,
+  0x9e, 0x31, 0x9f, 0xa0, 0x9f, 0x10, 0x84, 0x51, 0x68, 0x7e, 0x3a, 0x41, 0x57, 0xa9, 0x1a, 0x83,
+  0xc7, 0xf6, 0xe3, 0x53, 0xe0, 0x86, 0x67, 0xfd, 0xde, 0x63, 0x38, 0x1c, 0xd7, 0x9f, 0x5e, 0x0a,
+  0x81, 0xf5, 0xda, 0xdf, 0x4f, 0xb1, 0x6a, 0x18, 0x6e, 0x68, 0xdf, 0xf7, 0xdb, 0xe1, 0x28, 0x35,
+  0xcc, 0xf4, 0x36, 0x55, 0x0d, 0xb7, 0xc8, 0xee, 0x71, 0xd0, 0x13, 0xa8, 0xa9, 0x0d, 0x70, 0xe4,
+  0x51, 0x7c, 0x7f, 0x8b, 0xc0, 0xcf, 0x1d, 0xa9, 0x6b, 0x3b, 0xf9, 0x7d, 0xdb, 0x73, 0x61, 0xe6,
+  0x62, 0xdb, 0x57, 0x02, 0xbd, 0xe0, 0xe7, 0xc4, 0x8d, 0xea, 0xbb, 0x76, 0x78, 0xeb, 0xe6, 0x66,
+  0x90, 0xdd, 0x67, 0x79, 0x6a, 0xe6, 0xba, 0x73, 0x9e, 0x6d, 0xb9, 0x76, 0x91, 0x9a, 0x5f, 0x1f,
+  0x59, 0x81, 0x2f, 0x54, 0x40, 0xe3, 0xb6, 0x32, 0xb5, 0x83, 0x9b, 0xdf, 0x5e, 0xc8, 0x6a, 0xa6,
+  0x15, 0xa5, 0xe6, 0x13, 0xc0, 0xad, 0xe6, 0x47, 0xfa, 0xe1, 0x36, 0xcb, 0xd5, 0x34, 0x7f, 0x0f,
+  0xac, 0x5a, 0xb9, 0x99, 0xbe, 0x85, 0x35, 0x81, 0xe8, 0xef, 0x20, 0x1f, 0x11, 0x5c, 0x1e, 0xdd,
+  0xd0, 0x77, 0x43, 0xf3, 0x47, 0x68, 0xcf, 0x18, 0x5e, 0x83, 0x9e, 0xfa, 0x5e, 0xca, 0xd2, 0x71,
+  0x03, 0xfb, 0x49, 0x17, 0x27, 0xca, 0x9f, 0xce, 0x76, 0x40, 0x60, 0xf8, 0x3f, 0x3e, 0x39, 0xe6,
+  0x49, 0x7d, 0x6a, 0x91, 0x47, 0xbf, 0xad, 0xf3, 0xfe, 0xa3, 0x7e, 0xff, 0x77, 0x60, 0x1a, 0xae,
+  0xda, 0xb9, 0x7a, 0x36, 0x68, 0x1f, 0x06, 0xca, 0xbf, 0xee, 0xa8, 0xa1, 0xd1, 0xb9, 0x8a, 0x40,
+  0x48, 0x84, 0xb9, 0x7a, 0x72, 0x11, 0x1f, 0xf4, 0x80, 0x20, 0x8a, 0xcd, 0xeb, 0xaf, 0x3f, 0x33,
+  0xca, 0xc5, 0x49, 0x7e, 0x62, 0x96, 0xef, 0x88, 0x12, 0xa8, 0xf5, 0xed, 0x0b, 0x71, 0xda, 0xc7,
+  0x8b, 0x48, 0x20, 0x7a, 0xf5, 0x2b, 0xd0, 0x59, 0x3a, 0x20, 0x04, 0x5b, 0x97, 0xbb, 0xbe, 0xc8,
+  0x7d, 0x92, 0xf5, 0x85, 0xdc, 0xff, 0x5f, 0x19, 0xfe, 0x2c, 0xcc, 0xe9, 0xcf, 0x25, 0x7a, 0x3b,
+  0x7f, 0xd4, 0x8a, 0x3c, 0x8f, 0xc2, 0xec, 0x27, 0xba, 0xf7, 0x8a, 0x2c, 0x77, 0xad, 0xe6, 0xf6,
+  0x62, 0xa9, 0xfb, 0x2c, 0x56, 0x41, 0x4a, 0xd4, 0xcc, 0xbc, 0x32, 0xcd, 0x4b, 0x9c, 0x9f, 0x7f,
+  0xfe, 0x18, 0xaa, 0x25, 0x70, 0x09, 0xdb, 0xf6, 0xcd, 0xaf, 0x7a, 0x91, 0x66, 0x20, 0xef, 0xc4,
+  0x91, 0x0b, 0x26, 0xa5, 0x9f, 0x5e, 0xd9, 0xe6, 0x07, 0x73, 0x6e, 0x75, 0xed, 0x6b, 0x54, 0xe4,
+  0x2d, 0xcf, 0x40, 0x86, 0x08, 0x50, 0x71, 0xf3, 0x06, 0xb4, 0xce, 0xc6, 0x81, 0x1f, 0x2d, 0x03,
+  0xff, 0x78, 0xfa, 0xbd, 0xee, 0x98, 0xfa, 0xc1, 0x34, 0xba, 0xaf, 0xf3, 0xce, 0x29, 0x71, 0xbd,
+  0x98, 0x74, 0xe7, 0x86, 0x71, 0x91, 0xdf, 0xb6, 0x49, 0x26, 0xfe, 0x89, 0xec, 0x27, 0x05, 0x5e,
+  0x08, 0xa3, 0xe8, 0x93, 0xe3, 0xdf, 0x13, 0x71, 0xdd, 0x81, 0x7f, 0x84, 0xf3, 0x8b, 0xaf, 0x6a,
+  0xa6, 0xff, 0x84, 0xf9, 0x62, 0x86, 0xb3, 0x5b, 0x5e, 0xdc, 0xe8, 0x45, 0x72, 0x7a, 0x91, 0x00,
+  0x71, 0xf2, 0x3f, 0x7e, 0x84, 0xb3, 0x73, 0x6a, 0xdf, 0xfc, 0x68, 0x34, 0x33, 0x7d, 0x60, 0xd4,
+  0x73, 0x2a, 0x06, 0x3d, 0xd5, 0x3d, 0xf2, 0xed, 0x2e, 0x05, 0x2b, 0x8d, 0x09, 0x1c, 0xa3, 0xbe,
+  0x79, 0x6c, 0xbe, 0x48, 0xe6, 0xdf, 0x63, 0xea, 0x1e, 0xee, 0x10, 0xf1, 0x93, 0xa6, 0xce, 0xce,
+  0xf1, 0x2e, 0xaa, 0x1e, 0xc5, 0x7f, 0x9a, 0xd4, 0xaa, 0x02, 0x41, 0x9f, 0x32, 0x33, 0x30, 0xd4,
+  0x2b, 0xa5, 0xb5, 0x39, 0xfb, 0x8d, 0x33, 0x5c, 0x96, 0x24, 0xcb, 0xb2, 0x5e, 0x25, 0x7b, 0x18,
+  0x23, 0xfa, 0x70, 0xef, 0x4d, 0xb2, 0x69, 0x29, 0xbd, 0x5e, 0xb3, 0x3e, 0x3d, 0xfb, 0xc8, 0x53,
+  0x7c, 0xc7, 0xaf, 0xec, 0xdb, 0xb9, 0x3b, 0xf3, 0x8e, 0x7e, 0x7d, 0x46, 0x7f, 0x7b, 0x21, 0x0a,
+  0xc3, 0x7d, 0x5d, 0x53, 0x1f, 0x67, 0x22, 0x3f, 0x98, 0x89, 0x7d, 0x67, 0xa6, 0x85, 0xe3, 0x18,
+  0x58, 0x8b, 0x7e, 0x42, 0x13, 0xff, 0xce, 0x4c, 0x93, 0x6c, 0x7f, 0x3f, 0x3d, 0x71, 0xf0, 0xc4,
+  0x38, 0xfa, 0x03, 0x24, 0xc4, 0x77, 0x90, 0x10, 0x04, 0xf1, 0x33, 0xda, 0xbd, 0xaf, 0xa5, 0x9b,
+  0xb9, 0x9a, 0xeb, 0xb7, 0x71, 0xe3, 0xb8, 0x86, 0x61, 0x86, 0xaf, 0xa6, 0x9c, 0xa1, 0xee, 0x9d,
+  0x08, 0x94, 0x26, 0x5f, 0x5f, 0x6a, 0xde, 0xb2, 0xf0, 0x01, 0x6e, 0x3c, 0x8e, 0xab, 0x20, 0x3b,
+  0x94, 0xe6, 0x6b, 0x00, 0x14, 0xd1, 0x51, 0xe4, 0xb5, 0x67, 0xdc, 0x01, 0xcf, 0x50, 0x35, 0xdf,
+  0x34, 0x1e, 0x63, 0xdd, 0x30, 0x2d, 0xb5, 0xf0, 0xf3, 0x57, 0x36, 0x55, 0xe1, 0xf6, 0xf7, 0x25,
+  0xb3, 0xa7, 0xe6, 0xc9, 0x75, 0xff, 0xb3, 0xad, 0xe2, 0x1e, 0x4e, 0xae, 0xf9, 0x5f, 0x5f, 0x1f,
+  0xf3, 0x98, 0x1a, 0xc7, 0xa6, 0x0a, 0xfa, 0x74, 0xf3, 0x5c, 0x2e, 0xbc, 0x5f, 0x91, 0x4e, 0x61,
+  0xf8, 0x9d, 0x22, 0xe1, 0x8d, 0x93, 0x3d, 0x66, 0xe9, 0x6f, 0xdf, 0x27, 0x78, 0x6f, 0x45, 0x7a,
+  0x91, 0x3d, 0xe7, 0x9b, 0x6f, 0xef, 0x21, 0xee, 0x1f, 0x79, 0xca, 0x7c, 0xf7, 0xe4, 0x91, 0x45,
+  0x18, 0xb6, 0x02, 0xdf, 0xe6, 0x29, 0xa0, 0xfe, 0xf5, 0x3b, 0x9c, 0xbd, 0x77, 0xf5, 0x97, 0x7c,
+  0x5e, 0x4a, 0xb0, 0xd7, 0xfe, 0x0d, 0x3f, 0x85, 0x4d, 0x27, 0x8b, 0x00, 0x9d, 0xce, 0x05, 0xec,
+  0x47, 0x6c, 0xbf, 0x65, 0x2a, 0x77, 0x8a, 0x40, 0xfb, 0x7a, 0xc1, 0x81, 0x80, 0x50, 0x3c, 0x63,
+  0x49, 0x6d, 0x4d, 0xbd, 0x82, 0x6f, 0xe0, 0x1b, 0x0c, 0xfc, 0xb9, 0x7e, 0xa5, 0xba, 0x33, 0xdf,
+  0x28, 0xfa, 0xae, 0x96, 0x22, 0xde, 0x56, 0x5f, 0x96, 0x85, 0xc1, 0x18, 0xfe, 0x56, 0xa4, 0x1f,
+  0x59, 0xea, 0x55, 0x19, 0x86, 0xdc, 0x3d, 0x65, 0x92, 0x1f, 0xa8, 0xfe, 0x67, 0xea, 0x7d, 0xaf,
+  0xb9, 0x1f, 0xab, 0x24, 0x88, 0x8e, 0xb7, 0xe7, 0x14, 0xf7, 0x3f, 0x6b, 0x9a, 0x17, 0x7c, 0xfc,
+  0xbb, 0xcd, 0xf2, 0x1b, 0x4c, 0x65, 0xff, 0xa4, 0x56, 0xe0, 0xce, 0xa3, 0x06, 0x2e, 0x39, 0x08,
+  0xa0, 0x09, 0xc1, 0xe2, 0x9f, 0x82, 0x22, 0xe0, 0xd3, 0xbb, 0x9e, 0xdf, 0x64, 0xc0, 0x72, 0x7d,
+  0xff, 0xd6, 0x8f, 0xaa, 0x37, 0x79, 0xe7, 0x95, 0xda, 0xdf, 0xaa, 0xf9, 0xad, 0x35, 0x7e, 0x4e,
+  0xa0, 0x00, 0x1e, 0xf9, 0xaf, 0x22, 0xf0, 0xef, 0x8f, 0xb3, 0x67, 0x1b, 0xfd, 0x2c, 0x8e, 0x7e,
+  0xa6, 0xe0, 0xbf, 0x77, 0xfe, 0x7b, 0xfd, 0x9d, 0x53, 0xeb, 0x79, 0xfe, 0x5d, 0x56, 0xb9, 0xa0,
+  0xec, 0x7e, 0x53, 0x10, 0xc4, 0x51, 0xe6, 0x9e, 0x6a, 0xfa, 0xd4, 0xf4, 0xd5, 0x76, 0xdd, 0x78,
+  0x5f, 0x32, 0xbd, 0x59, 0xbe, 0x5f, 0x0c, 0xbd, 0x42, 0x7c, 0x66, 0xf0, 0x1f, 0xa8, 0x00, 0xef,
+  0xce, 0x89, 0xe3, 0xe2, 0xd7, 0x27, 0xad, 0xbe, 0x5a, 0x22, 0x5e, 0x29, 0x1d, 0xfd, 0x4d, 0x5f,
+  0xbf, 0x38, 0xb8, 0x9d, 0x9a, 0xcd, 0xb7, 0x0b, 0xda, 0x9b, 0xcb, 0xe7, 0xfd, 0xb9, 0xac, 0xff,
+  0x7e, 0xe1, 0x74, 0xf2, 0xff, 0xb3, 0xfc, 0x77, 0x78, 0xf6, 0x8a, 0xad, 0xc7, 0x79, 0xef, 0x15,
+  0xf4, 0x58, 0x47, 0x7f, 0xf8, 0xf0, 0xce, 0x31, 0x9e, 0x22, 0xf3, 0xa4, 0xa9, 0x4b, 0xc0, 0xb6,
+  0x4d, 0xdf, 0xb4, 0xf2, 0xd3, 0xc6, 0xab, 0x4d, 0xaf, 0xd8, 0x2b, 0xff, 0xb9, 0x7d, 0x2e, 0xa7,
+  0x5e, 0xd4, 0xf8, 0x27, 0x65, 0x3e, 0xd5, 0xc3, 0x8f, 0xaa, 0xfa, 0xde, 0xac, 0xd6, 0xf7, 0xbe,
+  0xfd, 0x78, 0xce, 0xa3, 0x1c, 0x8f, 0xd9, 0xfa, 0x24, 0x32, 0xe8, 0x09, 0xce, 0xc1, 0x0f, 0x64,
+  0x32, 0x95, 0x2b, 0xb4, 0xd7, 0xee, 0xa2, 0x7e, 0x3c, 0xf4, 0xed, 0xb2, 0xef, 0x38, 0x15, 0xa9,
+  0xef, 0x82, 0xe8, 0x71, 0x05, 0x7f, 0xe1, 0x28, 0xf8, 0x1b, 0x63, 0x3e, 0x7b, 0xc5, 0xbb, 0xf2,
+  0xf0, 0xa2, 0x75, 0x37, 0x50, 0x41, 0xde, 0x6d, 0x75, 0xab, 0x02, 0xc0, 0xf4, 0x59, 0xef, 0xaa,
+  0x06, 0xa8, 0x14, 0xb9, 0x79, 0x52, 0xdd, 0xc9, 0x4b, 0x4e, 0xca, 0x24, 0x4e, 0x9b, 0xc2, 0x17,
+  0x2f, 0x0a, 0x6e, 0xdb, 0x9e, 0xef, 0x88, 0x70, 0xd5, 0x0e, 0xdc, 0xb4, 0x7f, 0xae, 0x5f, 0x94,
+  0xea, 0x48, 0xef, 0xa9, 0x08, 0xbb, 0x6b, 0x89, 0xa6, 0x91, 0xff, 0x3d, 0xe2, 0x4f, 0x46, 0x6f,
+  0x89, 0xe3, 0xf0, 0xef, 0xa2, 0xfe, 0xca, 0xbd, 0x7e, 0x2a, 0x29, 0x49, 0xbc, 0x78, 0x15, 0x72,
+  0x76, 0x1f, 0xe2, 0xef, 0xa4, 0xa0, 0xfb, 0x51, 0x66, 0x7e, 0x07, 0xed, 0x99, 0x53, 0xe2, 0xe2,
+  0x85, 0xc4, 0xf7, 0xb3, 0xd8, 0x0b, 0xa7, 0x7d, 0xe9, 0xcb, 0xaf, 0xcd, 0x76, 0xaa, 0x47, 0x5f,
+  0xee, 0x03, 0x72, 0xb3, 0x06, 0x15, 0x45, 0xbb, 0xc9, 0xbf, 0xd7, 0xcd, 0x53, 0x70, 0xbe, 0x4c,
+  0x23, 0xc8, 0xfb, 0x4d, 0xc4, 0x85, 0xd5, 0x73, 0x95, 0xfb, 0xea, 0x0d, 0xd3, 0x65, 0x24, 0x8d,
+  0x72, 0x20, 0xdc, 0x00, 0xfe, 0x8e, 0xe3, 0x9e, 0x87, 0xae, 0x50, 0x12, 0x36, 0x4c, 0xfb, 0xfa,
+  0xd3, 0x69, 0xd9, 0xfe, 0xf1, 0x68, 0xf4, 0x5b, 0x33, 0xb3, 0x1f, 0x0f, 0xfe, 0x68, 0xe0, 0x55,
+  0xe5, 0xfe, 0xb6, 0x30, 0xfe, 0x5f, 0x9d, 0xaf, 0x97, 0xc2, 0x15, 0x2c, 0xbe, 0x9d, 0x4b, 0xa4,
+  0xb4, 0xcd, 0xc7, 0xdd, 0x16, 0x68, 0x5f, 0xde, 0x66, 0xf9, 0x91, 0x1d, 0x75, 0xbe, 0x3e, 0x21,
+  0x78, 0x54, 0x41, 0xe7, 0x55, 0x82, 0x7a, 0x1a, 0x7e, 0xc4, 0xda, 0x6e, 0x39, 0x3e, 0x3d, 0x93,
+  0xb5, 0xfc, 0x48, 0xcd, 0xef, 0x3b, 0xad, 0x7f, 0x3c, 0xc3, 0x5e, 0xb4, 0xde, 0x21, 0x5b, 0xd8,
+  0xa7, 0xde, 0xb3, 0x61, 0x3b, 0xa7, 0x97, 0x24, 0xcf, 0x08, 0x5e, 0xdb, 0x15, 0x70, 0xf7, 0x34,
+  0xf2, 0xde, 0x7f, 0x9e, 0x86, 0x5a, 0xf7, 0x41, 0x88, 0x97, 0xc8, 0x4f, 0x0e, 0xfa, 0xba, 0xab,
+  0xd3, 0xf9, 0xf6, 0x87, 0x67, 0x49, 0xd1, 0xce, 0xd7, 0xce, 0xdf, 0x29, 0xcc, 0xc9, 0x4d, 0xff,
+  0x47, 0xa5, 0x39, 0x71, 0xd0, 0xf9, 0x91, 0x3c, 0x9d, 0xce, 0x67, 0xe8, 0xf2, 0x8a, 0xf7, 0xfc,
+  0xda, 0x1a, 0x7a, 0x7e, 0x6f, 0xfd, 0xb9, 0x7d, 0xe1, 0xfb, 0xe5, 0x39, 0x8d, 0x7f, 0xd6, 0xd2,
+  0x2f, 0xaf, 0x1b, 0xe7, 0x37, 0xc4, 0x97, 0x37, 0x38, 0xba, 0xaf, 0x66, 0xd9, 0xc3, 0x87, 0xf6,
+  0x35, 0xec, 0xcb, 0xb7, 0xd1, 0xe7, 0x57, 0x56, 0x2f, 0x3a, 0x0c, 0xb7, 0xec, 0xb8, 0xc6, 0xc3,
+  0x87, 0xf6, 0xd5, 0x99, 0x1a, 0x3c, 0xe7, 0x8e, 0x0f, 0x8f, 0x18, 0xde, 0x64, 0xcf, 0x0f, 0x6f,
+  0xe6, 0x5e, 0xa0, 0x4e, 0x89, 0xe1, 0xc3, 0x09, 0xd3, 0xa9, 0x79, 0x7b, 0xc6, 0xf7, 0xe1, 0xcb,
+  0xff, 0xfd, 0x3f, 0x9f, 0x21, 0x00, 0xf7, 0x62, 0x96, 0x1b, 0xd8, 0x2f, 0x28, 0x7e, 0xe8, 0x64,
+  0xa9, 0xfe, 0xf0, 0xe1, 0x89, 0xdc, 0x63, 0x70, 0xbe, 0xa4, 0xf3, 0x8c, 0xe0, 0x33, 0xf4, 0x52,
+  0x80, 0xf7, 0x2a, 0x78, 0x19, 0x40, 0xaf, 0x1f, 0x9e, 0x14, 0xd3, 0x92, 0xbe, 0xbc, 0xdd, 0x7a,
+  0x41, 0xe3, 0x02, 0xf4, 0xcb, 0xed, 0x2d, 0x80, 0xd4, 0x53, 0x37, 0xce, 0xcf, 0x7c, 0x39, 0x79,
+  0x1e, 0x67, 0xf7, 0x10, 0xa4, 0x1b, 0xa1, 0x97, 0xb5, 0xe9, 0xaf, 0x30, 0x2c, 0x1f, 0x54, 0xb5,
+  0x20, 0xb3, 0x07, 0x90, 0xea, 0xa9, 0x35, 0xe4, 0xbb, 0x5a, 0x06, 0xa5, 0xb5, 0x97, 0x41, 0xf8,
+  0x1d, 0x7c, 0xd7, 0x03, 0xcd, 0xbb, 0xdc, 0xcc, 0x72, 0x10, 0x91, 0x77, 0x1e, 0xa0, 0x00, 0x0c,
+  0x7a, 0x42, 0xf7, 0xa5, 0x73, 0x7b, 0xfb, 0x96, 0xdc, 0x0b, 0xf5, 0x5f, 0x16, 0x8a, 0xec, 0x49,
+  0x0f, 0xef, 0x56, 0x8e, 0x0f, 0xef, 0x67, 0xbf, 0x11, 0xf1, 0x82, 0xd2, 0x41, 0x3a, 0xa7, 0x74,
+  0xd9, 0x01, 0x48, 0x4e, 0x09, 0xf3, 0xc3, 0x97, 0xcd, 0x98, 0xe7, 0xa7, 0x62, 0x47, 0x18, 0x6f,
+  0x84, 0xe9, 0x58, 0x1a, 0x0b, 0x1d, 0x61, 0x39, 0x5c, 0x6e, 0xda, 0xff, 0x7d, 0xe0, 0xd8, 0x39,
+  0x70, 0x32, 0xe4, 0x7b, 0xb8, 0x3f, 0xe7, 0xed, 0x9e, 0xeb, 0xfb, 0x23, 0xe9, 0x97, 0xcf, 0x6a,
+  0xc7, 0x49, 0x4d, 0xeb, 0xe1, 0xc3, 0x1f, 0x81, 0x8c, 0x8f, 0x26, 0x6d, 0xc3, 0xf1, 0xc3, 0x6b,
+  0xc5, 0x15, 0x31, 0x08, 0x3d, 0xe3, 0xae, 0x72, 0x0f, 0xee, 0xe9, 0x25, 0xf0, 0x5d, 0x94, 0xda,
+  0x50, 0xfb, 0x14, 0xb7, 0x4f, 0x50, 0xe9, 0x42, 0x3a, 0x50, 0x2e, 0xc4, 0x81, 0x99, 0xb7, 0x8e,
+  0x1e, 0x14, 0xf9, 0x5d, 0x56, 0xda, 0xad, 0xda, 0xd4, 0xef, 0x51, 0x3e, 0x51, 0xff, 0x11, 0x65,
+  0xf4, 0x42, 0xda, 0x50, 0x73, 0xf5, 0xfe, 0xe4, 0xb6, 0x90, 0x17, 0x9b, 0x36, 0x58, 0x8a, 0x32,
+  0xb3, 0x87, 0xdf, 0x40, 0x03, 0x0f, 0xc2, 0x29, 0x6a, 0x2d, 0x1e, 0xf6, 0x33, 0xc1, 0xa6, 0x86,
+  0xd4, 0x9a, 0x02, 0x4f, 0xe0, 0x93, 0xa2, 0x21, 0xb4, 0x1a, 0x8d, 0x29, 0xea, 0x30, 0x19, 0xd6,
+  0xd3, 0xf5, 0xd8, 0xd9, 0x8a, 0xe3, 0x7a, 0x2a, 0x31, 0xc2, 0x56, 0x61, 0xea, 0xad, 0xc4, 0xd4,
+  0x7a, 0xdb, 0x96, 0x27, 0xb5, 0xbe, 0x63, 0x1c, 0xd0, 0xe7, 0x80, 0x3e, 0x47, 0xdf, 0xb1, 0xa2,
+  0x6d, 0x4f, 0x86, 0x91, 0xcf, 0x0a, 0x5b, 0x69, 0xb6, 0x99, 0x3a, 0x33, 0xf1, 0x90, 0x72, 0x2e,
+  0x5e, 0x30, 0x75, 0xff, 0xb8, 0xa4, 0xb7, 0x39, 0xdf, 0xd8, 0x39, 0xe7, 0xc2, 0xc3, 0x91, 0x1d,
+  0xcd, 0x69, 0x1b, 0x5e, 0x4e, 0x6a, 0x6a, 0x3d, 0x71, 0x61, 0x7f, 0x3a, 0xda, 0xe6, 0x9c, 0x08,
+  0xff, 0xbe, 0x7f, 0x16, 0x44, 0x51, 0xc3, 0xf1, 0x94, 0x5a, 0x8e, 0x29, 0x7c, 0xbd, 0x18, 0x4e,
+  0x6d, 0x6a, 0x34, 0x5e, 0x8f, 0xe9, 0xf1, 0x9a, 0x85, 0x6a, 0x8a, 0xd2, 0x29, 0x0a, 0x88, 0x63,
+  0x2f, 0x80, 0x8c, 0xe0, 0xf3, 0xc5, 0xcf, 0xd0, 0xd6, 0x87, 0x43, 0x6a, 0x4b, 0x53, 0xb6, 0x07,
+  0xe0, 0x86, 0x13, 0x30, 0x3a, 0xa4, 0xaa, 0x29, 0x3d, 0xa4, 0x76, 0xcc, 0x88, 0xd2, 0xa7, 0x54,
+  0x75, 0x82, 0x07, 0x3a, 0x01, 0x7d, 0xc3, 0x31, 0x33, 0x76, 0xc7, 0x93, 0xc5, 0x96, 0x11, 0x86,
+  0x35, 0x0f, 0x24, 0x9e, 0x08, 0x53, 0x6f, 0xee, 0x64, 0xfa, 0xd8, 0x5b, 0xfb, 0x33, 0x57, 0x4f,
+  0xe7, 0x47, 0x78, 0xb3, 0x80, 0x75, 0x4c, 0x14, 0x71, 0x8b, 0xda, 0xce, 0x68, 0x89, 0xde, 0xe2,
+  0xdc, 0xa8, 0x2f, 0xc8, 0x9b, 0x28, 0x5a, 0xb5, 0x7c, 0xa8, 0x27, 0xfa, 0xd5, 0xf8, 0xac, 0xeb,
+  0x97, 0x3f, 0xd5, 0x9a, 0xa1, 0xec, 0xf1, 0x04, 0xea, 0xaf, 0xa9, 0xc5, 0xb0, 0xe5, 0x75, 0x7a,
+  0xe6, 0xa3, 0xda, 0x52, 0x17, 0x1e, 0xc0, 0xcf, 0x78, 0x44, 0xd5, 0xe3, 0x31, 0xe0, 0xa1, 0x5e,
+  0x0b, 0xbc, 0xb0, 0x13, 0x67, 0xb5, 0xbd, 0x9f, 0x38, 0x99, 0x45, 0x35, 0x0b, 0x98, 0x1b, 0xc2,
+  0xe2, 0xca, 0xe9, 0xaf, 0x15, 0x08, 0xb5, 0xa9, 0xc5, 0x69, 0x8e, 0xd3, 0xca, 0x4f, 0x41, 0x14,
+  0x57, 0x0b, 0xe3, 0xf5, 0x70, 0x2c, 0x50, 0x63, 0x61, 0x4c, 0x09, 0xbb, 0x99, 0xec, 0x28, 0xbb,
+  0x43, 0xc3, 0x6d, 0x4c, 0xf2, 0xb0, 0xf2, 0x1a, 0x25, 0x71, 0x89, 0xd5, 0x68, 0xb9, 0x3f, 0x7a,
+  0xc3, 0xfd, 0xe1, 0x68, 0xc9, 0xde, 0x16, 0x0f, 0x27, 0x47, 0x02, 0x39, 0x36, 0x5a, 0x52, 0x0c,
+  0x25, 0xdc, 0x9b, 0xcd, 0x4a, 0xde, 0x69, 0x26, 0x61, 0x78, 0x54, 0xbc, 0xcd, 0xf6, 0x18, 0xd3,
+  0xfb, 0xa8, 0x24, 0xed, 0x54, 0x37, 0x38, 0x67, 0x1f, 0xf4, 0x27, 0xd6, 0x4a, 0xd9, 0x9b, 0x68,
+  0xce, 0x6e, 0xc2, 0x9a, 0xa8, 0x07, 0x52, 0xc4, 0x5a, 0x49, 0x3e, 0xdf, 0x8c, 0x09, 0xc5, 0x5a,
+  0x4d, 0xc9, 0x74, 0xa8, 0xc6, 0x4c, 0x4e, 0x97, 0x82, 0x1c, 0xc1, 0x48, 0xdd, 0x9b, 0xc6, 0x1b,
+  0x84, 0xc9, 0x8a, 0xcc, 0x23, 0x8d, 0xed, 0x6a, 0x39, 0x20, 0x4b, 0xdc, 0x2d, 0x93, 0x55, 0xca,
+  0x9a, 0x69, 0xb8, 0x32, 0xf4, 0x14, 0xad, 0x8a, 0x43, 0x0f, 0x19, 0x78, 0xbd, 0x08, 0x59, 0x11,
+  0xf3, 0x6d, 0xb6, 0xa3, 0x38, 0xe0, 0x8c, 0xd9, 0x56, 0x42, 0x60, 0x15, 0xcb, 0xb7, 0x5b, 0x54,
+  0xe6, 0x57, 0x31, 0x21, 0xa7, 0x3a, 0xb1, 0x1a, 0x8e, 0xd9, 0xe2, 0xa0, 0x95, 0x1c, 0x3a, 0x18,
+  0x54, 0x05, 0xe9, 0x2c, 0xa7, 0xc6, 0x6e, 0xe1, 0x79, 0xbd, 0x35, 0xde, 0xaf, 0x8f, 0x24, 0x02,
+  0xcf, 0xf0, 0x49, 0xc9, 0x84, 0x23, 0x7c, 0x2b, 0x27, 0x3b, 0x6c, 0x2d, 0xca, 0x43, 0x64, 0x58,
+  0xd0, 0xa8, 0xce, 0x4c, 0x62, 0xa1, 0xdc, 0x78, 0x1e, 0x4d, 0x8e, 0x0f, 0xd1, 0x06, 0xce, 0xf2,
+  0xae, 0x5e, 0x93, 0xa1, 0x98, 0xe8, 0x82, 0x6f, 0x1b, 0xbe, 0x4e, 0xe1, 0x3a, 0x5d, 0x14, 0x2b,
+  0x1a, 0x54, 0xa1, 0x61, 0x9d, 0xf0, 0xa8, 0x97, 0xe6, 0xe4, 0x40, 0x20, 0x52, 0x32, 0x43, 0x13,
+  0x97, 0xb4, 0x8a, 0x62, 0xe4, 0x1d, 0x60, 0xa0, 0x77, 0x98, 0xac, 0xca, 0x79, 0x82, 0xcb, 0x9c,
+  0x8a, 0xb8, 0xe2, 0x4a, 0x4b, 0xd3, 0xb9, 0x1c, 0x0b, 0xe6, 0x2e, 0x0b, 0x16, 0x7a, 0xa4, 0x73,
+  0xb6, 0xed, 0x05, 0xbc, 0xd4, 0x53, 0xb6, 0x9c, 0x13, 0xe8, 0x15, 0xa6, 0x8a, 0x34, 0x6a, 0xb1,
+  0x41, 0x51, 0x0b, 0x38, 0x56, 0x1d, 0x98, 0x32, 0xa5, 0x71, 0x47, 0x97, 0x55, 0x75, 0x6b, 0x86,
+  0x33, 0x4e, 0x4a, 0x77, 0x1b, 0xdc, 0xaf, 0x8e, 0x45, 0x54, 0x3a, 0x69, 0x25, 0xe8, 0xaa, 0x63,
+  0xa9, 0x29, 0x03, 0x4f, 0xdd, 0x29, 0xe5, 0x4e, 0xed, 0xd1, 0xd4, 0xa5, 0x5e, 0x34, 0xb9, 0xe1,
+  0x7c, 0x9c, 0xda, 0xf8, 0xd1, 0x95, 0xbb, 0xbc, 0xd3, 0x85, 0x2d, 0x9b, 0xc1, 0x94, 0xe1, 0xd1,
+  0x77, 0xc6, 0x52, 0x9e, 0xa4, 0x5e, 0xb1, 0x0f, 0x99, 0x85, 0x8c, 0x65, 0xde, 0xca, 0x24, 0x71,
+  0xba, 0x8f, 0xd4, 0x23, 0xc9, 0xdf, 0xc9, 0xa9, 0x22, 0x4d, 0xf2, 0x9d, 0xe0, 0xa0, 0x68, 0x93,
+  0x9b, 0x7b, 0x36, 0xdd, 0xac, 0x27, 0x42, 0xa5, 0x62, 0xa6, 0xb5, 0x3f, 0xce, 0x7d, 0x69, 0x26,
+  0xe6, 0xae, 0xe6, 0x53, 0xe4, 0x11, 0xe8, 0x2c, 0xc1, 0x39, 0x71, 0x3f, 0xd9, 0x7b, 0xbd, 0x63,
+  0x6e, 0xe2, 0x3a, 0x55, 0x84, 0xfb, 0x7d, 0x37, 0xca, 0xb1, 0xa6, 0x2a, 0x5c, 0x5e, 0x11, 0x55,
+  0xab, 0xc2, 0xc9, 0x10, 0xd9, 0xb3, 0x0b, 0x33, 0xd6, 0xd3, 0x0c, 0xc7, 0x96, 0xd8, 0xa0, 0x47,
+  0xa8, 0xfe, 0x60, 0xbf, 0x71, 0x05, 0x47, 0x3b, 0x4e, 0x42, 0xab, 0x9a, 0xbb, 0x34, 0xca, 0xc4,
+  0xd3, 0x65, 0x7f, 0x52, 0xf7, 0x19, 0x15, 0xce, 0x83, 0xde, 0x12, 0x6b, 0xe6, 0x72, 0x9e, 0xa0,
+  0x1b, 0x8c, 0x8b, 0x20, 0xb0, 0x52, 0xec, 0x6b, 0x9c, 0x0e, 0x3d, 0x77, 0x3d, 0x5a, 0x51, 0x01,
+  0x54, 0x8e, 0x0e, 0x73, 0x67, 0x31, 0xae, 0x77, 0xf8, 0x52, 0x03, 0x6d, 0x66, 0xe5, 0x1d, 0xf6,
+  0x6c, 0xac, 0xa8, 0x20, 0x37, 0x0d, 0x5c, 0x07, 0xe1, 0x17, 0x39, 0x4a, 0x70, 0x4b, 0xf1, 0x18,
+  0x0d, 0x84, 0xe1, 0x1a, 0x15, 0xcd, 0x05, 0x2b, 0xcd, 0xb6, 0xfb, 0x7a, 0x80, 0x2f, 0xf2, 0x62,
+  0xb3, 0xa6, 0xc9, 0x4d, 0x5f, 0x2a, 0xa5, 0x25, 0x9f, 0x53, 0x83, 0x11, 0xe9, 0x1d, 0x97, 0xf6,
+  0x08, 0x5f, 0x78, 0x0d, 0x7e, 0x38, 0x60, 0x33, 0x64, 0x3e, 0x80, 0x91, 0x85, 0xcf, 0xe9, 0x47,
+  0x4f, 0xc6, 0x2a, 0x9f, 0xdd, 0x33, 0x04, 0x8f, 0x0d, 0x7b, 0x65, 0x82, 0xa1, 0xab, 0xa4, 0x80,
+  0x57, 0x3b, 0x73, 0xa8, 0x88, 0x75, 0xe3, 0x1e, 0xf3, 0xa3, 0xad, 0xe6, 0xd8, 0x20, 0xda, 0x9a,
+  0xdb, 0xa8, 0x72, 0xe3, 0x5e, 0xb3, 0x52, 0xcc, 0x95, 0xb0, 0xaa, 0x14, 0x39, 0x72, 0x71, 0x51,
+  0x3a, 0x58, 0xae, 0xde, 0x93, 0xc5, 0xcc, 0xed, 0xed, 0x2d, 0xca, 0x1b, 0x71, 0x5a, 0x2d, 0x1f,
+  0x7a, 0xf1, 0xc0, 0xe9, 0xc5, 0x08, 0x5b, 0x8f, 0x10, 0x46, 0x03, 0x39, 0xce, 0x8d, 0xa7, 0xd1,
+  0xd1, 0xc6, 0x45, 0x5d, 0x41, 0xf9, 0xc0, 0x49, 0x31, 0x81, 0xdd, 0x48, 0x25, 0x13, 0x77, 0xd9,
+  0x99, 0xa8, 0x1e, 0x92, 0xa0, 0xe1, 0x0b, 0x78, 0x80, 0xe3, 0x5e, 0xb9, 0x5d, 0x2b, 0xa9, 0x28,
+  0xd1, 0x11, 0xb6, 0x0f, 0xc2, 0x92, 0x5d, 0xe8, 0x6e, 0xc4, 0xe5, 0xcb, 0xb8, 0x9f, 0x26, 0xb2,
+  0xb1, 0x4a, 0x42, 0xa9, 0xe6, 0xe2, 0x81, 0xbb, 0x07, 0x6b, 0xbd, 0x9b, 0x38, 0x73, 0x78, 0xc9,
+  0xba, 0x4b, 0x81, 0xe0, 0xf6, 0xf2, 0x0e, 0xb1, 0xd1, 0x2d, 0x8c, 0xf8, 0x20, 0x7a, 0xe9, 0xd7,
+  0x5e, 0x51, 0x6d, 0x87, 0xc7, 0x6c, 0x97, 0x2e, 0x53, 0x6d, 0x67, 0x66, 0x3d, 0x9c, 0x05, 0xf6,
+  0xf4, 0x46, 0x68, 0x26, 0x26, 0x66, 0x76, 0x98, 0xe1, 0x9a, 0x83, 0xd1, 0xdd, 0x34, 0x95, 0xe5,
+  0x38, 0xee, 0xe5, 0x07, 0xd3, 0x4c, 0x17, 0x9c, 0xa4, 0x98, 0xb3, 0x95, 0x17, 0xd9, 0xa5, 0x45,
+  0xe3, 0xcb, 0xec, 0xa0, 0x62, 0x4e, 0xb9, 0xd2, 0xf9, 0x5e, 0x9f, 0x01, 0x7c, 0xe3, 0xb9, 0xb2,
+  0x24, 0x28, 0xfa, 0x88, 0x00, 0xd1, 0x8d, 0xfe, 0x20, 0x9b, 0x1c, 0xc3, 0x4d, 0x85, 0xa1, 0x33,
+  0xd6, 0x1a, 0x35, 0x2e, 0x37, 0xe5, 0xfb, 0x95, 0x54, 0xe9, 0x6a, 0x24, 0x2a, 0x43, 0x72, 0x68,
+  0xe2, 0x03, 0x2e, 0xcb, 0xeb, 0x19, 0x46, 0x0b, 0x66, 0x17, 0x0e, 0x56, 0x6b, 0x78, 0xa1, 0xc8,
+  0x4d, 0x98, 0xa9, 0xb0, 0x99, 0x0d, 0x30, 0x58, 0x86, 0xc2, 0x4a, 0xe2, 0x48, 0x51, 0x93, 0x10,
+  0x5e, 0xc7, 0x09, 0x6c, 0xbf, 0xeb, 0x8e, 0x37, 0xa3, 0x35, 0x6c, 0xa9, 0xdd, 0xc0, 0x84, 0xbb,
+  0x6b, 0xe9, 0x28, 0xc0, 0xf2, 0xc6, 0x2f, 0xbc, 0xaa, 0x5c, 0xf5, 0xa9, 0x65, 0x3c, 0x34, 0xa3,
+  0x8d, 0x97, 0x1f, 0x36, 0x41, 0x56, 0xa3, 0x9e, 0xc3, 0x87, 0x08, 0x07, 0x58, 0x59, 0xdb, 0x0d,
+  0x48, 0xe8, 0xe3, 0x95, 0x30, 0x48, 0x60, 0x56, 0x53, 0xe1, 0x35, 0xb6, 0x48, 0x3c, 0x14, 0x75,
+  0x59, 0x88, 0x97, 0x1a, 0x17, 0xf1, 0x63, 0x1f, 0x3b, 0x34, 0x51, 0xa2, 0x22, 0xd0, 0x38, 0x6b,
+  0x42, 0x34, 0x8f, 0xd8, 0x1e, 0xd3, 0x87, 0x15, 0x52, 0x5c, 0x2c, 0xd9, 0x70, 0x22, 0x16, 0xe5,
+  0xc6, 0x3f, 0xa4, 0x7a, 0x7f, 0xe1, 0xcd, 0x64, 0xcf, 0xdc, 0x61, 0xfb, 0xd4, 0x52, 0xb5, 0x52,
+  0xc3, 0x9d, 0x2d, 0x5a, 0x9a, 0x87, 0x24, 0x9e, 0x2a, 0xae, 0xc8, 0x93, 0xc1, 0x6a, 0x42, 0x1c,
+  0x37, 0x3b, 0x68, 0x60, 0xb8, 0x7d, 0x3f, 0x56, 0x20, 0x6a, 0xe8, 0xf7, 0xbb, 0x9b, 0x1a, 0x96,
+  0xca, 0xdc, 0xc3, 0x98, 0x22, 0x8d, 0x77, 0xf4, 0xca, 0x3f, 0x34, 0x7d, 0x56, 0x35, 0xa7, 0xc0,
+  0xde, 0x5b, 0x11, 0x55, 0xd1, 0x48, 0x93, 0xc7, 0xc2, 0x66, 0x2f, 0x4b, 0x13, 0x22, 0xb5, 0x17,
+  0xe9, 0xde, 0xac, 0x3c, 0x1d, 0x81, 0xb2, 0xd5, 0xae, 0x18, 0x4c, 0xfa, 0x99, 0x4e, 0xd7, 0xaa,
+  0xa5, 0x1b, 0x4d, 0x82, 0x72, 0x7a, 0x38, 0x12, 0xab, 0x26, 0xcd, 0x7d, 0x61, 0x17, 0x1b, 0xee,
+  0x06, 0x2f, 0xc5, 0xc1, 0x7e, 0xa2, 0x69, 0x75, 0xb2, 0x6a, 0xb6, 0xf2, 0x16, 0x56, 0x35, 0x9b,
+  0x11, 0x34, 0x26, 0xb1, 0x12, 0x42, 0x5c, 0x0e, 0x07, 0x53, 0xb3, 0xd5, 0x45, 0x2f, 0xe9, 0x2d,
+  0xad, 0x65, 0x95, 0xf7, 0xba, 0x65, 0xcc, 0x5b, 0x6c, 0xd7, 0xdb, 0x0a, 0x63, 0xa9, 0xdf, 0x1c,
+  0xf7, 0x55, 0x37, 0x5b, 0x6c, 0xc8, 0x3e, 0x5d, 0xb2, 0x03, 0x5d, 0x9a, 0xe3, 0x98, 0x53, 0x0d,
+  0x87, 0xc5, 0x28, 0x92, 0x0b, 0x2c, 0x83, 0x24, 0x0d, 0x6f, 0x0c, 0x34, 0x35, 0x49, 0x97, 0x11,
+  0x11, 0x49, 0x96, 0x4a, 0x21, 0xea, 0x4d, 0x88, 0xb8, 0x3b, 0xe9, 0x86, 0x3b, 0x32, 0x99, 0xba,
+  0xd1, 0x24, 0x39, 0xa5, 0xfd, 0xf3, 0x0a, 0xc0, 0xc4, 0xbb, 0x9c, 0x3f, 0xb8, 0xba, 0x50, 0x2e,
+  0xed, 0xbe, 0x01, 0x84, 0xf4, 0x48, 0xa1, 0x18, 0x0c, 0xa3, 0x6e, 0xde, 0x1f, 0xc5, 0x73, 0x3f,
+  0x50, 0x05, 0xc6, 0xe2, 0x34, 0x65, 0xd6, 0x75, 0x58, 0x58, 0x60, 0x32, 0xf6, 0x58, 0x6d, 0x5d,
+  0xd4, 0xd4, 0xfa, 0xc1, 0xe6, 0xa8, 0x5b, 0x3a, 0x15, 0xf5, 0x62, 0xde, 0x66, 0x7b, 0x63, 0x83,
+  0x2c, 0xcd, 0xa4, 0x48, 0xad, 0xcc, 0x1a, 0x17, 0x3d, 0x7a, 0x80, 0xe1, 0xac, 0x28, 0xe7, 0x32,
+  0xc2, 0xed, 0x76, 0x98, 0xb8, 0xe2, 0x83, 0x4c, 0x55, 0x96, 0xab, 0x29, 0xbd, 0x4d, 0xf7, 0x5b,
+  0xaa, 0xa7, 0xe8, 0xe2, 0xc2, 0x58, 0xb1, 0x14, 0xbd, 0x6b, 0x8a, 0x82, 0x24, 0xc7, 0x86, 0x2b,
+  0x40, 0x63, 0xd9, 0x14, 0x23, 0x44, 0x2a, 0x1a, 0xd5, 0x2e, 0x88, 0x4c, 0x34, 0x99, 0x03, 0xb0,
+  0x90, 0x32, 0x21, 0xe6, 0x3d, 0x03, 0x3e, 0x92, 0xb6, 0x16, 0xa1, 0xd0, 0x7a, 0x6f, 0xad, 0x0d,
+  0x68, 0x1c, 0x06, 0x52, 0x73, 0x58, 0x8f, 0xba, 0x36, 0x73, 0x6c, 0x46, 0xdd, 0xc0, 0x61, 0x04,
+  0x37, 0x4a, 0x23, 0x37, 0xc0, 0x42, 0xdf, 0xd1, 0xfa, 0x32, 0x2d, 0x71, 0x75, 0xa0, 0x6d, 0x36,
+  0x07, 0xbd, 0x66, 0xa6, 0x02, 0x81, 0x4a, 0x36, 0xb9, 0x22, 0x57, 0x02, 0xcc, 0xad, 0x15, 0x5e,
+  0xed, 0xc6, 0xd3, 0xa1, 0x8e, 0xdb, 0xcb, 0xb1, 0x54, 0x5b, 0xd3, 0x8a, 0x15, 0xf1, 0x32, 0x21,
+  0x8c, 0x72, 0xb5, 0x20, 0xe1, 0xb4, 0x61, 0xf3, 0xc9, 0xae, 0x0b, 0xcf, 0x63, 0x4e, 0xe2, 0xfb,
+  0xb5, 0x58, 0x13, 0x65, 0xb1, 0x3e, 0x96, 0x1e, 0x43, 0xea, 0x7c, 0x09, 0xcf, 0x15, 0xdf, 0xd5,
+  0x2b, 0x42, 0xe1, 0x39, 0x85, 0x36, 0x59, 0x50, 0x1a, 0x54, 0xcb, 0xa4, 0x8f, 0xe8, 0x92, 0xb5,
+  0xa9, 0x91, 0xcd, 0x32, 0x49, 0x26, 0x84, 0x53, 0xd0, 0x83, 0x45, 0x7f, 0xdf, 0x3d, 0xd4, 0x28,
+  0x54, 0x61, 0x8c, 0xb4, 0xf7, 0xe4, 0xc9, 0x2a, 0xde, 0x87, 0x55, 0x89, 0x70, 0x9b, 0x08, 0xd7,
+  0x42, 0x7e, 0x99, 0x2a, 0x74, 0x36, 0x05, 0x45, 0x0f, 0x3a, 0x20, 0xe5, 0x6c, 0x45, 0x10, 0x4b,
+  0x7c, 0xb3, 0x45, 0x7c, 0xab, 0x3b, 0x71, 0xe9, 0x06, 0x4a, 0x73, 0x29, 0xd1, 0x96, 0xbb, 0x4c,
+  0x6d, 0xc2, 0x63, 0xb1, 0x6a, 0xb2, 0x3d, 0x3d, 0xb3, 0x52, 0x85, 0x6d, 0xf4, 0xd0, 0xdb, 0xd9,
+  0x83, 0x68, 0x9e, 0xd4, 0xe2, 0x6a, 0x37, 0xca, 0x7b, 0x49, 0xaa, 0x4d, 0x36, 0xbd, 0x71, 0xb5,
+  0xe0, 0x8a, 0x01, 0x9a, 0xed, 0xc9, 0x3e, 0xae, 0x11, 0x3e, 0xd8, 0x24, 0x4c, 0x76, 0x5a, 0xd1,
+  0xeb, 0x62, 0xba, 0x68, 0xc7, 0xb5, 0x6e, 0xad, 0x48, 0x1f, 0xc5, 0x95, 0x59, 0xe0, 0xee, 0x2c,
+  0x10, 0x25, 0x2a, 0x27, 0xa2, 0xb6, 0x5d, 0x54, 0x4b, 0x82, 0x45, 0xd9, 0xae, 0xe1, 0x93, 0xf8,
+  0xac, 0xeb, 0xaa, 0x74, 0x75, 0xa4, 0x1b, 0x5d, 0xca, 0x90, 0x83, 0x6c, 0x78, 0x41, 0xbf, 0xb2,
+  0x08, 0x8e, 0xda, 0xe6, 0x7e, 0x20, 0x11, 0xbe, 0x5f, 0xf7, 0xc5, 0x90, 0x26, 0xd3, 0xae, 0xcb,
+  0x46, 0x19, 0x37, 0x47, 0xe9, 0xe1, 0x68, 0x30, 0x97, 0xb5, 0x04, 0xcb, 0x75, 0xe0, 0x9a, 0xe1,
+  0x98, 0x3b, 0x0a, 0x26, 0x3f, 0x4b, 0xe9, 0x91, 0xb6, 0x69, 0x5c, 0x8d, 0x37, 0x74, 0x65, 0xd4,
+  0xf5, 0xe3, 0x9d, 0x00, 0x08, 0xaa, 0x16, 0xdd, 0xf0, 0x7e, 0x91, 0x32, 0x6a, 0xd5, 0x5f, 0x74,
+  0x3d, 0x8f, 0x33, 0x98, 0xd5, 0x11, 0xe4, 0xa7, 0xfe, 0xd2, 0x7e, 0x5c, 0xb3, 0x5c, 0x52, 0xec,
+  0x26, 0xc7, 0x72, 0x55, 0x28, 0xaa, 0xc2, 0xa0, 0x07, 0x36, 0xca, 0xbb, 0x48, 0x9f, 0xe1, 0x84,
+  0x6e, 0xbb, 0xf4, 0x97, 0xe8, 0xde, 0xc4, 0xf1, 0xf9, 0xd4, 0x45, 0x8e, 0xa3, 0xd1, 0xc1, 0x3c,
+  0x12, 0x5d, 0x31, 0x6f, 0x74, 0x81, 0x74, 0x23, 0x1c, 0xf8, 0x05, 0x36, 0x8b, 0x06, 0xa5, 0x4a,
+  0x13, 0x3d, 0x6b, 0x28, 0xe5, 0x72, 0xd9, 0x5d, 0xe4, 0x3d, 0x06, 0x2f, 0xba, 0xf4, 0x12, 0x4f,
+  0x9c, 0xde, 0x2e, 0xd6, 0x90, 0x2d, 0x67, 0x6e, 0x79, 0x08, 0x0f, 0x8b, 0x72, 0x00, 0xcf, 0x31,
+  0x69, 0xab, 0x88, 0x10, 0x0b, 0x99, 0xd3, 0xfd, 0x52, 0xd7, 0x02, 0x93, 0x63, 0x03, 0x08, 0xab,
+  0x22, 0x7e, 0xd8, 0xed, 0x96, 0xde, 0xc0, 0x93, 0x73, 0x48, 0x5c, 0x33, 0x06, 0xb6, 0x33, 0xc3,
+  0xb1, 0x6f, 0x6d, 0x72, 0xb0, 0x4e, 0x2f, 0xf5, 0x2e, 0xa6, 0xb1, 0x93, 0xde, 0xda, 0x44, 0x22,
+  0x65, 0xa4, 0x28, 0xe8, 0x3a, 0x95, 0x2b, 0x29, 0x1b, 0x7b, 0xde, 0x3e, 0xb2, 0x7c, 0xdd, 0x5c,
+  0x1f, 0xd4, 0xde, 0xe2, 0x30, 0x40, 0xcd, 0x1e, 0x9a, 0xf6, 0xbb, 0x0c, 0xc7, 0x1e, 0x9a, 0x92,
+  0x4d, 0x64, 0x49, 0x42, 0x76, 0xae, 0x1b, 0x24, 0x2c, 0x7f, 0x34, 0xe4, 0xaa, 0x6c, 0x42, 0xe2,
+  0xe8, 0xae, 0x27, 0xf6, 0xc0, 0x6f, 0xb8, 0x24, 0x4b, 0x52, 0x75, 0x9e, 0xfa, 0x60, 0xa5, 0x95,
+  0x16, 0x91, 0x61, 0x6d, 0xa6, 0x83, 0x23, 0x85, 0x1d, 0x26, 0xb9, 0x0a, 0xea, 0xbd, 0x74, 0x9d,
+  0x24, 0x42, 0x1a, 0x34, 0x70, 0xdf, 0xaf, 0x10, 0x72, 0x33, 0xc1, 0x3d, 0x93, 0xd6, 0x99, 0xb4,
+  0xc6, 0xc6, 0x54, 0x52, 0x82, 0xec, 0x3f, 0x27, 0x52, 0x17, 0xc9, 0x56, 0x32, 0x8f, 0xaf, 0x76,
+  0x83, 0x40, 0xaa, 0x08, 0x97, 0x74, 0xb4, 0x62, 0x9e, 0x6c, 0x9b, 0xa4, 0xc1, 0x56, 0xac, 0x36,
+  0x31, 0x83, 0x85, 0x91, 0x01, 0xde, 0xf5, 0x75, 0x8d, 0x35, 0xfd, 0xee, 0x7e, 0x3e, 0xf0, 0x17,
+  0x7b, 0x4b, 0x5e, 0xaf, 0x16, 0x45, 0x96, 0x71, 0x41, 0xae, 0x77, 0x91, 0x8c, 0x54, 0x1c, 0x74,
+  0x5d, 0xe4, 0x7d, 0x7c, 0x2f, 0x72, 0x7d, 0x09, 0xee, 0x79, 0xf4, 0x54, 0xf5, 0xe6, 0x3d, 0x39,
+  0x18, 0xa7, 0x41, 0xde, 0x0c, 0xeb, 0xde, 0x11, 0x59, 0x8b, 0xeb, 0xd1, 0xe4, 0x40, 0xa1, 0x85,
+  0xd1, 0x83, 0x8d, 0x70, 0xc1, 0x42, 0xd9, 0x96, 0x0e, 0x96, 0x3a, 0x2b, 0x36, 0x4b, 0x3a, 0x5e,
+  0xc4, 0xc5, 0xc4, 0x89, 0xa6, 0xbb, 0x8a, 0x75, 0x85, 0x60, 0x36, 0x23, 0xa5, 0x86, 0x2f, 0x33,
+  0xf9, 0x00, 0xd6, 0xe9, 0xf1, 0x36, 0xc5, 0x31, 0x5e, 0xed, 0x09, 0x5d, 0x81, 0x0c, 0xd4, 0x66,
+  0xbc, 0xa7, 0xf4, 0x98, 0x19, 0x4c, 0x30, 0xa4, 0x7b, 0x88, 0xf2, 0xa2, 0x2b, 0x4f, 0x8d, 0x45,
+  0xc9, 0x2a, 0xb1, 0x17, 0xc6, 0x47, 0xd2, 0xf1, 0xf8, 0x54, 0x57, 0x3c, 0x2f, 0x64, 0x03, 0x71,
+  0x56, 0xd0, 0x5b, 0xd2, 0x40, 0x86, 0x43, 0xbc, 0x66, 0x30, 0xcc, 0x95, 0xc8, 0x7a, 0xbd, 0xd8,
+  0xad, 0x41, 0x0e, 0xe4, 0x46, 0xfc, 0x5a, 0xae, 0x16, 0xc3, 0x21, 0xd0, 0x04, 0x6c, 0x30, 0x92,
+  0xa7, 0x5b, 0x49, 0x5d, 0x24, 0x31, 0x54, 0xd1, 0x98, 0x68, 0x81, 0x9d, 0x4f, 0x86, 0x78, 0x92,
+  0xb6, 0x92, 0xd6, 0x82, 0x85, 0x26, 0x3b, 0x07, 0xf6, 0xa8, 0xf5, 0x9e, 0x9d, 0x90, 0x6b, 0xfd,
+  0xd8, 0x5d, 0xc1, 0x6b, 0x69, 0xc6, 0x6d, 0x44, 0x11, 0x04, 0x8c, 0x87, 0x58, 0x7d, 0xca, 0xc1,
+  0x70, 0x3d, 0x84, 0x78, 0x68, 0xc6, 0x1c, 0xf1, 0x8d, 0x95, 0x04, 0x07, 0xf2, 0xa8, 0x77, 0x35,
+  0xd7, 0x72, 0xf3, 0x9a, 0x9b, 0x4a, 0x6e, 0x79, 0x80, 0xa7, 0xe9, 0x48, 0x9c, 0xee, 0xa5, 0xac,
+  0x29, 0xf5, 0xe5, 0xc6, 0x23, 0x11, 0x22, 0xd5, 0x6a, 0x23, 0x8f, 0xc3, 0x01, 0x3e, 0xa8, 0xe4,
+  0x28, 0x0f, 0x72, 0xc2, 0x0e, 0x7b, 0xec, 0x11, 0x49, 0x6a, 0x3e, 0x45, 0x76, 0xc2, 0x58, 0xd9,
+  0x57, 0xe2, 0x66, 0xdf, 0x87, 0x66, 0x16, 0xe9, 0x16, 0x51, 0xa1, 0x64, 0x83, 0xae, 0x0b, 0x61,
+  0x2c, 0xce, 0x25, 0x1c, 0x9b, 0x43, 0x32, 0x64, 0x1e, 0x2d, 0x18, 0x22, 0xb7, 0x96, 0x3e, 0x16,
+  0x98, 0xc9, 0xe6, 0xb1, 0xba, 0x56, 0xf8, 0xba, 0xe0, 0xf8, 0xb1, 0xd9, 0xd4, 0xd0, 0x0a, 0x4b,
+  0x63, 0xee, 0x78, 0xd0, 0xf4, 0x31, 0xab, 0x1b, 0x0c, 0x39, 0x91, 0x91, 0x38, 0x64, 0x0e, 0x06,
+  0xac, 0xb0, 0xc7, 0xa9, 0xec, 0x76, 0x7b, 0xee, 0x38, 0xd3, 0xe5, 0xd0, 0xd6, 0xac, 0x83, 0xd4,
+  0xe7, 0xd4, 0xcd, 0x46, 0xde, 0x5a, 0xcb, 0x9c, 0x5f, 0xd1, 0x23, 0xac, 0x3f, 0xf2, 0x9b, 0x06,
+  0xed, 0x1e, 0x46, 0x2b, 0x97, 0x89, 0xb8, 0xc5, 0x16, 0xf8, 0x02, 0x88, 0xc4, 0x61, 0xdf, 0x2d,
+  0xb8, 0x1d, 0x19, 0xf1, 0xac, 0xb1, 0x1d, 0x1c, 0x90, 0x69, 0xd0, 0xa4, 0x69, 0x3c, 0x8b, 0x68,
+  0x9e, 0x9e, 0xe2, 0x6a, 0x61, 0x83, 0xc5, 0x1d, 0x3a, 0x9a, 0x30, 0x7f, 0xe8, 0x7b, 0xfe, 0xca,
+  0x96, 0x76, 0x8b, 0xad, 0xad, 0xc3, 0x63, 0xcd, 0xa5, 0x2c, 0x5e, 0xa7, 0x27, 0xd0, 0xda, 0x2f,
+  0x77, 0xe3, 0xa5, 0xb6, 0xb3, 0xc9, 0x90, 0xc2, 0x54, 0x22, 0x26, 0x47, 0x4c, 0xd8, 0xdb, 0xe7,
+  0xf2, 0x5e, 0x51, 0xba, 0x47, 0x15, 0x19, 0xfb, 0x93, 0xb9, 0x8f, 0x1e, 0x07, 0x93, 0xed, 0xd2,
+  0x25, 0x51, 0x24, 0xa0, 0x26, 0x87, 0x43, 0x81, 0x12, 0xf6, 0x61, 0xb6, 0xd8, 0x14, 0xca, 0xb8,
+  0x2e, 0xba, 0x19, 0x86, 0x7a, 0x4a, 0x50, 0x8c, 0xcb, 0x68, 0xb7, 0xd9, 0xe2, 0x09, 0xd8, 0x12,
+  0x86, 0xe6, 0xb1, 0x40, 0xc7, 0x1a, 0xca, 0xbb, 0x49, 0xc8, 0xa4, 0xa8, 0xcd, 0x6b, 0xfc, 0xee,
+  0xb0, 0x54, 0x79, 0x6a, 0xa6, 0xa9, 0xb6, 0x67, 0x04, 0xac, 0x77, 0x5c, 0x04, 0xfb, 0xd9, 0x18,
+  0x57, 0xb4, 0x15, 0xa8, 0xac, 0x6b, 0x9e, 0xd5, 0x50, 0x7f, 0x8b, 0x67, 0xa8, 0x64, 0xf4, 0xa4,
+  0xfd, 0xc0, 0xc7, 0x07, 0xcb, 0x98, 0x5d, 0x26, 0x63, 0xcc, 0x4f, 0x43, 0x90, 0xb0, 0xeb, 0x95,
+  0x2a, 0xfb, 0xb1, 0x2d, 0xce, 0x26, 0xc7, 0xc6, 0xe2, 0xf7, 0x13, 0xfd, 0xa8, 0xf5, 0xb1, 0x46,
+  0x4b, 0x0d, 0xbb, 0x90, 0xe4, 0x81, 0x25, 0xaf, 0xc2, 0x83, 0xc5, 0x4d, 0xb5, 0xd2, 0xd4, 0xeb,
+  0x55, 0x45, 0xe1, 0xd4, 0xa8, 0xca, 0x51, 0x4e, 0x91, 0xa5, 0x99, 0x24, 0x46, 0x3a, 0xd1, 0x40,
+  0x0b, 0xd2, 0x9b, 0x2c, 0x24, 0x77, 0xbe, 0x98, 0x9b, 0xc6, 0x38, 0x60, 0x26, 0x62, 0x6c, 0x6d,
+  0xc7, 0xa6, 0x37, 0xc6, 0xe6, 0x30, 0xa4, 0x58, 0x71, 0x8c, 0xf1, 0x47, 0xab, 0x1e, 0xae, 0x13,
+  0x27, 0x22, 0x66, 0xc4, 0xa4, 0x16, 0x72, 0x2e, 0x2c, 0xf9, 0xc0, 0x36, 0xfb, 0x7d, 0x9b, 0x27,
+  0x56, 0xd4, 0x50, 0x21, 0xb3, 0xdc, 0x06, 0xd1, 0x1b, 0xee, 0x47, 0xd8, 0xd6, 0x83, 0xc3, 0xa2,
+  0x7b, 0xe8, 0x77, 0x33, 0xb2, 0xc0, 0xe9, 0x8c, 0x92, 0x34, 0xa8, 0xc7, 0x34, 0x9e, 0x92, 0x29,
+  0x12, 0xb4, 0x0b, 0x12, 0xcf, 0x27, 0x96, 0x85, 0x23, 0x4b, 0x76, 0x4a, 0xef, 0xf7, 0xd3, 0xd4,
+  0xb3, 0x7a, 0x7b, 0xcc, 0x21, 0xed, 0x7c, 0xa6, 0x2d, 0xe7, 0xcb, 0x72, 0x0e, 0x95, 0x39, 0x28,
+  0xa6, 0x70, 0x4e, 0x96, 0xeb, 0x6d, 0xb6, 0x56, 0x8a, 0x55, 0x98, 0x86, 0x41, 0xa3, 0x94, 0x3b,
+  0x81, 0xf1, 0xbd, 0x11, 0x6e, 0xd3, 0xe6, 0x66, 0x37, 0xdf, 0x2c, 0x97, 0xe2, 0x6a, 0x22, 0x6e,
+  0xf0, 0x69, 0x03, 0x73, 0x26, 0x4a, 0xf4, 0x9b, 0xc2, 0x2e, 0x27, 0xa3, 0xd5, 0x1c, 0xe6, 0x59,
+  0x8a, 0x32, 0xc5, 0x81, 0xef, 0x8a, 0x7e, 0xa1, 0xed, 0x07, 0x8c, 0xc2, 0x6a, 0x8c, 0xd0, 0x3f,
+  0x00, 0x3f, 0xc3, 0x0d, 0xe7, 0x71, 0x17, 0x07, 0x36, 0xb6, 0x74, 0xdd, 0x3d, 0x14, 0xcb, 0x8c,
+  0xa5, 0x05, 0xcc, 0xa8, 0xe6, 0xb8, 0x1a, 0x00, 0x1b, 0xd8, 0x36, 0xe9, 0x45, 0x51, 0xec, 0x4a,
+  0xe3, 0x9d, 0x22, 0x77, 0x55, 0x4b, 0x5a, 0x55, 0x24, 0x62, 0xc1, 0x79, 0x39, 0xa9, 0x21, 0xaa,
+  0x19, 0x18, 0x82, 0xd3, 0x9d, 0x96, 0xae, 0x0a, 0xea, 0x82, 0x22, 0x50, 0x45, 0x96, 0x9a, 0x87,
+  0x8b, 0xe3, 0xd4, 0x20, 0x41, 0xd1, 0x82, 0xd5, 0xca, 0x31, 0x67, 0x68, 0x23, 0x55, 0x74, 0x4f,
+  0xab, 0x56, 0x7d, 0x92, 0x3b, 0xec, 0x80, 0xa3, 0x29, 0x53, 0x56, 0xe7, 0x6b, 0xd2, 0x8d, 0x05,
+  0x49, 0x18, 0x09, 0x60, 0xe5, 0xa8, 0x21, 0x58, 0x0a, 0xd0, 0xb4, 0x4a, 0x0d, 0x4c, 0xeb, 0x37,
+  0x2a, 0xb2, 0x28, 0x27, 0x91, 0xce, 0x22, 0x0a, 0xee, 0xb2, 0xe2, 0x62, 0x37, 0xf0, 0xa2, 0x78,
+  0xe2, 0xf4, 0xb5, 0x52, 0x56, 0xad, 0xdd, 0xda, 0xa4, 0x9d, 0x6a, 0xba, 0x9d, 0xd7, 0xe9, 0xce,
+  0x95, 0x7c, 0x0c, 0x46, 0x08, 0x7c, 0xd0, 0x05, 0x75, 0x16, 0x2d, 0x1b, 0x60, 0xed, 0x86, 0x4a,
+  0x8d, 0x98, 0x6b, 0x4b, 0x75, 0xad, 0xb1, 0x26, 0x3f, 0xb2, 0xf9, 0xbc, 0x81, 0xa7, 0x64, 0x54,
+  0x1a, 0x43, 0xa8, 0x1a, 0xad, 0xfa, 0x7d, 0x78, 0x9b, 0xa4, 0xc4, 0x7a, 0xe0, 0xa7, 0xf3, 0x6e,
+  0xbd, 0xc9, 0xbc, 0x11, 0xec, 0xa7, 0xf6, 0x5a, 0x28, 0x87, 0x8c, 0xbb, 0xec, 0xb3, 0x5b, 0x6e,
+  0x54, 0xc8, 0x06, 0xd8, 0x4d, 0xc5, 0xb2, 0xd0, 0xd8, 0x56, 0x2f, 0x9d, 0x94, 0x7d, 0x4a, 0x15,
+  0x0c, 0x75, 0x5f, 0xb9, 0xde, 0xb2, 0xeb, 0xd9, 0xfd, 0x49, 0x41, 0xf5, 0x6d, 0x62, 0xc3, 0x6d,
+  0x1b, 0xb2, 0xee, 0x6e, 0x20, 0x8a, 0xaf, 0x64, 0x3f, 0x51, 0xbb, 0x64, 0xd7, 0xd9, 0xc6, 0x8a,
+  0x52, 0x6d, 0xf6, 0x49, 0x92, 0x8e, 0x96, 0x89, 0x37, 0x55, 0x2d, 0x20, 0x52, 0x94, 0x31, 0x50,
+  0xca, 0x22, 0x05, 0xae, 0xcc, 0x33, 0x37, 0x8c, 0x77, 0xd3, 0xa3, 0xb9, 0x0c, 0x62, 0x94, 0xb5,
+  0x71, 0x81, 0xe7, 0x1c, 0x8c, 0x41, 0x1a, 0x26, 0x13, 0x37, 0x85, 0xae, 0xf9, 0x35, 0x9f, 0x63,
+  0x7b, 0x8c, 0x6b, 0xe4, 0x28, 0xb3, 0x7a, 0x5b, 0x9f, 0xec, 0x6e, 0xfc, 0x5e, 0x92, 0x83, 0xd4,
+  0xd7, 0x9b, 0x0c, 0x32, 0x2f, 0xf3, 0x99, 0x35, 0x3f, 0x83, 0x44, 0xb1, 0x60, 0x42, 0x71, 0x2c,
+  0x43, 0x28, 0xa8, 0xa0, 0xe4, 0x2e, 0x9c, 0x6c, 0xd2, 0x4d, 0xd5, 0x4b, 0xc6, 0x1e, 0x65, 0x2e,
+  0xf1, 0x01, 0xc4, 0x68, 0x6e, 0x15, 0x17, 0x9b, 0x03, 0xb6, 0x4a, 0x54, 0x7d, 0x12, 0x32, 0xcb,
+  0xd5, 0x9a, 0x3b, 0x9a, 0x38, 0x35, 0x0e, 0x1d, 0x3d, 0x85, 0x95, 0x45, 0xdd, 0x58, 0x1c, 0xab,
+  0xb9, 0xe4, 0xa6, 0xc2, 0xa1, 0x6a, 0x68, 0x24, 0x7d, 0x8f, 0x69, 0x54, 0x71, 0xc5, 0xcd, 0xc8,
+  0x69, 0xb1, 0x21, 0xc7, 0xda, 0xc1, 0x0a, 0x66, 0xab, 0xc5, 0xa1, 0xbb, 0x2f, 0x32, 0x6e, 0xd4,
+  0xe4, 0x31, 0x37, 0xec, 0xf7, 0xb0, 0x86, 0x41, 0x8c, 0xb0, 0xa7, 0x2c, 0xf0, 0x72, 0x49, 0x14,
+  0x36, 0x89, 0x1c, 0x55, 0x93, 0x02, 0x09, 0x5d, 0x26, 0x8f, 0xe4, 0x12, 0x11, 0x51, 0xdf, 0x1e,
+  0x6b, 0x6b, 0x58, 0x73, 0x48, 0x13, 0x91, 0x0c, 0x49, 0xcb, 0xbd, 0x5c, 0x01, 0x26, 0x11, 0xb6,
+  0x64, 0xac, 0x61, 0xb0, 0x40, 0x3a, 0x7b, 0x81, 0x09, 0x27, 0xd5, 0x8b, 0x4a, 0xf1, 0x94, 0xcd,
+  0x9c, 0x2d, 0x4c, 0xee, 0x27, 0x7e, 0xea, 0x00, 0xbb, 0x8c, 0x15, 0x76, 0x86, 0xc3, 0x41, 0xb6,
+  0x70, 0x06, 0x9a, 0xb0, 0x74, 0x8d, 0x1d, 0x59, 0x0c, 0x09, 0xa8, 0xa2, 0x90, 0x34, 0xd9, 0x4b,
+  0x63, 0x4e, 0xf1, 0xe6, 0xb8, 0x32, 0xdc, 0x1a, 0x69, 0x7f, 0x6e, 0xb0, 0x09, 0x4a, 0x06, 0x5d,
+  0x18, 0xac, 0x2f, 0xaa, 0x21, 0xc6, 0xba, 0xd8, 0x0b, 0x84, 0x84, 0x9f, 0xe2, 0x26, 0x42, 0xfb,
+  0xec, 0x6a, 0x6b, 0x57, 0xf3, 0xec, 0xc8, 0x37, 0xac, 0x89, 0x19, 0xa8, 0x23, 0x10, 0xa6, 0xbf,
+  0x5a, 0xec, 0xb0, 0x61, 0x85, 0x79, 0x5d, 0x97, 0xe1, 0x0c, 0x05, 0x3f, 0xe8, 0xd6, 0xd4, 0x81,
+  0x07, 0xc7, 0x24, 0x0c, 0x73, 0x8c, 0x87, 0xd8, 0x44, 0x99, 0x43, 0xcb, 0x61, 0x44, 0x5a, 0x58,
+  0x1a, 0x24, 0xd2, 0x92, 0x56, 0x5d, 0x6e, 0xa3, 0x0b, 0x04, 0x23, 0xa8, 0xf2, 0x22, 0x9f, 0xa9,
+  0xc2, 0xce, 0x5b, 0x27, 0xab, 0x8d, 0xbc, 0xf7, 0x72, 0x4b, 0x1a, 0x07, 0x59, 0x82, 0x36, 0x58,
+  0xdd, 0x5b, 0x54, 0xee, 0x34, 0x15, 0x36, 0x6d, 0x09, 0xd2, 0x9b, 0x8c, 0x24, 0x53, 0xe8, 0x6e,
+  0xc9, 0x50, 0x35, 0x57, 0x43, 0x51, 0x67, 0xd6, 0x86, 0x58, 0x8e, 0x7a, 0x69, 0x3a, 0xad, 0x36,
+  0xe5, 0xc4, 0x21, 0x91, 0xb0, 0x57, 0x94, 0x34, 0x16, 0xa4, 0x11, 0x97, 0xa5, 0x3b, 0xc8, 0xd6,
+  0xbc, 0x50, 0xde, 0x6e, 0xea, 0x79, 0xda, 0x43, 0x88, 0x29, 0x46, 0xaf, 0x0d, 0x8c, 0x07, 0x49,
+  0x6e, 0xe7, 0x9b, 0x7d, 0x8d, 0x8e, 0xfb, 0xb8, 0x87, 0x71, 0x5e, 0xb2, 0x11, 0x11, 0xde, 0x44,
+  0x21, 0x5b, 0x50, 0xb1, 0xed, 0x7c, 0x83, 0x0a, 0xa4, 0xb1, 0xce, 0xea, 0x8c, 0x73, 0xa9, 0xa1,
+  0xee, 0x9b, 0x3e, 0xb7, 0x59, 0x1e, 0xf8, 0xc0, 0x85, 0xb4, 0x8a, 0x35, 0xe3, 0x99, 0xd3, 0x65,
+  0x73, 0x97, 0xe5, 0xb1, 0x31, 0x74, 0x88, 0xb5, 0x14, 0x47, 0xfa, 0x46, 0x43, 0x6f, 0x7a, 0xaa,
+  0x94, 0x1e, 0xd1, 0xfe, 0x71, 0x32, 0xd9, 0x52, 0xee, 0x04, 0xd4, 0xe1, 0xe5, 0xaa, 0x1a, 0xf5,
+  0x46, 0xf5, 0x7e, 0x2f, 0x2b, 0xf3, 0xcd, 0xa1, 0x9f, 0xa1, 0xf8, 0x7a, 0xcb, 0xe4, 0xee, 0x29,
+  0xea, 0x87, 0xcf, 0x51, 0xff, 0xd8, 0x94, 0x47, 0x8c, 0x3f, 0x1e, 0x1e, 0xe7, 0xd8, 0x68, 0x22,
+  0x2a, 0xd3, 0x01, 0x83, 0xed, 0x8b, 0x95, 0xc9, 0x00, 0xa6, 0xe9, 0xfd, 0x74, 0x80, 0x17, 0xcb,
+  0x1d, 0xd2, 0xef, 0x8a, 0x7e, 0x53, 0xef, 0x37, 0x48, 0xcf, 0xd5, 0x57, 0x12, 0x23, 0x63, 0xa2,
+  0x84, 0xea, 0x03, 0x50, 0xbc, 0xcb, 0x95, 0x5b, 0x80, 0x1d, 0xac, 0xd7, 0x8b, 0xb1, 0x81, 0x43,
+  0xa4, 0x11, 0x8e, 0xac, 0x89, 0x1a, 0xf1, 0x0c, 0x71, 0x98, 0x6a, 0x2e, 0x53, 0x4a, 0xcc, 0x70,
+  0x02, 0x21, 0x80, 0xfb, 0x85, 0xca, 0x1e, 0x47, 0xdd, 0x9e, 0x4a, 0x2d, 0x34, 0x7f, 0x38, 0xa3,
+  0x30, 0x85, 0xd0, 0x0f, 0xa1, 0x1e, 0xce, 0x36, 0x6e, 0xb6, 0x2a, 0xf4, 0x0a, 0xee, 0xe7, 0x5e,
+  0x0a, 0xf2, 0x01, 0x69, 0xaa, 0x53, 0xd3, 0x25, 0x0d, 0xcb, 0x26, 0xb8, 0x0c, 0x36, 0x1c, 0xcb,
+  0xa4, 0xe3, 0x14, 0xe5, 0xc4, 0x25, 0x7d, 0xb4, 0x04, 0x36, 0x60, 0x2c, 0x2f, 0x99, 0xa3, 0x19,
+  0x51, 0xed, 0xb3, 0x01, 0xaf, 0x31, 0x78, 0x7d, 0x80, 0xb7, 0xf2, 0x00, 0xc4, 0x38, 0x1b, 0x74,
+  0xdd, 0xd5, 0x82, 0x23, 0x27, 0x23, 0x11, 0x92, 0x58, 0x0f, 0x9a, 0x99, 0x45, 0x37, 0xb7, 0x1a,
+  0xa1, 0xc9, 0x57, 0x2a, 0x84, 0x67, 0x44, 0xd3, 0xc5, 0x41, 0xce, 0x1e, 0xd2, 0xa2, 0x10, 0xc0,
+  0xbc, 0x8f, 0x4c, 0xfb, 0x43, 0xa3, 0x4f, 0xe0, 0xac, 0xce, 0xa5, 0x86, 0x53, 0xa9, 0xb3, 0xa2,
+  0xcf, 0xd4, 0xe4, 0xa6, 0x4f, 0x45, 0x71, 0x2f, 0x48, 0x27, 0xcb, 0x78, 0xa5, 0x44, 0x64, 0x46,
+  0x80, 0xad, 0x89, 0xe3, 0xe8, 0x7d, 0x54, 0x05, 0xf9, 0x1b, 0x6c, 0xe2, 0xfb, 0xf4, 0xb2, 0xbb,
+  0x06, 0xb4, 0x60, 0x6b, 0x9c, 0x16, 0x42, 0xed, 0x14, 0x36, 0x45, 0x91, 0xc3, 0xbd, 0x65, 0xf8,
+  0x4a, 0x86, 0x6c, 0x09, 0x63, 0x39, 0xc2, 0xa4, 0x68, 0x27, 0x10, 0xfe, 0x71, 0xe0, 0x1d, 0x6d,
+  0x47, 0xad, 0x64, 0x95, 0x1a, 0xa2, 0x1c, 0x22, 0x30, 0x12, 0x57, 0xbd, 0x7c, 0x69, 0xf6, 0xd4,
+  0x1c, 0xf6, 0x0b, 0x3e, 0x97, 0x8e, 0x44, 0x5f, 0x8b, 0x65, 0x75, 0x95, 0xec, 0xe4, 0xb0, 0x07,
+  0xa7, 0x43, 0xb2, 0x29, 0x3d, 0x35, 0x1c, 0x88, 0x49, 0x89, 0x99, 0x56, 0x7f, 0xd6, 0x44, 0xd6,
+  0x9e, 0x1c, 0x62, 0xd2, 0x81, 0xdc, 0x4d, 0x96, 0x2a, 0x72, 0xb4, 0x71, 0xcc, 0x30, 0xab, 0x26,
+  0xe7, 0xbc, 0x82, 0xf4, 0x35, 0xb8, 0x1b, 0x78, 0xda, 0x64, 0x1b, 0x8b, 0x95, 0xdf, 0x1b, 0xeb,
+  0x44, 0xc1, 0x89, 0x22, 0x47, 0x78, 0xa8, 0x1d, 0xb3, 0x93, 0xa3, 0x9a, 0x50, 0x61, 0xe6, 0x7b,
+  0xab, 0x5a, 0x59, 0xef, 0xa7, 0xac, 0x7a, 0x7e, 0x95, 0xb4, 0x5d, 0x40, 0x82, 0x22, 0x51, 0xa6,
+  0xc7, 0x8f, 0xf0, 0xbe, 0x17, 0x6a, 0xa4, 0x1e, 0x6f, 0xad, 0x38, 0x41, 0xf3, 0x2a, 0xd0, 0xb3,
+  0xa2, 0xc7, 0x1f, 0xc5, 0x05, 0xbc, 0xe7, 0xd1, 0xd5, 0x10, 0x53, 0x26, 0xb8, 0xed, 0xb9, 0xbc,
+  0x34, 0x63, 0x05, 0x04, 0xb5, 0xc0, 0xea, 0x6e, 0xf9, 0xde, 0x90, 0xc0, 0x3d, 0xa5, 0x77, 0xb0,
+  0xa2, 0x99, 0xea, 0x0b, 0x4a, 0x2d, 0x04, 0x47, 0x42, 0x5e, 0xf0, 0x29, 0xf0, 0x85, 0x74, 0xa3,
+  0x85, 0xbb, 0xd0, 0x88, 0xca, 0xd5, 0x50, 0x5f, 0x6b, 0xdb, 0x4a, 0x38, 0xf2, 0x8c, 0x33, 0xad,
+  0xd3, 0x54, 0x4f, 0xbd, 0x2d, 0x5b, 0xf0, 0x35, 0x3e, 0x8f, 0xbb, 0x7e, 0xdf, 0xc2, 0x06, 0x25,
+  0x59, 0xb2, 0xdd, 0xd9, 0x3c, 0xe9, 0x86, 0x71, 0x5f, 0xae, 0xa5, 0x1c, 0xef, 0x41, 0xeb, 0x5e,
+  0xc8, 0x69, 0xec, 0x4c, 0xdf, 0x2e, 0x8e, 0x8a, 0xbd, 0x54, 0xf1, 0xe5, 0x10, 0x63, 0xe2, 0xe1,
+  0x10, 0x6c, 0x43, 0x7b, 0x63, 0x74, 0xab, 0xf6, 0x56, 0xab, 0xfe, 0x32, 0x2e, 0x33, 0x96, 0x24,
+  0x91, 0x71, 0xf7, 0x10, 0x6a, 0xcb, 0xae, 0xea, 0xc5, 0x98, 0x25, 0x05, 0x26, 0x4d, 0xd4, 0xfc,
+  0x0a, 0xf3, 0x70, 0x1d, 0x21, 0x14, 0x61, 0xde, 0x1c, 0x41, 0x96, 0x0b, 0x13, 0xb3, 0x50, 0xb7,
+  0x7a, 0x96, 0xad, 0x77, 0xe5, 0x06, 0xd8, 0xab, 0x64, 0x20, 0x72, 0x62, 0x05, 0x39, 0x3c, 0x4f,
+  0x4c, 0xcf, 0xda, 0x95, 0x2b, 0x3f, 0xe9, 0x39, 0x65, 0xd4, 0x5b, 0x3a, 0x3b, 0xa1, 0x04, 0x3b,
+  0x66, 0x96, 0x3b, 0xac, 0xd8, 0x43, 0xaa, 0x28, 0x3e, 0x3c, 0x5d, 0x87, 0xb9, 0xc7, 0x2d, 0x87,
+  0x4c, 0x9e, 0x72, 0xa3, 0x2a, 0x4b, 0x8a, 0xc2, 0xef, 0x65, 0xbe, 0xeb, 0xc5, 0xdd, 0xd4, 0x3f,
+  0x78, 0xc7, 0xe5, 0xe1, 0xb8, 0x67, 0x8b, 0x7d, 0x90, 0x4d, 0x50, 0x3a, 0x03, 0xf5, 0x6a, 0xaf,
+  0x9f, 0xa4, 0xc6, 0x01, 0x19, 0x1a, 0x47, 0x74, 0x53, 0x01, 0x38, 0x50, 0x40, 0x0c, 0x0b, 0x77,
+  0xb9, 0x2e, 0x22, 0xcc, 0xaf, 0x39, 0x0f, 0x21, 0x07, 0xa2, 0xb8, 0x01, 0xda, 0x1a, 0x27, 0x3a,
+  0xc0, 0x7e, 0xe0, 0x0f, 0x18, 0xdd, 0x98, 0x54, 0xe8, 0xef, 0x17, 0x91, 0x5b, 0x1b, 0x3a, 0x1b,
+  0xfb, 0xbb, 0xb9, 0xb2, 0x4e, 0x6b, 0x3b, 0x81, 0x54, 0x2d, 0x66, 0x92, 0xdd, 0xdc, 0x95, 0x47,
+  0xcb, 0xf9, 0xd4, 0x90, 0xa1, 0x59, 0x60, 0x04, 0xfa, 0x06, 0x45, 0x87, 0xd4, 0x64, 0x20, 0xdb,
+  0x4c, 0xd7, 0x32, 0xf2, 0xb2, 0xbf, 0x4e, 0x2c, 0x34, 0xee, 0x8e, 0xa0, 0xf5, 0x5a, 0xc2, 0x24,
+  0x69, 0xed, 0x8c, 0x4a, 0x35, 0xdb, 0x2b, 0x2b, 0x78, 0xda, 0x23, 0xf8, 0x9c, 0x00, 0x48, 0xe7,
+  0x81, 0xf8, 0xc6, 0xcb, 0xf4, 0xf4, 0xa5, 0x2b, 0xc5, 0x5e, 0x34, 0x48, 0x70, 0x5c, 0xed, 0xce,
+  0x45, 0x89, 0x94, 0x17, 0xd4, 0xa1, 0x20, 0x08, 0x7a, 0xcd, 0xd5, 0x05, 0x55, 0x6c, 0x50, 0x5f,
+  0x59, 0xe5, 0x9b, 0x6e, 0x2c, 0x29, 0x64, 0xb9, 0xea, 0x8e, 0x89, 0xad, 0x90, 0x61, 0x36, 0x91,
+  0xaa, 0x8e, 0xbf, 0x64, 0x41, 0x18, 0xb0, 0xec, 0x42, 0x26, 0xd2, 0xbd, 0xec, 0xa3, 0x3d, 0x9c,
+  0xd0, 0x91, 0x44, 0x65, 0x04, 0x83, 0x71, 0x0f, 0x7d, 0x0e, 0x8a, 0x9c, 0x1c, 0xda, 0xba, 0x24,
+  0x61, 0xa4, 0xc9, 0x30, 0x2a, 0xd4, 0x62, 0x0c, 0xed, 0x4d, 0x96, 0x6d, 0x34, 0x3d, 0x01, 0xa5,
+  0xfc, 0x62, 0xbf, 0x77, 0x99, 0x1d, 0x5b, 0xe5, 0xba, 0x4c, 0x4c, 0x84, 0x05, 0xbc, 0xdc, 0x13,
+  0x74, 0x38, 0xc1, 0x35, 0xb0, 0xb7, 0x25, 0x65, 0xac, 0x37, 0x17, 0x96, 0xbd, 0xd9, 0x9e, 0x53,
+  0x25, 0x8d, 0xc6, 0xaa, 0x82, 0x85, 0x16, 0x09, 0xbf, 0xf3, 0x1c, 0x7f, 0x6f, 0xf7, 0x49, 0x96,
+  0xb0, 0x91, 0xba, 0x3c, 0x1c, 0xf6, 0xbd, 0x8d, 0x42, 0x13, 0xd5, 0x60, 0xaa, 0x0d, 0x90, 0x4a,
+  0xa8, 0x15, 0xf3, 0x90, 0x46, 0x1e, 0xc7, 0xeb, 0xfd, 0xa6, 0xae, 0xc2, 0x1a, 0x12, 0x8e, 0x3b,
+  0x82, 0xd7, 0xa3, 0x62, 0xb3, 0x5f, 0xda, 0xc6, 0x66, 0x7b, 0x18, 0x73, 0x10, 0xc5, 0x00, 0x0b,
+  0x69, 0x99, 0xae, 0x15, 0xfa, 0x8a, 0x3a, 0x78, 0x95, 0xb4, 0x33, 0xb8, 0xd6, 0x0f, 0x72, 0xc8,
+  0x00, 0x6b, 0x20, 0x25, 0x4a, 0x32, 0x97, 0x09, 0x39, 0x0d, 0x51, 0x93, 0x6e, 0x30, 0xf6, 0xec,
+  0xe1, 0x14, 0x26, 0x66, 0x14, 0x8f, 0xee, 0xa8, 0x09, 0x4e, 0x8e, 0x46, 0x34, 0xd1, 0x9a, 0x1d,
+  0xec, 0x1b, 0x14, 0x14, 0x2a, 0xfa, 0x16, 0x7e, 0x48, 0xd2, 0xde, 0x4c, 0x94, 0xd3, 0x9a, 0x4b,
+  0x1b, 0x03, 0xdd, 0xf5, 0x57, 0xb6, 0x08, 0x96, 0x31, 0x9a, 0x8e, 0xe6, 0x62, 0xc8, 0xc7, 0xa3,
+  0xca, 0x15, 0x70, 0xa8, 0xa9, 0x94, 0x62, 0x29, 0x95, 0x48, 0x33, 0xe2, 0x4d, 0x8a, 0x34, 0xb0,
+  0x12, 0x36, 0x49, 0x66, 0x12, 0x71, 0x6a, 0x10, 0x69, 0x7d, 0x97, 0x97, 0x17, 0x2b, 0x50, 0x3e,
+  0xc5, 0x63, 0x6b, 0xdd, 0x1d, 0x60, 0x1a, 0x9e, 0xcb, 0xda, 0xea, 0x58, 0xc3, 0x7d, 0x49, 0xd2,
+  0x40, 0xbd, 0xcd, 0x11, 0x4e, 0x1f, 0x6c, 0xcf, 0xb0, 0x39, 0xe4, 0x9b, 0xa8, 0x83, 0xa9, 0x49,
+  0x65, 0x7a, 0x90, 0x16, 0xa6, 0x60, 0x99, 0x4d, 0x44, 0x0a, 0x12, 0x32, 0x3d, 0xb0, 0xe9, 0x54,
+  0x1d, 0x7a, 0x05, 0x65, 0x14, 0x99, 0xb9, 0xb2, 0xca, 0x5c, 0x99, 0x55, 0x91, 0x16, 0x13, 0x0d,
+  0x56, 0x58, 0xba, 0xa7, 0x2c, 0x32, 0x91, 0x63, 0x55, 0xb4, 0xe9, 0xfa, 0x36, 0xb3, 0xad, 0x95,
+  0xc1, 0x34, 0x37, 0x1b, 0x59, 0xb0, 0x2d, 0x66, 0x9f, 0x79, 0xa8, 0x47, 0x2c, 0xb4, 0xa0, 0x98,
+  0xb2, 0xec, 0x81, 0xca, 0x9a, 0x70, 0x73, 0x2c, 0xb4, 0xed, 0xb2, 0x5e, 0xcd, 0x45, 0x0f, 0xe1,
+  0x22, 0x49, 0x35, 0xf8, 0x55, 0xb2, 0xc5, 0xd0, 0xd8, 0x2a, 0x72, 0x65, 0x5c, 0xa5, 0xf1, 0x38,
+  0x8d, 0xf7, 0xf8, 0x0e, 0x5b, 0xb9, 0x4d, 0xe9, 0x7b, 0xbb, 0x1e, 0xbc, 0x1b, 0x66, 0x04, 0x29,
+  0x07, 0x75, 0xd9, 0xcc, 0xc9, 0x70, 0x23, 0xf4, 0x7c, 0x7e, 0x90, 0x28, 0x64, 0x2a, 0xed, 0x63,
+  0xb8, 0xdf, 0x33, 0x84, 0x21, 0xa8, 0x85, 0xe8, 0x44, 0x17, 0x0f, 0xf1, 0xda, 0x1c, 0x8d, 0x77,
+  0xac, 0x23, 0x4f, 0x8f, 0x82, 0x8f, 0xcc, 0x67, 0x1e, 0x1b, 0x4c, 0x57, 0xd2, 0x71, 0x68, 0x1f,
+  0x65, 0x66, 0xb0, 0xc0, 0x91, 0x4c, 0x48, 0x62, 0x04, 0x36, 0x77, 0x8a, 0xbb, 0xe0, 0xd7, 0x03,
+  0x44, 0x9e, 0xd9, 0xc7, 0xc4, 0x1d, 0x22, 0x07, 0x4c, 0xa6, 0xf9, 0x40, 0x53, 0xab, 0x63, 0x50,
+  0x83, 0xf5, 0x56, 0x0b, 0x05, 0x6a, 0x45, 0x1e, 0xc8, 0x41, 0x01, 0x91, 0x07, 0x35, 0x94, 0x7c,
+  0x32, 0x19, 0x88, 0xd8, 0xd2, 0x30, 0x11, 0x43, 0xce, 0x70, 0x62, 0x3c, 0xef, 0x8e, 0xfb, 0x07,
+  0xa6, 0x27, 0xf0, 0x19, 0x2d, 0xd8, 0xeb, 0x35, 0xda, 0x23, 0xf0, 0x23, 0x53, 0x33, 0xdd, 0x54,
+  0xd5, 0xec, 0x09, 0xc6, 0xd4, 0x99, 0xa6, 0x60, 0x72, 0xd9, 0x6c, 0x87, 0x91, 0x4e, 0xd5, 0xdc,
+  0x58, 0x40, 0xf0, 0x1e, 0xc8, 0xea, 0xe6, 0x91, 0xd8, 0x73, 0x14, 0xb4, 0x3f, 0xb2, 0x06, 0x36,
+  0x6a, 0x10, 0x23, 0x57, 0xed, 0x46, 0x1a, 0x88, 0x78, 0x7f, 0xc6, 0x2e, 0xfa, 0x13, 0xd3, 0xe6,
+  0x4c, 0x5a, 0xe2, 0x12, 0x2d, 0x16, 0xf7, 0x13, 0x80, 0x41, 0x9d, 0x1f, 0xe5, 0x9c, 0x96, 0xed,
+  0x0d, 0x25, 0xd3, 0xc2, 0x8e, 0x1e, 0x4c, 0xd2, 0xb1, 0x9a, 0xce, 0xd5, 0xa8, 0xcb, 0xd0, 0x8b,
+  0x10, 0xd9, 0x4f, 0x88, 0xf9, 0xc6, 0x24, 0xfa, 0x63, 0xbd, 0x22, 0xd9, 0x84, 0x1c, 0x81, 0xbc,
+  0x70, 0xe0, 0x48, 0x7e, 0x7a, 0xac, 0x9a, 0xe5, 0x91, 0xb2, 0xfb, 0x72, 0xb8, 0xa5, 0x33, 0x1d,
+  0xdb, 0x94, 0x12, 0x8a, 0x6b, 0x72, 0x96, 0x4c, 0x03, 0x31, 0xe3, 0xd1, 0x52, 0x65, 0xe9, 0x62,
+  0x8a, 0xb1, 0xb9, 0xc4, 0x92, 0x2a, 0xb9, 0xc9, 0x6b, 0x06, 0xd6, 0xea, 0x21, 0xb2, 0x09, 0x86,
+  0x47, 0x51, 0xef, 0x5a, 0x8b, 0xd1, 0x7a, 0x0d, 0xd6, 0xd4, 0x94, 0xe5, 0xa1, 0x71, 0x3a, 0xeb,
+  0xcd, 0x63, 0x91, 0xa4, 0x51, 0x0a, 0xe2, 0xad, 0x39, 0x6c, 0xa0, 0x7a, 0x01, 0x11, 0xcc, 0xba,
+  0xd7, 0x8b, 0x8b, 0x84, 0xcf, 0x22, 0xdc, 0x87, 0xf7, 0x88, 0x0c, 0xa9, 0xea, 0x06, 0x9f, 0x17,
+  0x28, 0x0a, 0xd5, 0xa3, 0x18, 0x52, 0x43, 0x9c, 0x1b, 0x0c, 0x87, 0x56, 0x88, 0x69, 0x1a, 0x34,
+  0x9e, 0x87, 0x83, 0xc4, 0xb2, 0x4b, 0x78, 0xcc, 0x1c, 0xd3, 0x12, 0x96, 0x4c, 0x12, 0xa2, 0xd1,
+  0x34, 0xe5, 0xb0, 0x60, 0x0b, 0x6a, 0xb2, 0xc3, 0x9b, 0x65, 0x88, 0x9d, 0xa3, 0x31, 0x04, 0x4a,
+  0xe3, 0x01, 0x16, 0x42, 0x23, 0x3d, 0xb1, 0x7a, 0x8b, 0x8d, 0x36, 0xde, 0x59, 0x59, 0x03, 0x39,
+  0x85, 0x74, 0xdc, 0x21, 0x62, 0xa0, 0x86, 0x81, 0xab, 0xae, 0xe9, 0x19, 0x33, 0xad, 0xc6, 0xa4,
+  0xad, 0x64, 0xdc, 0x7a, 0xa3, 0x39, 0x49, 0x62, 0x5b, 0xb0, 0x0a, 0xb6, 0x1e, 0xbd, 0x4c, 0x20,
+  0x85, 0xe9, 0xca, 0xa5, 0xa4, 0x48, 0x5d, 0xea, 0x2b, 0x3a, 0x1c, 0xe9, 0xd9, 0x1e, 0xaa, 0x23,
+  0x37, 0xdb, 0x34, 0x81, 0x0b, 0x36, 0xc0, 0x39, 0x55, 0x28, 0x14, 0x1d, 0x88, 0x54, 0x12, 0xf5,
+  0xa4, 0xbe, 0x65, 0x27, 0xcb, 0xc4, 0x76, 0x4c, 0x74, 0x9d, 0xe9, 0x04, 0x89, 0xf1, 0x3c, 0x6a,
+  0xa3, 0x8d, 0x13, 0xe9, 0xfc, 0xc8, 0x18, 0x74, 0x71, 0x2e, 0xc8, 0x7b, 0xfc, 0xbc, 0x4f, 0xa2,
+  0x02, 0x9d, 0x2f, 0xec, 0x2e, 0xa5, 0x68, 0x95, 0x15, 0x25, 0x86, 0xbe, 0x4c, 0xf6, 0x28, 0x61,
+  0x72, 0x53, 0x5b, 0xdc, 0xa0, 0x7b, 0x8c, 0x92, 0xfb, 0x3e, 0x22, 0x29, 0x71, 0x6f, 0x3f, 0xd7,
+  0xb2, 0xa3, 0x97, 0x79, 0x75, 0xa1, 0x83, 0x65, 0x09, 0x2e, 0x9c, 0x26, 0xd4, 0xd1, 0xc0, 0x3f,
+  0x4c, 0x33, 0xb6, 0x41, 0x35, 0x94, 0x98, 0xd8, 0x63, 0xaf, 0x9e, 0xb1, 0x76, 0x74, 0x84, 0x2b,
+  0x2b, 0x05, 0xf5, 0x9e, 0xb9, 0xea, 0x83, 0xc8, 0x87, 0x84, 0xad, 0x36, 0x95, 0x79, 0xcf, 0x53,
+  0x27, 0x99, 0x0a, 0xca, 0x4d, 0xa1, 0xa0, 0x46, 0xb6, 0x8c, 0xa1, 0x75, 0xbe, 0x51, 0xa4, 0x69,
+  0xe0, 0x2c, 0xd6, 0xea, 0x34, 0x58, 0x0c, 0x78, 0x32, 0x08, 0x70, 0x6b, 0xba, 0x89, 0x26, 0x63,
+  0xe0, 0x7a, 0xba, 0xc4, 0xc6, 0x03, 0x81, 0xe9, 0x81, 0x4d, 0x2d, 0xbe, 0x69, 0xcc, 0xa3, 0x3b,
+  0x08, 0xe8, 0x42, 0x1b, 0x55, 0xfc, 0xa1, 0x6a, 0x86, 0x1e, 0xea, 0x1c, 0x95, 0x85, 0x3e, 0x82,
+  0xed, 0xf1, 0x98, 0x21, 0x49, 0xb0, 0x69, 0xaa, 0x12, 0x14, 0x25, 0xd1, 0x0d, 0x3f, 0x9c, 0x21,
+  0x1e, 0x17, 0x0c, 0x89, 0xc1, 0xb8, 0xbf, 0x03, 0xfb, 0x1b, 0xcf, 0x23, 0x3d, 0x54, 0xaf, 0x53,
+  0x6d, 0xd9, 0xc8, 0xec, 0x2a, 0x56, 0xc5, 0xf9, 0x68, 0x33, 0x57, 0x32, 0x75, 0x4d, 0xce, 0x45,
+  0x41, 0x2f, 0x66, 0xf0, 0x8c, 0x22, 0xfa, 0x7e, 0x81, 0xc7, 0x6b, 0x01, 0x19, 0x6f, 0xf0, 0x78,
+  0x42, 0x04, 0x2b, 0xc6, 0x5d, 0xe9, 0x42, 0x33, 0xe5, 0x5d, 0xfa, 0x38, 0xf2, 0x12, 0x64, 0x91,
+  0xa4, 0xca, 0x4c, 0x8f, 0x4b, 0xa2, 0x1f, 0xa6, 0x4e, 0xe1, 0xd9, 0x2e, 0x2b, 0x94, 0xb9, 0x06,
+  0xa9, 0x81, 0x85, 0x9a, 0x7b, 0xac, 0x39, 0x0e, 0x23, 0x9c, 0x24, 0x26, 0xb4, 0x37, 0x88, 0x74,
+  0xd3, 0x84, 0x82, 0xd8, 0x81, 0xf0, 0x06, 0xe4, 0xb9, 0xf1, 0x0e, 0xc2, 0x27, 0xd0, 0x21, 0x49,
+  0xe2, 0xae, 0x97, 0x8e, 0xa7, 0x33, 0x67, 0x46, 0x73, 0x43, 0xc3, 0x4b, 0xeb, 0x82, 0xc3, 0xec,
+  0x9e, 0xe6, 0xe2, 0x43, 0x3f, 0x17, 0x4a, 0xa6, 0x3b, 0x93, 0xf2, 0x6d, 0x6c, 0xca, 0x3c, 0x57,
+  0x51, 0xdd, 0xea, 0x38, 0x8c, 0x39, 0x9b, 0xd6, 0xb6, 0xd4, 0x61, 0x84, 0x97, 0xe8, 0xd0, 0x54,
+  0x63, 0x49, 0xeb, 0x23, 0x2b, 0x07, 0x5a, 0x0f, 0x52, 0xad, 0x26, 0x05, 0xdc, 0xa3, 0x77, 0xeb,
+  0xb5, 0x40, 0xb3, 0xba, 0xea, 0x1e, 0x27, 0x3d, 0x19, 0xf7, 0x84, 0xf5, 0x26, 0x0e, 0xbd, 0x15,
+  0x28, 0xf3, 0x0b, 0xea, 0x60, 0x62, 0xdd, 0x99, 0x5f, 0x0f, 0xe0, 0xa4, 0x61, 0xea, 0x41, 0xac,
+  0x33, 0x7b, 0x65, 0xbd, 0x74, 0x4c, 0x4d, 0x41, 0x54, 0x5c, 0x43, 0x0b, 0x36, 0x29, 0xd8, 0x55,
+  0x41, 0x8c, 0x93, 0xa5, 0x5b, 0x4b, 0xa8, 0x70, 0xe8, 0xba, 0x7b, 0x72, 0xb6, 0xdf, 0x88, 0x53,
+  0x1f, 0x5e, 0x49, 0x29, 0xbd, 0x69, 0x2a, 0xc2, 0x09, 0xb5, 0xb9, 0x42, 0x98, 0x33, 0x95, 0xf0,
+  0x28, 0x5a, 0x2b, 0x55, 0xdc, 0x14, 0x33, 0xaa, 0xc9, 0x4b, 0xbf, 0x58, 0x20, 0x29, 0x5a, 0x70,
+  0x28, 0x1e, 0x60, 0x2e, 0x23, 0xfa, 0x0a, 0x6c, 0xe0, 0xce, 0x98, 0x84, 0x27, 0xfc, 0x81, 0x1d,
+  0xc2, 0xba, 0x27, 0x77, 0x6b, 0x42, 0x5d, 0xc7, 0x74, 0xc6, 0x64, 0x8e, 0x0c, 0x23, 0x5b, 0x34,
+  0x0a, 0x1a, 0x7e, 0x22, 0x1d, 0x15, 0xaa, 0x3c, 0x96, 0x3a, 0x4b, 0xaf, 0x4d, 0x4f, 0xd7, 0x2a,
+  0x98, 0x44, 0x54, 0x04, 0x54, 0x43, 0xe1, 0xbc, 0xe1, 0x5d, 0x82, 0xa8, 0xf4, 0xb5, 0xee, 0x3b,
+  0xbb, 0xa9, 0x9f, 0x43, 0xeb, 0xc2, 0x4e, 0x89, 0x4a, 0x88, 0x06, 0x98, 0x9c, 0x97, 0xc5, 0xd4,
+  0x4a, 0x07, 0xe4, 0x62, 0x35, 0x94, 0xf7, 0x19, 0xb6, 0xc1, 0x15, 0xb9, 0xca, 0x0f, 0x7b, 0x11,
+  0x0e, 0x40, 0xca, 0xca, 0x7a, 0x01, 0xbb, 0xa8, 0x91, 0x7c, 0x2d, 0xf8, 0x65, 0x89, 0xf7, 0xa5,
+  0x82, 0x94, 0x49, 0x4e, 0xd8, 0xd9, 0xd5, 0xb0, 0x6e, 0x44, 0x7e, 0x20, 0xae, 0x47, 0x04, 0x33,
+  0xc0, 0xa7, 0x5d, 0x1d, 0xee, 0xfb, 0xb2, 0xb1, 0x87, 0xf5, 0x9d, 0x33, 0x01, 0x5c, 0x2e, 0x0e,
+  0x14, 0xb6, 0xdc, 0x4f, 0x91, 0xb8, 0x1f, 0xfa, 0xb9, 0x8f, 0x95, 0x29, 0xc2, 0x6c, 0x77, 0x0d,
+  0x68, 0x8e, 0x89, 0x0a, 0x5f, 0xcd, 0xe5, 0x6d, 0x03, 0xab, 0x1e, 0x95, 0x2d, 0xbd, 0xa1, 0xde,
+  0xf5, 0xe3, 0x09, 0x3f, 0xe9, 0x17, 0x8e, 0xa3, 0xae, 0x16, 0xb9, 0xb2, 0x89, 0x92, 0xf9, 0x9c,
+  0x29, 0xc4, 0x39, 0x7f, 0xd0, 0x8c, 0xae, 0xe4, 0xc9, 0x99, 0xa6, 0x93, 0xc7, 0x7d, 0x94, 0x25,
+  0x9a, 0xdd, 0x5b, 0xea, 0x6b, 0x7f, 0xd5, 0x78, 0xf2, 0x02, 0x57, 0x0e, 0x07, 0x3a, 0x35, 0xd0,
+  0xcd, 0x22, 0x8d, 0xe2, 0x5d, 0x83, 0x78, 0x72, 0xc1, 0x37, 0x93, 0x7c, 0x38, 0xc5, 0x0f, 0xa3,
+  0x7a, 0x9e, 0x28, 0x48, 0xed, 0x38, 0x42, 0x58, 0x40, 0x91, 0xef, 0xf6, 0x07, 0x19, 0x33, 0x24,
+  0x75, 0x75, 0xe7, 0x6c, 0xa1, 0x5c, 0xb4, 0x76, 0x23, 0xc6, 0xe2, 0x69, 0x79, 0x11, 0xec, 0x50,
+  0x91, 0xaf, 0x74, 0xa4, 0x1a, 0x0e, 0x87, 0x65, 0x39, 0x72, 0x96, 0x68, 0xb7, 0x12, 0xd2, 0xd9,
+  0x66, 0xbb, 0x5e, 0xa9, 0xe8, 0xda, 0x1e, 0x92, 0x0a, 0xd6, 0x80, 0xcd, 0xe2, 0xb0, 0xd2, 0x29,
+  0x3d, 0xce, 0x77, 0x5a, 0x41, 0x61, 0xdc, 0xae, 0xc7, 0x1b, 0xc1, 0x2c, 0xa1, 0x36, 0xc1, 0x8e,
+  0xa7, 0xe3, 0x51, 0x83, 0x4a, 0xe8, 0x4e, 0x06, 0x0b, 0x8f, 0xc5, 0x63, 0x99, 0xe4, 0x6d, 0x65,
+  0x09, 0xdd, 0xd6, 0xaa, 0x4f, 0x8a, 0xa2, 0x4c, 0xbb, 0x23, 0xf5, 0x00, 0x6d, 0x43, 0xb0, 0x99,
+  0x8a, 0xc6, 0xd1, 0x9b, 0xb2, 0x78, 0x97, 0x65, 0x91, 0xbd, 0x90, 0xe5, 0xed, 0xfb, 0x2d, 0x0a,
+  0xc7, 0xcd, 0xa7, 0x54, 0x06, 0x86, 0xd6, 0x93, 0xb6, 0xf9, 0xf6, 0xbf, 0x33, 0xff, 0xbd, 0x4d,
+  0x08, 0x42, 0xd7, 0x0f, 0x0f, 0xbf, 0x7d, 0x90, 0x22, 0x37, 0xce, 0x27, 0x45, 0x9e, 0x0f, 0x8a,
+  0x7c, 0x3e, 0x9f, 0x8c, 0x79, 0x3c, 0x84, 0x72, 0x79, 0xba, 0xdc, 0x21, 0x39, 0x1f, 0xef, 0xb1,
+  0xcd, 0xfc, 0x36, 0xcb, 0x5d, 0xdf, 0xff, 0xf0, 0x65, 0xda, 0x9e, 0xb1, 0xf8, 0x0c, 0x9d, 0x87,
+  0x01, 0xa5, 0xdc, 0xf8, 0x27, 0x48, 0x9d, 0x90, 0x5e, 0xee, 0x69, 0x3d, 0x1e, 0x1a, 0x12, 0xdb,
+  0x2b, 0x6c, 0x7f, 0x2f, 0xe2, 0xf3, 0x38, 0xf8, 0x93, 0xfe, 0xbd, 0x27, 0x64, 0xda, 0xe3, 0x2b,
+  0x4f, 0xf3, 0xfe, 0x31, 0x25, 0xa0, 0x67, 0x25, 0x58, 0x51, 0x5a, 0xa9, 0xa9, 0xf1, 0xa1, 0x13,
+  0x85, 0xba, 0xef, 0xea, 0x07, 0x30, 0x59, 0x4d, 0xaf, 0x90, 0xeb, 0x4f, 0x1f, 0xbe, 0x30, 0x4b,
+  0x41, 0xa6, 0x04, 0xfa, 0x35, 0xf7, 0xbf, 0x83, 0xcd, 0x7f, 0x82, 0xbb, 0xbc, 0x48, 0xc3, 0xf6,
+  0xd8, 0xdc, 0x1b, 0xf6, 0xd0, 0x96, 0x3d, 0x6e, 0xcc, 0x6c, 0x7e, 0xaf, 0xc9, 0xbe, 0x47, 0x1a,
+  0xff, 0x70, 0x3e, 0xd3, 0x15, 0xc5, 0x6f, 0xa8, 0x62, 0x2d, 0x55, 0x71, 0xb3, 0x5c, 0xfd, 0x2b,
+  0xa8, 0xbe, 0x10, 0xf8, 0x74, 0xb2, 0xee, 0x0d, 0x6d, 0xbc, 0xa5, 0x2d, 0x4c, 0x27, 0xec, 0x1b,
+  0x91, 0xff, 0x41, 0x2b, 0xfc, 0x77, 0x69, 0xe8, 0xc4, 0x6b, 0x7b, 0xae, 0xf0, 0x2f, 0x51, 0xf8,
+  0xa1, 0xf3, 0xcc, 0xaa, 0xd5, 0x5e, 0x5a, 0xbd, 0x32, 0x22, 0xbd, 0x08, 0x00, 0x9e, 0x3b, 0x3f,
+  0xd2, 0x4f, 0x97, 0x61, 0xef, 0x22, 0x20, 0x93, 0x1b, 0x76, 0x3f, 0x42, 0x97, 0xc3, 0x60, 0xbf,
+  0x96, 0x6a, 0xfa, 0x70, 0x99, 0xff, 0xe7, 0x52, 0xf5, 0x1f, 0x90, 0x8f, 0x40, 0xc0, 0x4f, 0x5f,
+  0xa8, 0xed, 0x66, 0xd9, 0x59, 0xf2, 0xff, 0x42, 0x05, 0xb7, 0xa7, 0x79, 0xbf, 0xe3, 0xf0, 0xc4,
+  0x49, 0xbf, 0xed, 0x89, 0x32, 0x71, 0xfc, 0xaf, 0x71, 0xaa, 0x17, 0x2a, 0xb3, 0xac, 0x0f, 0xbf,
+  0x4b, 0x65, 0x96, 0x75, 0xd2, 0x19, 0xdc, 0xea, 0xec, 0xa2, 0x32, 0x86, 0xf9, 0x9e, 0x5f, 0xfc,
+  0x37, 0xa7, 0x8c, 0x8b, 0x10, 0x16, 0x18, 0x72, 0xfe, 0x59, 0x09, 0x4e, 0x93, 0x9f, 0x4d, 0xfe,
+  0x85, 0xe1, 0x28, 0x91, 0x7d, 0x67, 0xf2, 0x9f, 0x66, 0x99, 0xff, 0x2e, 0x31, 0x7e, 0x87, 0x2d,
+  0x1e, 0xe7, 0xbf, 0xb0, 0xc5, 0x45, 0x98, 0x77, 0xc6, 0xf8, 0x67, 0x72, 0x26, 0xf4, 0xfd, 0x43,
+  0x8b, 0x6f, 0xce, 0xa0, 0x7e, 0x1f, 0xc1, 0xab, 0x83, 0xb4, 0x3f, 0x20, 0x71, 0x3e, 0x21, 0xfa,
+  0xe2, 0xe0, 0xeb, 0xe9, 0xcc, 0xfd, 0x8b, 0x43, 0x9a, 0x9f, 0x4f, 0x57, 0x25, 0x3a, 0xa7, 0xcb,
+  0x34, 0x1f, 0x4e, 0xb7, 0x69, 0x3e, 0x74, 0x02, 0x17, 0xe8, 0x18, 0x01, 0x9f, 0x6a, 0x0d, 0x3e,
+  0x61, 0xf8, 0x43, 0x07, 0x08, 0x5f, 0x80, 0x71, 0x02, 0xfe, 0xf0, 0x0a, 0x4f, 0x7a, 0xd6, 0x71,
+  0xd0, 0x08, 0xa7, 0x89, 0x5f, 0xce, 0x6c, 0xff, 0xf6, 0xc9, 0xd1, 0xf3, 0xc4, 0xec, 0x0d, 0xa2,
+  0x9f, 0x9c, 0x1b, 0xfd, 0xf1, 0xd9, 0xce, 0xef, 0x38, 0xc9, 0x97, 0x45, 0x94, 0x47, 0x69, 0x47,
+  0x8c, 0x4d, 0xd3, 0xb8, 0xff, 0x81, 0xeb, 0xb4, 0x5f, 0x26, 0x91, 0xc5, 0x2a, 0xe8, 0x40, 0xbf,
+  0xaf, 0x83, 0x13, 0xab, 0x2d, 0x86, 0x8b, 0x3a, 0xe0, 0x8b, 0x3a, 0x50, 0x82, 0x78, 0x52, 0x07,
+  0xda, 0xaa, 0x06, 0xb8, 0x95, 0xd3, 0x4e, 0x01, 0x59, 0x3d, 0x6d, 0xbe, 0xfe, 0x43, 0xbe, 0x75,
+  0xc2, 0x7f, 0x72, 0xac, 0x8f, 0xdd, 0xdc, 0x71, 0xb3, 0xbb, 0x13, 0xde, 0xeb, 0x4f, 0xdf, 0xc0,
+  0x24, 0x80, 0xc5, 0xbc, 0xfe, 0xfa, 0xed, 0xc3, 0xdf, 0xe9, 0x5b, 0xdf, 0x53, 0x83, 0xe4, 0x1a,
+  0x9d, 0x75, 0xa1, 0x9e, 0xee, 0xd0, 0xfe, 0x1e, 0x35, 0x24, 0x67, 0x1c, 0x8f, 0x7e, 0xf1, 0xa8,
+  0x89, 0x1e, 0xf6, 0xa4, 0x08, 0xe4, 0xf7, 0xe9, 0xe1, 0x42, 0xe0, 0x5f, 0xab, 0x09, 0xb1, 0xbd,
+  0x8d, 0xf3, 0x7b, 0xd4, 0x60, 0xa5, 0x6a, 0x60, 0xb6, 0x77, 0x7a, 0xde, 0x78, 0x44, 0xef, 0x39,
+  0x3c, 0x7e, 0x97, 0x16, 0x9e, 0xf0, 0xff, 0x7d, 0x7a, 0xf8, 0x07, 0xc4, 0xa7, 0xc0, 0x7a, 0xf2,
+  0xcf, 0x7b, 0xc2, 0xe9, 0x16, 0x95, 0x16, 0xd5, 0x97, 0xb5, 0xcd, 0x50, 0xe3, 0xf6, 0x1a, 0xd0,
+  0x53, 0xfc, 0x5e, 0xee, 0x4a, 0xdf, 0xaa, 0xa7, 0xe3, 0xea, 0xbf, 0x4b, 0x03, 0x8f, 0xb8, 0x2f,
+  0x0a, 0xb8, 0x3a, 0x69, 0xe0, 0x72, 0x89, 0xeb, 0x57, 0xe4, 0x1e, 0xbe, 0xfe, 0x07, 0x14, 0xf1,
+  0x0f, 0x24, 0xdb, 0xef, 0x67, 0xdb, 0xd7, 0xa7, 0xf1, 0xa1, 0xcb, 0x71, 0xfc, 0x2f, 0xef, 0xc7,
+  0x9f, 0xc7, 0x5e, 0xdc, 0x6a, 0x38, 0x9f, 0xa1, 0x7f, 0xea, 0x00, 0xd2, 0x75, 0xaa, 0xec, 0x21,
+  0x2c, 0x7c, 0xff, 0xa6, 0xca, 0x44, 0x33, 0x79, 0x78, 0x71, 0x21, 0xc3, 0x2a, 0xc2, 0xf3, 0x51,
+  0xff, 0x2a, 0x5b, 0xc6, 0x66, 0x78, 0x75, 0xfd, 0xb5, 0x05, 0x35, 0xab, 0x8e, 0x6c, 0x6a, 0x62,
+  0x04, 0x84, 0xcf, 0xaf, 0x3e, 0x56, 0xed, 0xd9, 0xf4, 0x8f, 0xdd, 0xf7, 0x8a, 0x74, 0xa2, 0x2c,
+  0x6f, 0xbf, 0xf9, 0xa7, 0xfb, 0xf1, 0xbe, 0x8f, 0x42, 0x60, 0x7d, 0xaa, 0xb2, 0x3b, 0xcd, 0x0d,
+  0xd5, 0xb4, 0xd9, 0xb4, 0xd6, 0xfb, 0xa8, 0xa6, 0xa9, 0xda, 0x68, 0x85, 0x65, 0x99, 0xe9, 0xc7,
+  0x76, 0xac, 0x5d, 0x05, 0xa3, 0xcc, 0x7c, 0x78, 0x24, 0x7a, 0xa1, 0x06, 0x18, 0xfb, 0x94, 0x99,
+  0xf9, 0xc6, 0x0d, 0xcc, 0xa8, 0xc8, 0xaf, 0xce, 0x9c, 0xdc, 0x80, 0xdc, 0x0f, 0x5f, 0x7f, 0xfb,
+  0xf6, 0x9e, 0xd3, 0xb6, 0x98, 0x8a, 0xe2, 0x9b, 0x53, 0x02, 0xbb, 0x09, 0xb2, 0xeb, 0xaf, 0xae,
+  0x05, 0xe6, 0xfc, 0xf9, 0xcf, 0x80, 0x00, 0xd8, 0x11, 0x19, 0x8d, 0xd8, 0x5e, 0x8a, 0x78, 0x78,
+  0x78, 0x40, 0xae, 0xbf, 0xb6, 0xa2, 0x1b, 0x27, 0x71, 0x68, 0x35, 0x57, 0x25, 0xd7, 0xac, 0xae,
+  0xda, 0x07, 0xaa, 0xe5, 0x6b, 0x78, 0xe2, 0xeb, 0xaa, 0x0f, 0x0c, 0x6b, 0xdc, 0x01, 0xf2, 0x5b,
+  0x37, 0xcc, 0xfb, 0x57, 0xf0, 0x4d, 0x14, 0xbf, 0xea, 0x40, 0xce, 0x84, 0xfe, 0xf6, 0x37, 0xf8,
+  0x45, 0x37, 0xd2, 0xbb, 0x42, 0x01, 0x69, 0xd0, 0x79, 0x93, 0xa7, 0x6d, 0x8c, 0x3c, 0x8d, 0x60,
+  0xe8, 0x15, 0x7e, 0xd3, 0xed, 0x9e, 0xf4, 0x7c, 0x19, 0x03, 0x7c, 0x65, 0x66, 0x68, 0x5c, 0x19,
+  0x77, 0x67, 0x55, 0x5c, 0x7f, 0x33, 0xfd, 0xcc, 0xfc, 0xc7, 0xbc, 0x13, 0xc8, 0x7c, 0x71, 0x4c,
+  0xc0, 0xde, 0x0b, 0xa5, 0x3c, 0x5a, 0xed, 0xd3, 0x4b, 0x8f, 0x78, 0x63, 0xff, 0x47, 0x87, 0xe8,
+  0x3c, 0xd1, 0x52, 0x0d, 0x63, 0x5c, 0x82, 0x06, 0xe7, 0x66, 0xb9, 0x09, 0x96, 0xbd, 0xab, 0x8f,
+  0xf4, 0x72, 0x31, 0x3a, 0xdf, 0xa7, 0xe4, 0x22, 0xd5, 0x30, 0x8d, 0x8f, 0x37, 0x2f, 0x6c, 0xf4,
+  0xa4, 0x79, 0xed, 0x6a, 0x78, 0xfd, 0xd5, 0x37, 0xf3, 0xce, 0xe8, 0xd3, 0xf9, 0xb2, 0xe9, 0xd5,
+  0xf0, 0xae, 0x8d, 0xd3, 0xeb, 0xaf, 0xba, 0x9a, 0x99, 0x1f, 0x1f, 0x83, 0xf5, 0xe3, 0xfd, 0xe8,
+  0x61, 0xf8, 0x32, 0x76, 0x3e, 0x69, 0xc0, 0x30, 0x87, 0x4f, 0x27, 0xa0, 0x53, 0x52, 0xfb, 0x78,
+  0x7f, 0x6a, 0x9f, 0x6f, 0x32, 0xde, 0x46, 0xa1, 0x79, 0x9e, 0x72, 0x4a, 0x38, 0x2f, 0x81, 0xcf,
+  0x25, 0xce, 0x23, 0x74, 0xa1, 0x05, 0x6e, 0xde, 0x42, 0x7e, 0x44, 0x3e, 0x5e, 0xa0, 0x2e, 0x09,
+  0xe0, 0x3e, 0x35, 0xdb, 0x6d, 0x0d, 0x88, 0xd0, 0x28, 0xcc, 0xf2, 0x0e, 0xfd, 0xf0, 0xd7, 0x3f,
+  0x7d, 0xd5, 0xbf, 0xbd, 0xd2, 0xe0, 0x9f, 0xbe, 0x0e, 0xef, 0x5c, 0xe3, 0xdb, 0x49, 0x8b, 0x7f,
+  0xfa, 0x3a, 0xfa, 0xf6, 0xd7, 0x4f, 0x67, 0x03, 0xd0, 0xd7, 0x77, 0xb9, 0x03, 0x54, 0x38, 0x7e,
+  0xf8, 0xf2, 0xb5, 0x9d, 0x1d, 0xf9, 0x26, 0xb0, 0x85, 0x7d, 0xf5, 0xd7, 0xd4, 0x4c, 0x0a, 0x13,
+  0x20, 0x03, 0xe9, 0xeb, 0x4f, 0x5f, 0xe9, 0x6f, 0x1d, 0xcb, 0x0d, 0xdd, 0xcc, 0x01, 0x2e, 0xd7,
+  0xc9, 0x80, 0x83, 0xb5, 0xf7, 0x9a, 0xfe, 0xf4, 0x75, 0x7c, 0x77, 0x6e, 0x7f, 0xfb, 0xeb, 0xf5,
+  0xb7, 0x17, 0x37, 0xd2, 0x5a, 0xb7, 0xd3, 0x1f, 0x7e, 0x64, 0xda, 0x4f, 0x67, 0x26, 0xcd, 0x87,
+  0x21, 0x20, 0x09, 0xf4, 0xd4, 0xa6, 0xb2, 0xd6, 0x12, 0xad, 0x59, 0xae, 0x3e, 0x9e, 0xaf, 0xe2,
+  0x7d, 0xbc, 0xfe, 0x76, 0x63, 0xbd, 0x03, 0x48, 0xcd, 0x20, 0x2a, 0xcd, 0x97, 0x30, 0xf6, 0xf7,
+  0x91, 0x3c, 0x7e, 0xa7, 0xc4, 0xc7, 0xeb, 0x9b, 0xe1, 0xd3, 0x17, 0x4c, 0x3c, 0xfc, 0x02, 0x7f,
+  0xbb, 0x71, 0x7e, 0x88, 0xf4, 0x07, 0x73, 0x90, 0x6f, 0x37, 0xee, 0xc3, 0xd5, 0xf0, 0x66, 0x74,
+  0x43, 0x5f, 0x83, 0x99, 0xf4, 0xc3, 0x2f, 0x57, 0x6d, 0xc0, 0xfe, 0xf2, 0x40, 0x5f, 0xff, 0xed,
+  0x6f, 0xf4, 0xa7, 0xd6, 0x1b, 0xc6, 0x9f, 0x9e, 0x4d, 0x0f, 0xe2, 0xee, 0xec, 0x13, 0xbf, 0x02,
+  0x8d, 0x3e, 0x39, 0xc1, 0xcd, 0xe8, 0xe1, 0x97, 0x5f, 0x46, 0x37, 0x4f, 0xcf, 0x0f, 0xa3, 0xeb,
+  0xfb, 0xd3, 0xf8, 0xc9, 0xe2, 0x37, 0x97, 0x4f, 0xd0, 0x7b, 0x43, 0xff, 0xf9, 0xcf, 0xe3, 0x5f,
+  0x1e, 0x1e, 0x46, 0xbf, 0xb6, 0xbe, 0x76, 0xff, 0x0b, 0x78, 0xbc, 0xfa, 0xa8, 0x9a, 0xfa, 0x19,
+  0xaf, 0x6b, 0xfc, 0x3a, 0xfa, 0xd5, 0xbc, 0x2a, 0xaf, 0xef, 0xad, 0xf6, 0xcf, 0x47, 0xd5, 0x7e,
+  0x39, 0x70, 0x65, 0x5d, 0xe5, 0xd7, 0x37, 0xe6, 0x55, 0x76, 0x0d, 0x90, 0x9b, 0x6d, 0xdb, 0x3a,
+  0xb5, 0x3f, 0xaa, 0x95, 0xf6, 0x17, 0x1b, 0xd4, 0x77, 0x2f, 0x60, 0xad, 0xab, 0xfa, 0xfa, 0xde,
+  0x6c, 0xff, 0x7c, 0xb4, 0x54, 0xdd, 0xfc, 0x4b, 0x0a, 0xca, 0x52, 0x3b, 0x04, 0xeb, 0xdf, 0x23,
+  0x0c, 0xa0, 0x3b, 0xfa, 0xd5, 0xb9, 0x0a, 0xaf, 0xef, 0x6d, 0xf0, 0xe7, 0xfa, 0xfa, 0xdb, 0x73,
+  0x84, 0x3d, 0xd9, 0x15, 0xf8, 0x47, 0xda, 0x88, 0x27, 0x1f, 0x8e, 0x52, 0xca, 0xf7, 0xaf, 0x3e,
+  0x9e, 0xef, 0x7c, 0x7e, 0xbc, 0xbe, 0xb3, 0xa2, 0x74, 0xac, 0xb6, 0xf1, 0x71, 0x52, 0xf6, 0x63,
+  0xf5, 0x7f, 0xd5, 0x6a, 0xd0, 0x04, 0x41, 0x73, 0xbe, 0xeb, 0xcf, 0x47, 0x86, 0x09, 0x82, 0x19,
+  0xf0, 0x79, 0xf2, 0xc4, 0xb3, 0xcf, 0x9e, 0x1d, 0xea, 0xaf, 0x17, 0xaf, 0x7c, 0x8a, 0x42, 0x10,
+  0x78, 0x67, 0x1f, 0xef, 0x0c, 0xef, 0xbc, 0xac, 0x0d, 0xcb, 0x6f, 0xdf, 0x01, 0xf9, 0x2d, 0xd6,
+  0x5e, 0xaf, 0x95, 0x2f, 0x78, 0x1c, 0x01, 0xa6, 0xdc, 0x2b, 0x60, 0x9d, 0xff, 0x1c, 0x01, 0xc1,
+  0xff, 0xeb, 0xe6, 0x17, 0xa4, 0x75, 0xe6, 0x17, 0x29, 0xe5, 0xec, 0xaf, 0xde, 0xb3, 0x43, 0xdb,
+  0x66, 0x3e, 0xf6, 0xcd, 0xb6, 0x39, 0x6c, 0xa6, 0xc0, 0xdd, 0xce, 0xaf, 0xa2, 0x80, 0xe3, 0x1c,
+  0x7e, 0x06, 0xf3, 0x5c, 0x6a, 0x03, 0x68, 0xff, 0xc7, 0xd0, 0x4f, 0x2f, 0xce, 0x00, 0x58, 0xf0,
+  0x63, 0xb0, 0x57, 0xaf, 0xc2, 0x00, 0x68, 0xf8, 0x63, 0xd0, 0x93, 0x99, 0xcd, 0x10, 0xa4, 0x83,
+  0x16, 0x67, 0xf4, 0x63, 0xc0, 0x97, 0x57, 0xf2, 0x00, 0x64, 0x7c, 0xb6, 0x5a, 0xe5, 0x86, 0x46,
+  0x54, 0xdd, 0xb5, 0xef, 0x6c, 0xae, 0x00, 0x4b, 0x77, 0x6e, 0x08, 0x64, 0x60, 0x37, 0x0b, 0xee,
+  0xe1, 0xe3, 0xe9, 0x05, 0xdc, 0xc7, 0x6f, 0x37, 0xc9, 0x19, 0xd2, 0xbb, 0x6b, 0x2f, 0x56, 0xb5,
+  0xc6, 0x6c, 0x97, 0x45, 0xe4, 0x63, 0x6b, 0xd2, 0x16, 0xd7, 0x5f, 0x81, 0x3b, 0x1e, 0xde, 0x4d,
+  0x8d, 0xe2, 0x8f, 0xdf, 0x3e, 0xf9, 0xaf, 0x3d, 0xa4, 0xa5, 0xf0, 0x8c, 0x05, 0xa4, 0x31, 0x50,
+  0x99, 0x14, 0xa9, 0xf9, 0xeb, 0x5f, 0x74, 0x0d, 0xa4, 0x2e, 0xb0, 0x92, 0x99, 0x77, 0x61, 0x54,
+  0x01, 0x0f, 0x38, 0xa3, 0xfc, 0x76, 0x13, 0xbd, 0x9f, 0x6f, 0x9e, 0x06, 0x82, 0xd7, 0x03, 0x67,
+  0x43, 0x0e, 0x2f, 0x74, 0x81, 0xa7, 0xbf, 0x60, 0xe6, 0xd3, 0xf0, 0x57, 0x30, 0xef, 0x3e, 0x01,
+  0x68, 0x6f, 0xc2, 0xd7, 0xd3, 0x34, 0x10, 0x01, 0xdf, 0x6e, 0xfe, 0x29, 0xdf, 0x7a, 0xf2, 0xff,
+  0x73, 0x59, 0xd6, 0xa2, 0x6b, 0x03, 0xfb, 0xbd, 0x77, 0xa5, 0x3f, 0x36, 0x48, 0x1b, 0xe5, 0xd7,
+  0x37, 0xd9, 0x6f, 0x02, 0x9c, 0xe2, 0xfb, 0xfc, 0x25, 0x4e, 0x00, 0x36, 0xff, 0x0d, 0xc7, 0x02,
+  0x70, 0xba, 0xe9, 0xfa, 0xed, 0x97, 0x47, 0x5d, 0xc0, 0x3f, 0xa5, 0xaf, 0x19, 0x04, 0xf2, 0xa6,
+  0xd7, 0x37, 0xe9, 0xd3, 0x02, 0xf6, 0x83, 0xbc, 0xf2, 0xed, 0x92, 0xc7, 0x8b, 0xdf, 0x60, 0xcc,
+  0x6c, 0x39, 0x2f, 0x7f, 0x13, 0xe0, 0x2f, 0xa7, 0xd4, 0xf7, 0xc4, 0x4b, 0xf1, 0x8e, 0x97, 0xe2,
+  0xfa, 0xa6, 0x78, 0xe2, 0xe5, 0x29, 0xf9, 0x3d, 0x52, 0xaf, 0x7e, 0x03, 0xf9, 0x63, 0xda, 0xbb,
+  0xbe, 0xa9, 0x7f, 0x0c, 0x05, 0x80, 0x02, 0x90, 0x87, 0x9e, 0x18, 0xa8, 0xde, 0x31, 0x50, 0x5d,
+  0xdf, 0x54, 0x4f, 0x0c, 0x3c, 0x25, 0xce, 0x47, 0x06, 0x9a, 0x9f, 0x84, 0x9c, 0x61, 0xe6, 0xc0,
+  0x51, 0x00, 0x0f, 0xc7, 0x9f, 0x00, 0x3e, 0xa7, 0xe0, 0xeb, 0x1b, 0xea, 0x37, 0x60, 0x1f, 0x77,
+  0x2a, 0x80, 0x57, 0xea, 0x1d, 0xaf, 0xd4, 0xf5, 0x0d, 0xf1, 0x99, 0x3a, 0x2f, 0x27, 0x20, 0x85,
+  0xbb, 0x57, 0x4d, 0x9b, 0xce, 0x6e, 0xdc, 0xab, 0x63, 0xfb, 0x09, 0xbc, 0xf8, 0xc9, 0xed, 0x9a,
+  0x37, 0x73, 0x2f, 0xd9, 0xf5, 0x69, 0xf6, 0xaf, 0x57, 0xaa, 0x6f, 0xa6, 0xa0, 0xfa, 0x5d, 0xf9,
+  0x26, 0xa8, 0x3e, 0x2e, 0xdf, 0xba, 0xd0, 0x19, 0x4d, 0x99, 0x0e, 0xd8, 0xdf, 0x9f, 0xbe, 0x23,
+  0xa4, 0x93, 0x9a, 0xa7, 0x4b, 0xcc, 0xa7, 0xd2, 0xe8, 0xf4, 0xf5, 0x0e, 0x1d, 0xb3, 0xfd, 0xee,
+  0x1d, 0xe0, 0x5b, 0x9d, 0x76, 0xfb, 0xd0, 0xb1, 0x4c, 0xb5, 0x0d, 0xdc, 0x5f, 0x80, 0x44, 0xcf,
+  0xb5, 0x41, 0x04, 0xf6, 0x83, 0x17, 0xbe, 0xae, 0xef, 0xdb, 0xa7, 0x2b, 0xed, 0xaa, 0xb9, 0xbe,
+  0xf9, 0xa5, 0x79, 0xd4, 0x31, 0xe0, 0xbb, 0x5d, 0x73, 0x9e, 0x98, 0x06, 0x5c, 0x1f, 0xff, 0xbd,
+  0xcc, 0x5e, 0x78, 0x3c, 0xbe, 0xe2, 0xf1, 0x08, 0x4c, 0xf8, 0x1c, 0x13, 0xce, 0x99, 0x43, 0x20,
+  0x06, 0xd8, 0x19, 0x9d, 0xd7, 0x48, 0xb0, 0x92, 0xbd, 0x2e, 0x3e, 0x3f, 0x43, 0xe7, 0x6b, 0xd8,
+  0x9f, 0xa1, 0xf3, 0x97, 0x8b, 0xfe, 0xe1, 0x0f, 0xff, 0x0f, 0x04, 0x1a, 0x72, 0x19, 0x78, 0x54,
+  0x00, 0x00,
+};
+
+#endif
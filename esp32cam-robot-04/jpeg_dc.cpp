@@ -0,0 +1,436 @@
+/*
+  ESP32CAM Robot Car
+  jpeg_dc.cpp (see jpeg_dc.h)
+*/
+
+#include <string.h>
+#include "jpeg_dc.h"
+
+#define DC_COEF_MAX   2047          // baseline DC coefficients are 11 bits
+#define DC_VALUE_MAX  (2047 * 8)    // dequantised, keeps 116130 * cb in int
+
+static inline int extend(int v, int s) {
+  return v < (1 << (s - 1)) ? v - (1 << s) + 1 : v;
+}
+
+static inline uint8_t clamp8(int v) {
+  return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+static inline int clamp_abs(int v, int max) {
+  return v < -max ? -max : v > max ? max : v;
+}
+
+JpegDc::JpegDc() : p_(NULL), end_(NULL), buf_(0), cnt_(0), marker_(false),
+  ncomp_(0), width_(0), height_(0), hmax_(1), vmax_(1), restart_(0) {
+  memset(q0_, 0, sizeof(q0_));
+  for (int i = 0; i < 2; i++) {
+    dc_[i].defined = false;
+    ac_[i].defined = false;
+  }
+}
+
+jpeg_dc_err_t JpegDc::decode(const uint8_t *jpg, size_t len, uint8_t *r, uint8_t *g, uint8_t *b, size_t plane_size) {
+  p_ = jpg;
+  end_ = jpg + len;
+  ncomp_ = 0;
+  width_ = 0;
+  height_ = 0;
+  restart_ = 0;
+  for (int i = 0; i < 2; i++) {
+    dc_[i].defined = false;
+    ac_[i].defined = false;
+  }
+
+  jpeg_dc_err_t err = headers();
+  if (err != JPEG_DC_OK) {
+    return err;
+  }
+  if ((size_t)width() * height() > plane_size) {
+    return JPEG_DC_SIZE;
+  }
+  return scan(r, g, b);
+}
+
+// Walks the marker segments up to and including SOS, leaving p_ on the
+// first byte of entropy coded data
+jpeg_dc_err_t JpegDc::headers() {
+  if (end_ - p_ < 2 || p_[0] != 0xFF || p_[1] != 0xD8) {
+    return JPEG_DC_FORMAT;
+  }
+  p_ += 2;
+
+  while (true) {
+    while (end_ - p_ > 1 && p_[0] == 0xFF && p_[1] == 0xFF) {
+      p_++;     // fill bytes
+    }
+    if (end_ - p_ < 4 || p_[0] != 0xFF) {
+      return JPEG_DC_FORMAT;
+    }
+    uint8_t m = p_[1];
+    size_t seg = p_[2] << 8 | p_[3];
+    if (seg < 2 || seg > (size_t)(end_ - p_ - 2)) {
+      return JPEG_DC_FORMAT;
+    }
+    const uint8_t *s = p_ + 4;
+    const uint8_t *e = p_ + 2 + seg;
+    p_ = e;
+
+    switch (m) {
+      case 0xDB:    // DQT, only the DC entry is needed
+        while (s < e) {
+          int pq = s[0] >> 4;
+          int tq = s[0] & 15;
+          int n = pq ? 129 : 65;
+          if (tq > 3 || e - s < n) {
+            return JPEG_DC_FORMAT;
+          }
+          q0_[tq] = pq ? (s[1] << 8 | s[2]) : s[1];
+          s += n;
+        }
+        break;
+
+      case 0xC4:    // DHT
+        while (s < e) {
+          if (e - s < 17) {
+            return JPEG_DC_FORMAT;
+          }
+          int tc = s[0] >> 4;
+          int th = s[0] & 15;
+          int total = 0;
+          for (int i = 1; i <= 16; i++) {
+            total += s[i];
+          }
+          if (tc > 1 || total > 256 || e - s < 17 + total) {
+            return JPEG_DC_FORMAT;
+          }
+          if (th > 1) {
+            return JPEG_DC_UNSUPPORTED;   // baseline has two of each
+          }
+          if (!build(tc ? ac_[th] : dc_[th], s + 1, s + 17, tc)) {
+            return JPEG_DC_FORMAT;
+          }
+          s += 17 + total;
+        }
+        break;
+
+      case 0xDD:    // DRI
+        if (seg < 4) {
+          return JPEG_DC_FORMAT;
+        }
+        restart_ = s[0] << 8 | s[1];
+        break;
+
+      case 0xC0:    // SOF0 baseline
+      case 0xC1:    // SOF1 extended, same coding with 8 bit samples
+        if (seg < 8) {
+          return JPEG_DC_FORMAT;
+        }
+        if (s[0] != 8) {
+          return JPEG_DC_UNSUPPORTED;
+        }
+        height_ = s[1] << 8 | s[2];
+        width_ = s[3] << 8 | s[4];
+        ncomp_ = s[5];
+        if (!width_ || !height_) {
+          return JPEG_DC_UNSUPPORTED;     // height from DNL
+        }
+        if (ncomp_ != 1 && ncomp_ != 3) {
+          return JPEG_DC_UNSUPPORTED;
+        }
+        if (seg < 8 + 3 * (size_t)ncomp_) {
+          return JPEG_DC_FORMAT;
+        }
+        hmax_ = 1;
+        vmax_ = 1;
+        for (int i = 0; i < ncomp_; i++) {
+          Component &c = comp_[i];
+          c.id = s[6 + 3 * i];
+          c.h = s[7 + 3 * i] >> 4;
+          c.v = s[7 + 3 * i] & 15;
+          c.tq = s[8 + 3 * i];
+          if (c.h < 1 || c.h > 2 || c.v < 1 || c.v > 2) {
+            return JPEG_DC_UNSUPPORTED;
+          }
+          if (c.tq > 3) {
+            return JPEG_DC_FORMAT;
+          }
+          if (c.h > hmax_) hmax_ = c.h;
+          if (c.v > vmax_) vmax_ = c.v;
+        }
+        if (ncomp_ == 1) {
+          comp_[0].h = comp_[0].v = hmax_ = vmax_ = 1;   // non-interleaved, one block per MCU
+        } else if (comp_[0].h != hmax_ || comp_[0].v != vmax_) {
+          return JPEG_DC_UNSUPPORTED;     // luma must carry the full resolution
+        }
+        break;
+
+      case 0xDA: {  // SOS
+        if (!ncomp_) {
+          return JPEG_DC_FORMAT;
+        }
+        int ns = s[0];
+        if (ns != ncomp_) {
+          return JPEG_DC_UNSUPPORTED;     // one interleaved scan only
+        }
+        if (seg < 6 + 2 * (size_t)ns) {
+          return JPEG_DC_FORMAT;
+        }
+        for (int i = 0; i < ns; i++) {
+          Component &c = comp_[i];
+          if (s[1 + 2 * i] != c.id) {
+            return JPEG_DC_UNSUPPORTED;
+          }
+          c.td = s[2 + 2 * i] >> 4;
+          c.ta = s[2 + 2 * i] & 15;
+          if (c.td > 1 || c.ta > 1) {
+            return JPEG_DC_UNSUPPORTED;
+          }
+          if (!dc_[c.td].defined || !ac_[c.ta].defined) {
+            return JPEG_DC_FORMAT;
+          }
+        }
+        return JPEG_DC_OK;
+      }
+
+      case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+      case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+        return JPEG_DC_UNSUPPORTED;
+
+      case 0xD9:    // EOI before any scan
+        return JPEG_DC_FORMAT;
+
+      default:      // APPn, COM, ...
+        break;
+    }
+  }
+}
+
+// Canonical code assignment (JPEG Annex C) plus the lookahead table. AC
+// entries fold the magnitude bits in, so a short coefficient is skipped with
+// a single lookup.
+bool JpegDc::build(Huffman &t, const uint8_t *counts, const uint8_t *vals, bool ac) {
+  memset(t.fast, 0, sizeof(t.fast));
+  uint32_t code = 0;
+  int k = 0;
+
+  for (int l = 1; l <= 16; l++) {
+    int n = counts[l - 1];
+    if (code + n > (1u << l)) {
+      return false;     // more codes than fit in l bits
+    }
+    t.valptr[l] = k;
+    t.mincode[l] = code;
+    t.maxcode[l] = n ? (int32_t)(code + n - 1) : -1;
+    for (int i = 0; i < n; i++, k++, code++) {
+      t.vals[k] = vals[k];
+      int rs = vals[k];
+      int len = ac ? l + (rs & 15) : l;
+      int entry = rs;
+      if (ac) {
+        entry = rs & 15 ? (rs >> 4) + 1 : rs == 0xF0 ? 16 : rs == 0x00 ? 64 : 0;
+      }
+      if (len <= JPEG_DC_LOOKAHEAD && (!ac || entry)) {
+        int shift = JPEG_DC_LOOKAHEAD - len;
+        uint32_t first = ac ? code << (rs & 15) << shift : code << shift;
+        uint32_t count = ac ? 1u << ((rs & 15) + shift) : 1u << shift;
+        for (uint32_t j = 0; j < count; j++) {
+          t.fast[first + j] = len << 8 | entry;
+        }
+      }
+    }
+    code <<= 1;
+  }
+  t.defined = true;
+  return true;
+}
+
+// Tops the buffer up past 24 bits, removing stuffed zero bytes. At a marker
+// (or the end of the data) zeros are fed in and p_ is left on the marker.
+void JpegDc::fill() {
+  while (cnt_ <= 24) {
+    uint32_t c = 0;
+    if (!marker_ && p_ < end_) {
+      c = *p_;
+      if (c != 0xFF) {
+        p_++;
+      } else if (end_ - p_ > 1 && p_[1] == 0x00) {
+        p_ += 2;
+      } else {
+        marker_ = true;
+        c = 0;
+      }
+    }
+    buf_ |= c << (24 - cnt_);
+    cnt_ += 8;
+  }
+}
+
+int JpegDc::bits(int n) {
+  if (cnt_ < n) {
+    fill();
+  }
+  int v = buf_ >> (32 - n);
+  buf_ <<= n;
+  cnt_ -= n;
+  return v;
+}
+
+inline int JpegDc::symbol(const Huffman &t) {
+  if (cnt_ < 16) {
+    fill();
+  }
+  uint16_t e = t.fast[buf_ >> (32 - JPEG_DC_LOOKAHEAD)];
+  if (e) {
+    int l = e >> 8;
+    buf_ <<= l;
+    cnt_ -= l;
+    return e & 0xff;
+  }
+  return slow(t);
+}
+
+// Skips one AC coefficient (or run), returning how far along the block it moved
+inline int JpegDc::skip(const Huffman &t) {
+  if (cnt_ < 16) {
+    fill();
+  }
+  uint16_t e = t.fast[buf_ >> (32 - JPEG_DC_LOOKAHEAD)];
+  if (e) {
+    int l = e >> 8;
+    buf_ <<= l;
+    cnt_ -= l;
+    return e & 0xff;
+  }
+  int rs = slow(t);
+  if (rs < 0) {
+    return -1;
+  }
+  if (rs & 15) {
+    bits(rs & 15);
+    return (rs >> 4) + 1;
+  }
+  return rs == 0xF0 ? 16 : 64;
+}
+
+// Code by code search, for whatever the lookahead table could not resolve
+int JpegDc::slow(const Huffman &t) {
+  for (int l = 1; l <= 16; l++) {
+    int32_t code = buf_ >> (32 - l);
+    if (code <= t.maxcode[l]) {
+      buf_ <<= l;
+      cnt_ -= l;
+      return t.vals[t.valptr[l] + code - t.mincode[l]];
+    }
+  }
+  return -1;
+}
+
+// Drops the padding bits, steps over the next RSTn and resets the predictors
+bool JpegDc::restart() {
+  buf_ = 0;
+  cnt_ = 0;
+  marker_ = false;
+  while (end_ - p_ > 1 && !(p_[0] == 0xFF && p_[1] >= 0xD0 && p_[1] <= 0xD7)) {
+    p_++;
+  }
+  if (end_ - p_ < 2) {
+    return false;
+  }
+  p_ += 2;
+  for (int i = 0; i < ncomp_; i++) {
+    comp_[i].pred = 0;
+  }
+  return true;
+}
+
+jpeg_dc_err_t JpegDc::scan(uint8_t *r, uint8_t *g, uint8_t *b) {
+  int tw = width();
+  int th = height();
+  int mcus_x = (width_ + 8 * hmax_ - 1) / (8 * hmax_);
+  int mcus_y = (height_ + 8 * vmax_ - 1) / (8 * vmax_);
+  int todo = restart_;
+
+  buf_ = 0;
+  cnt_ = 0;
+  marker_ = false;
+  for (int i = 0; i < ncomp_; i++) {
+    comp_[i].pred = 0;
+  }
+
+  for (int my = 0; my < mcus_y; my++) {
+    for (int mx = 0; mx < mcus_x; mx++) {
+      if (restart_) {
+        if (!todo) {
+          if (!restart()) {
+            return JPEG_DC_DATA;
+          }
+          todo = restart_;
+        }
+        todo--;
+      }
+
+      // Dequantised DC of every block in the MCU, in raster order
+      int dc[3][4];
+      for (int ci = 0; ci < ncomp_; ci++) {
+        Component &c = comp_[ci];
+        const Huffman &ac = ac_[c.ta];
+        for (int i = 0; i < c.h * c.v; i++) {
+          int s = symbol(dc_[c.td]);
+          if (s < 0 || s > 11) {
+            return JPEG_DC_DATA;
+          }
+          // Corrupt data can walk the predictor anywhere; hold it and the
+          // dequantised value to what a real image can have, past which
+          // the pixel saturates anyway.
+          if (s) {
+            c.pred += extend(bits(s), s);
+            c.pred = clamp_abs(c.pred, DC_COEF_MAX);
+          }
+          dc[ci][i] = clamp_abs(c.pred * q0_[c.tq], DC_VALUE_MAX);
+
+          // Only the AC symbols are decoded, their values are skipped
+          for (int k = 1; k < 64;) {
+            int n = skip(ac);
+            if (n < 0) {
+              return JPEG_DC_DATA;
+            }
+            k += n;
+          }
+        }
+      }
+
+      for (int v = 0; v < vmax_; v++) {
+        int by = my * vmax_ + v;
+        if (by >= th) {
+          break;
+        }
+        for (int h = 0; h < hmax_; h++) {
+          int bx = mx * hmax_ + h;
+          if (bx >= tw) {
+            break;
+          }
+          // Block means: DC / 8, level shifted for luma
+          int y = ((dc[0][v * hmax_ + h] + 4) >> 3) + 128;
+          int cb = 0;
+          int cr = 0;
+          if (ncomp_ == 3) {
+            const Component &u = comp_[1];
+            const Component &w = comp_[2];
+            cb = (dc[1][v * u.v / vmax_ * u.h + h * u.h / hmax_] + 4) >> 3;
+            cr = (dc[2][v * w.v / vmax_ * w.h + h * w.h / hmax_] + 4) >> 3;
+          }
+          size_t o = (size_t)by * tw + bx;
+          r[o] = clamp8(y + ((91881 * cr + 32768) >> 16));
+          g[o] = clamp8(y + ((-22554 * cb - 46802 * cr + 32768) >> 16));
+          b[o] = clamp8(y + ((116130 * cb + 32768) >> 16));
+        }
+      }
+    }
+  }
+  // Zeros fed in past the end of the buffer rather than up to a marker
+  if (!marker_ && p_ >= end_) {
+    return JPEG_DC_DATA;
+  }
+  return JPEG_DC_OK;
+}
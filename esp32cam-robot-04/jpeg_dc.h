@@ -0,0 +1,98 @@
+/*
+  ESP32CAM Robot Car
+  jpeg_dc.h (used by app_httpd.cpp)
+  Thumbnail from the DC coefficients of a baseline JPEG.
+
+  The DC term of an 8x8 block is the block's mean, so Huffman decoding the
+  DC terms and skipping over the AC ones gives a 1/8 scale image with no
+  IDCT, no upsampling and no per-pixel work: 40x30 for a QVGA frame. Colour
+  comes from the chroma block covering each luma block.
+
+  Handles what the OV2640 produces (baseline, Huffman, 4:2:0 / 4:2:2 / 4:4:4
+  or greyscale, with or without restart markers). Progressive and
+  arithmetic coded files are refused.
+*/
+
+#ifndef JPEG_DC_H
+#define JPEG_DC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define JPEG_DC_LOOKAHEAD  9    // bits resolved by one table lookup
+
+enum jpeg_dc_err_t {
+  JPEG_DC_OK,
+  JPEG_DC_FORMAT,       // not a JPEG, or truncated headers
+  JPEG_DC_UNSUPPORTED,  // progressive, arithmetic, 12 bit, ...
+  JPEG_DC_SIZE,         // planes too small for the thumbnail
+  JPEG_DC_DATA          // corrupt entropy coded data
+};
+
+class JpegDc {
+  public:
+    JpegDc();
+
+    // Writes the thumbnail into the r, g and b planes, each holding at least
+    // plane_size bytes. On JPEG_DC_SIZE width() and height() are valid, so
+    // the caller can grow the planes and try again.
+    jpeg_dc_err_t decode(const uint8_t *jpg, size_t len, uint8_t *r, uint8_t *g, uint8_t *b, size_t plane_size);
+
+    // Thumbnail size in blocks, (image size + 7) / 8
+    int width() const {
+      return (width_ + 7) >> 3;
+    }
+
+    int height() const {
+      return (height_ + 7) >> 3;
+    }
+
+  private:
+    struct Huffman {
+      // DC: len << 8 | symbol. AC: (len + magnitude bits) << 8 | coefficients
+      // advanced, 64 for end of block. 0 when the lookahead is too short.
+      uint16_t fast[1 << JPEG_DC_LOOKAHEAD];
+      int32_t  maxcode[17];                    // largest code of each length, -1 for none
+      int16_t  valptr[17];                     // index of the first symbol of each length
+      uint16_t mincode[17];
+      uint8_t  vals[256];
+      bool     defined;
+    };
+
+    struct Component {
+      uint8_t id;
+      uint8_t h, v;     // sampling factors
+      uint8_t tq;       // quantisation table
+      uint8_t td, ta;   // DC and AC Huffman tables
+      int     pred;     // DC predictor
+    };
+
+    jpeg_dc_err_t headers();
+    bool build(Huffman &t, const uint8_t *counts, const uint8_t *vals, bool ac);
+    jpeg_dc_err_t scan(uint8_t *r, uint8_t *g, uint8_t *b);
+
+    // Entropy coded segment bit reader
+    void fill();
+    int  bits(int n);
+    int  symbol(const Huffman &t);
+    int  skip(const Huffman &t);
+    int  slow(const Huffman &t);
+    bool restart();
+
+    const uint8_t *p_;
+    const uint8_t *end_;
+    uint32_t buf_;
+    int      cnt_;
+    bool     marker_;   // hit a marker, feeding zeros from here on
+
+    Huffman  dc_[2];
+    Huffman  ac_[2];
+    uint16_t q0_[4];    // DC entry of each quantisation table
+    Component comp_[3];
+    int      ncomp_;
+    int      width_, height_;
+    int      hmax_, vmax_;
+    int      restart_;
+};
+
+#endif
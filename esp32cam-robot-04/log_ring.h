@@ -0,0 +1,128 @@
+/*
+  ESP32CAM Robot Car
+  log_ring.h (used by app_log.cpp)
+  Log messages from any task queued for one task that writes them out.
+
+  Any number of tasks push, one drain task pops. A writer claims a slot by
+  moving the head with a compare-and-swap, formats straight into it and
+  publishes it with the slot's sequence number, so writers never wait on
+  each other or on the drain. When the ring is full the message is dropped
+  and counted instead. LogLimit lets one call site through at most once per
+  period and counts what it held back. Only std::atomic is used, so both
+  run unchanged on a host with threads.
+*/
+
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <atomic>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+enum log_level_t {
+  LOG_ERROR,
+  LOG_WARN,
+  LOG_INFO,
+  LOG_DEBUG
+};
+
+typedef struct {
+  uint32_t ms;
+  uint16_t skipped;     // messages LogLimit held back at this site before
+  uint8_t level;
+} log_meta_t;
+
+template <int N, int LEN>
+class LogRing {
+    static_assert(N >= 2 && !(N & (N - 1)), "N must be a power of two");
+
+  public:
+    LogRing() : head_(0), tail_(0), dropped_(0) {
+      for (int i = 0; i < N; i++) {
+        cells_[i].seq.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    // Any task. False when the ring was full and the message was dropped.
+    bool push(const log_meta_t &meta, const char *fmt, va_list args) {
+      uint32_t pos = head_.load(std::memory_order_relaxed);
+      Cell *c;
+      while (true) {
+        c = &cells_[pos & (N - 1)];
+        int32_t ahead = (int32_t)(c->seq.load(std::memory_order_acquire) - pos);
+        if (ahead == 0) {
+          if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        } else if (ahead < 0) {
+          dropped_.fetch_add(1, std::memory_order_relaxed);
+          return false;     // the drain has not freed this slot yet
+        } else {
+          pos = head_.load(std::memory_order_relaxed);
+        }
+      }
+      c->meta = meta;
+      vsnprintf(c->text, LEN, fmt, args);
+      c->seq.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+
+    // Drain task only. Copies out the oldest message, false if there is
+    // none ready (a writer may still be formatting it).
+    bool pop(log_meta_t *meta, char *text) {
+      Cell *c = &cells_[tail_ & (N - 1)];
+      if (c->seq.load(std::memory_order_acquire) != tail_ + 1) {
+        return false;
+      }
+      *meta = c->meta;
+      memcpy(text, c->text, LEN);
+      c->seq.store(tail_ + N, std::memory_order_release);
+      tail_++;
+      return true;
+    }
+
+    // Messages lost to a full ring since the last call
+    uint32_t take_dropped() {
+      return dropped_.exchange(0, std::memory_order_relaxed);
+    }
+
+  private:
+    struct Cell {
+      std::atomic<uint32_t> seq;  // pos when free to write, pos + 1 when written
+      log_meta_t meta;
+      char text[LEN];
+    };
+
+    Cell cells_[N];
+    std::atomic<uint32_t> head_;
+    uint32_t tail_;
+    std::atomic<uint32_t> dropped_;
+};
+
+// One per call site (a static in the LOG_LIMIT macro)
+class LogLimit {
+  public:
+    constexpr LogLimit() : next_(0), skipped_(0) {}
+
+    // True at most once per period_ms; *skipped is how many calls were held
+    // back since the last one let through.
+    bool allow(uint32_t now_ms, uint32_t period_ms, uint16_t *skipped) {
+      uint32_t next = next_.load(std::memory_order_relaxed);
+      if ((int32_t)(now_ms - next) < 0 ||
+          !next_.compare_exchange_strong(next, now_ms + period_ms, std::memory_order_relaxed)) {
+        skipped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      uint32_t n = skipped_.exchange(0, std::memory_order_relaxed);
+      *skipped = n > 0xffff ? 0xffff : n;
+      return true;
+    }
+
+  private:
+    std::atomic<uint32_t> next_;
+    std::atomic<uint32_t> skipped_;
+};
+
+#endif
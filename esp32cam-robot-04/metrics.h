@@ -0,0 +1,108 @@
+/*
+  ESP32CAM Robot Car
+  metrics.h (used by app_httpd.cpp and ws_control.cpp)
+  Counters and latency histograms any task can add to without a lock.
+
+  A Histogram counts samples in power of two buckets: bucket 0 holds 0,
+  bucket b holds [2^(b-1), 2^b) and the last one everything above, so with
+  microseconds it spans 1 us to over 250 ms. Everything counts up from boot
+  and wraps at 32 bits; a scraper takes differences between two reads. A
+  read is not a snapshot, a sample added meanwhile can show in the count and
+  not yet in its bucket.
+
+  /metrics prints one line per metric:
+    counter <name> <value>
+    hist <name> <count> <sum> <bucket 0> ... <bucket HIST_BUCKETS - 1>
+  Plain C++ with std::atomic, so it builds on a host too.
+*/
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define HIST_BUCKETS  20
+
+class Counter {
+  public:
+    Counter() : n_(0) {}
+
+    void add(uint32_t n = 1) {
+      n_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint32_t get() const {
+      return n_.load(std::memory_order_relaxed);
+    }
+
+    int format(char *buf, size_t size, const char *name) const {
+      return snprintf(buf, size, "counter %s %u\n", name, get());
+    }
+
+  private:
+    std::atomic<uint32_t> n_;
+};
+
+class Histogram {
+  public:
+    Histogram() : count_(0), sum_(0) {
+      for (int i = 0; i < HIST_BUCKETS; i++) {
+        buckets_[i].store(0, std::memory_order_relaxed);
+      }
+    }
+
+    static int bucket(uint32_t v) {
+      int b = v ? 32 - __builtin_clz(v) : 0;
+      return b < HIST_BUCKETS ? b : HIST_BUCKETS - 1;
+    }
+
+    void add(uint32_t v) {
+      buckets_[bucket(v)].fetch_add(1, std::memory_order_relaxed);
+      sum_.fetch_add(v, std::memory_order_relaxed);
+      count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Negative values (clock read out of order) count as 0
+    void add_us(int64_t us) {
+      add(us <= 0 ? 0 : us > UINT32_MAX ? UINT32_MAX : (uint32_t)us);
+    }
+
+    uint32_t count() const {
+      return count_.load(std::memory_order_relaxed);
+    }
+
+    // Returns what snprintf would, the line is cut if size is short
+    int format(char *buf, size_t size, const char *name) const {
+      size_t len = snprintf(buf, size, "hist %s %u %u", name, count(), sum_.load(std::memory_order_relaxed));
+      for (int i = 0; i < HIST_BUCKETS; i++) {
+        len += snprintf(buf + (len < size ? len : size), len < size ? size - len : 0,
+                        " %u", buckets_[i].load(std::memory_order_relaxed));
+      }
+      len += snprintf(buf + (len < size ? len : size), len < size ? size - len : 0, "\n");
+      return len;
+    }
+
+  private:
+    std::atomic<uint32_t> buckets_[HIST_BUCKETS];
+    std::atomic<uint32_t> count_;
+    std::atomic<uint32_t> sum_;
+};
+
+typedef struct {
+  Histogram capture_us;     // esp_camera_fb_get() and JPEG conversion
+  Histogram send_us;        // one /stream frame, header to boundary
+  Histogram control_us;     // /control, /move and WebSocket commands, to the reply
+  Histogram stop_late_us;   // motors stopped this long after the motion deadline
+  Counter frames_captured;
+  Counter frames_sent;      // to all viewers together
+  Counter frames_skipped;   // newer frames a viewer jumped to, per viewer
+  Counter capture_failed;   // no frame from the driver, JPEG conversion or copy failed
+  Counter ring_full;        // captured frames dropped, every ring slot pinned
+  Counter snapshots;        // /capture replies
+  Counter snap_waits;       // of those, waited for a new frame
+} robot_metrics_t;
+
+#endif
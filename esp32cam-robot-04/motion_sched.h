@@ -0,0 +1,106 @@
+/*
+  ESP32CAM Robot Car
+  motion_sched.h (used by app_httpd.cpp)
+  Queue of timed motion primitives with an auto-stop deadline.
+
+  The scheduler owns the queue and the deadline only; time comes from the
+  caller and the caller arms whatever one-shot timer it has. On the robot
+  that is esp_timer, on a host it can be a simulated clock. Times are in
+  microseconds, step durations in milliseconds.
+
+  Each step starts at the deadline of the one before it rather than at the
+  time the timer callback ran, so a batch plays back with no gaps and timer
+  latency does not add up over the batch.
+*/
+
+#ifndef MOTION_SCHED_H
+#define MOTION_SCHED_H
+
+#include <stdint.h>
+
+#define MOTION_QUEUE_LEN  16
+
+typedef struct {
+  uint8_t  op;        // robot opcode, same numbering as /control?var=car
+  uint8_t  speed;     // 0 keeps the current speed
+  uint16_t ms;        // 0 for steps that take no time (e.g. stop)
+} motion_step_t;
+
+enum motion_result_t {
+  MOTION_IDLE,        // nothing running, nothing queued
+  MOTION_WAIT,        // current step still running, re-arm for *delay
+  MOTION_RUN,         // start *step now, arm for *delay
+  MOTION_STOP         // queue ran dry, stop the motors
+};
+
+class MotionScheduler {
+  public:
+    MotionScheduler() : deadline_(0), active_(false), head_(0), count_(0) {}
+
+    // Drops the running step and everything queued.
+    void clear() {
+      active_ = false;
+      head_ = 0;
+      count_ = 0;
+    }
+
+    // Drops queued steps, the running one finishes.
+    void flush() {
+      head_ = 0;
+      count_ = 0;
+    }
+
+    bool push(const motion_step_t &step) {
+      if (count_ == MOTION_QUEUE_LEN) {
+        return false;
+      }
+      queue_[(head_ + count_) % MOTION_QUEUE_LEN] = step;
+      count_++;
+      return true;
+    }
+
+    // Called on timer expiry and after queueing into an idle scheduler.
+    motion_result_t poll(int64_t now, motion_step_t *step, int64_t *delay) {
+      if (active_ && now < deadline_) {
+        *delay = deadline_ - now;
+        return MOTION_WAIT;
+      }
+      if (!count_) {
+        if (!active_) {
+          return MOTION_IDLE;
+        }
+        active_ = false;
+        return MOTION_STOP;
+      }
+
+      int64_t start = active_ ? deadline_ : now;
+      *step = queue_[head_];
+      head_ = (head_ + 1) % MOTION_QUEUE_LEN;
+      count_--;
+      deadline_ = start + (int64_t)step->ms * 1000;
+      active_ = true;
+      *delay = deadline_ > now ? deadline_ - now : 0;
+      return MOTION_RUN;
+    }
+
+    bool active() const {
+      return active_;
+    }
+
+    int pending() const {
+      return count_;
+    }
+
+    int64_t deadline() const {
+      return deadline_;
+    }
+
+  private:
+    motion_step_t queue_[MOTION_QUEUE_LEN];
+    int64_t deadline_;
+    bool active_;
+    int head_;
+    int count_;
+};
+
+#endif
@@ -0,0 +1,214 @@
+/*
+  ESP32CAM Robot Car
+  stream_adapt.h (used by app_httpd.cpp)
+  Picks JPEG quality and framesize from how long /stream frames take to send.
+
+  Every frame sent reports its size, the time spent in send() and how long
+  the part header waited for room in the socket (the previous frame still
+  draining). A frame should be on the wire within the budget, the shorter
+  of one frame period at the target rate and the latency limit. Over budget
+  for a few frames in a row, quality is lowered a step; at the worst quality
+  the framesize goes down instead. Back up again only after a long run of
+  frames that would still fit with the next step's extra bytes, quality
+  first, then framesize. After a step the frames still in flight at the old
+  setting are not counted. A step up that is undone soon after makes the
+  next one wait twice as long, and one that holds halves the wait again, so
+  a link sitting on a boundary does not make the picture flicker.
+
+  Quality is the sensor's value, lower is better. Plain C++ so that the
+  control law can be run on a PC against a simulated link.
+*/
+
+#ifndef STREAM_ADAPT_H
+#define STREAM_ADAPT_H
+
+#include <stdint.h>
+
+#define ADAPT_TARGET_FPS      10
+#define ADAPT_LATENCY_MS      150     // longest a frame may take to send
+#define ADAPT_QUALITY_WORST   40
+#define ADAPT_QUALITY_STEP    5
+#define ADAPT_DOWN_FRAMES     3       // frames over budget before stepping down
+#define ADAPT_UP_FRAMES       20      // frames with room before stepping up
+#define ADAPT_UP_FRAMES_MAX   (8 * ADAPT_UP_FRAMES)
+#define ADAPT_SETTLE_FRAMES   6       // frames ignored after a step
+#define ADAPT_SIZE_COST_Q8    320     // bytes after a framesize step up, Q8 (x1.25)
+#define ADAPT_ROOM_Q8         192     // a step up has to fit in 3/4 of the budget
+
+typedef struct {
+  int framesize;
+  int quality;
+} adapt_setting_t;
+
+class StreamAdapt {
+  public:
+    StreamAdapt() : fs_min_(0), fs_max_(0), q_best_(10), q_worst_(ADAPT_QUALITY_WORST) {
+      budget(ADAPT_TARGET_FPS, ADAPT_LATENCY_MS);
+      reset(0, 10);
+    }
+
+    void budget(int fps, int latency_ms) {
+      uint32_t period = (uint32_t)(1000000UL / (fps > 0 ? fps : 1));
+      uint32_t latency = (uint32_t)latency_ms * 1000;
+      budget_us_ = period < latency ? period : latency;
+    }
+
+    // Range the controller may use. fs_max and q_best are what the operator
+    // asked for; it never goes above them.
+    void limits(int fs_min, int fs_max, int q_best, int q_worst) {
+      fs_max_ = fs_max;
+      fs_min_ = fs_min < fs_max ? fs_min : fs_max;
+      q_best_ = q_best;
+      q_worst_ = q_worst > q_best ? q_worst : q_best;
+    }
+
+    // Starts over from a setting, clamped to the limits
+    void reset(int framesize, int quality) {
+      set_.framesize = framesize < fs_min_ ? fs_min_ : framesize > fs_max_ ? fs_max_ : framesize;
+      set_.quality = quality < q_best_ ? q_best_ : quality > q_worst_ ? q_worst_ : quality;
+      send_us_ = 0;
+      bytes_ = 0;
+      over_ = 0;
+      room_ = 0;
+      settle_ = 0;
+      up_hold_ = ADAPT_UP_FRAMES;
+      since_up_ = UINT32_MAX;
+      steps_ = 0;
+    }
+
+    // One frame sent: bytes, microseconds from the start of its part header
+    // to the end of its boundary, and of those the wait for the header.
+    // True when setting() changed and has to be applied.
+    bool frame(uint32_t bytes, uint32_t send_us, uint32_t wait_us) {
+      if (since_up_ != UINT32_MAX && ++since_up_ >= 2 * (uint32_t)up_hold_) {
+        since_up_ = UINT32_MAX;     // the last step up held
+        up_hold_ = up_hold_ / 2 > ADAPT_UP_FRAMES ? up_hold_ / 2 : ADAPT_UP_FRAMES;
+      }
+      if (settle_) {
+        settle_--;
+        return false;
+      }
+      send_us_ = send_us_ ? send_us_ + ((int32_t)send_us - (int32_t)send_us_) / 4 : send_us;
+      bytes_ = bytes_ ? bytes_ + ((int32_t)bytes - (int32_t)bytes_) / 4 : bytes;
+
+      // The whole budget gone before the frame even started means the
+      // socket is backed up, whatever the average says
+      bool backed_up = wait_us > budget_us_;
+      over_ = send_us_ > budget_us_ || backed_up ? over_ + 1 : 0;
+      if (over_ >= ADAPT_DOWN_FRAMES) {
+        return step_down();
+      }
+
+      // JPEG bytes go roughly as 1 / quality
+      adapt_setting_t up = next_up();
+      uint32_t cost = up.framesize != set_.framesize ? ADAPT_SIZE_COST_Q8 : 256 * set_.quality / up.quality;
+      bool fits = !backed_up && (uint64_t)send_us_ * cost < (uint64_t)budget_us_ * ADAPT_ROOM_Q8;
+      room_ = fits ? room_ + 1 : 0;
+      if (room_ >= up_hold_) {
+        return step_up();
+      }
+      return false;
+    }
+
+    adapt_setting_t setting() const {
+      return set_;
+    }
+
+    // The top of the range, framesize and quality as the operator set them
+    adapt_setting_t limit() const {
+      adapt_setting_t s = {fs_max_, q_best_};
+      return s;
+    }
+
+    // Filtered send time and the budget it is held to, microseconds
+    uint32_t send_us() const {
+      return send_us_;
+    }
+
+    uint32_t budget_us() const {
+      return budget_us_;
+    }
+
+    // Throughput seen by the sends, kbit/s
+    uint32_t rate_kbps() const {
+      return send_us_ ? (uint32_t)((uint64_t)bytes_ * 8000 / send_us_) : 0;
+    }
+
+    // Steps taken since reset(), both ways
+    uint32_t steps() const {
+      return steps_;
+    }
+
+  private:
+    bool step_down() {
+      adapt_setting_t s = set_;
+      if (s.quality < q_worst_) {
+        s.quality = s.quality + ADAPT_QUALITY_STEP < q_worst_ ? s.quality + ADAPT_QUALITY_STEP : q_worst_;
+      } else if (s.framesize > fs_min_) {
+        s.framesize--;
+      } else {
+        over_ = 0;
+        return false;     // nothing left to give up
+      }
+      // The last step up did not hold, wait longer before the next one
+      if (since_up_ != UINT32_MAX) {
+        up_hold_ = 2 * up_hold_ < ADAPT_UP_FRAMES_MAX ? 2 * up_hold_ : ADAPT_UP_FRAMES_MAX;
+      }
+      since_up_ = UINT32_MAX;
+      return apply(s);
+    }
+
+    // Quality first. A bigger framesize starts a step below the best
+    // quality, about the bytes of the smaller one at the best.
+    adapt_setting_t next_up() const {
+      adapt_setting_t s = set_;
+      if (s.quality > q_best_) {
+        s.quality = s.quality - ADAPT_QUALITY_STEP > q_best_ ? s.quality - ADAPT_QUALITY_STEP : q_best_;
+      } else if (s.framesize < fs_max_) {
+        s.framesize++;
+        s.quality = q_best_ + ADAPT_QUALITY_STEP < q_worst_ ? q_best_ + ADAPT_QUALITY_STEP : q_worst_;
+      }
+      return s;
+    }
+
+    bool step_up() {
+      adapt_setting_t s = next_up();
+      if (s.framesize == set_.framesize && s.quality == set_.quality) {
+        room_ = 0;
+        return false;     // already at what the operator asked for
+      }
+      if (since_up_ != UINT32_MAX) {
+        up_hold_ = up_hold_ / 2 > ADAPT_UP_FRAMES ? up_hold_ / 2 : ADAPT_UP_FRAMES;    // the last one held
+      }
+      since_up_ = 0;
+      return apply(s);
+    }
+
+    bool apply(const adapt_setting_t &s) {
+      set_ = s;
+      send_us_ = 0;
+      bytes_ = 0;
+      over_ = 0;
+      room_ = 0;
+      settle_ = ADAPT_SETTLE_FRAMES;
+      steps_++;
+      return true;
+    }
+
+    int fs_min_;
+    int fs_max_;
+    int q_best_;
+    int q_worst_;
+    uint32_t budget_us_;
+    adapt_setting_t set_;
+    uint32_t send_us_;      // filtered, 0 until the first frame after a step
+    uint32_t bytes_;
+    int over_;
+    int room_;
+    int settle_;
+    int up_hold_;
+    uint32_t since_up_;     // frames since a step up still on trial, else UINT32_MAX
+    uint32_t steps_;
+};
+
+#endif
@@ -0,0 +1,83 @@
+/*
+  ESP32CAM Robot Car
+  stream_fanout.h (used by app_httpd.cpp)
+  One /stream viewer's view of the frame ring, and the MJPEG part framing.
+
+  Every viewer keeps a cursor: the sequence number of the last frame it sent.
+  next() pins the newest frame past it, so a viewer that took longer than a
+  frame period to send skips straight to the newest one instead of queueing
+  behind the camera; done() unpins it. Waiting for the capture task and the
+  socket writes stay with the caller, so a host can drive any number of
+  viewers over a simulated link.
+*/
+
+#ifndef STREAM_FANOUT_H
+#define STREAM_FANOUT_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define PART_BOUNDARY "123456789000000000000987654321"
+#define STREAM_BOUNDARY "\r\n--" PART_BOUNDARY "\r\n"
+#define STREAM_PART_LEN  64     // fits STREAM_PART with any 32-bit length
+
+static const char *STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n";
+
+// Part header for a JPEG of len bytes; returns its length
+static inline size_t stream_part_header(char *buf, size_t len) {
+  return snprintf(buf, STREAM_PART_LEN, STREAM_PART, (unsigned)len);
+}
+
+template <typename Ring>
+class StreamCursor {
+  public:
+    typedef typename Ring::Slot Slot;
+
+    explicit StreamCursor(Ring *ring)
+      : ring_(ring), last_seq_(0), gap_(0), sent_(0), skipped_(0) {}
+
+    // Pins the newest frame this viewer has not had yet, NULL if none.
+    Slot *next() {
+      Slot *s = ring_->acquire(last_seq_);
+      if (!s) {
+        return NULL;
+      }
+      gap_ = last_seq_ && s->seq - last_seq_ > 1 ? s->seq - last_seq_ - 1 : 0;
+      skipped_ += gap_;
+      last_seq_ = s->seq;
+      return s;
+    }
+
+    // Unpins s; sent says whether the viewer got all of it.
+    template <typename Release>
+    void done(Slot *s, bool sent, Release release) {
+      ring_->release(s, release);
+      sent_ += sent;
+    }
+
+    uint32_t last_seq() const {
+      return last_seq_;
+    }
+
+    // Frames passed over to reach the one next() returned last
+    uint32_t gap() const {
+      return gap_;
+    }
+
+    uint32_t sent() const {
+      return sent_;
+    }
+
+    uint32_t skipped() const {
+      return skipped_;
+    }
+
+  private:
+    Ring *ring_;
+    uint32_t last_seq_;
+    uint32_t gap_;
+    uint32_t sent_;
+    uint32_t skipped_;
+};
+
+#endif
@@ -0,0 +1,306 @@
+/*
+  ESP32CAM Robot Car
+  ws_control.cpp (requires app_httpd.cpp)
+  Binary motor command channel over a persistent WebSocket on port 82.
+
+  Each command is one fixed-size binary message, so a button press costs a
+  few bytes on an open socket instead of a full HTTP request. /control stays
+  available as the fallback path.
+*/
+
+#include <errno.h>
+#include "Arduino.h"
+#include "lwip/sockets.h"
+#include "mbedtls/sha1.h"
+#include "mbedtls/base64.h"
+#include "esp_timer.h"
+#include "app_tasks.h"
+#include "app_log.h"
+#include "metrics.h"
+
+#define WS_CONTROL_PORT   82
+#define WS_MAX_PAYLOAD    125     // control frames never need extended lengths
+#define WS_RECV_TIMEOUT   2       // seconds a started frame may take to arrive
+#define WS_UPGRADE_MS     2000    // allowed for the whole upgrade request
+#define WS_PENDING        2       // connections still sending their upgrade
+#define WS_REQ_MAX        512
+
+#define WS_OP_CLOSE       0x8
+#define WS_OP_PING        0x9
+#define WS_OP_PONG        0xA
+#define WS_OP_BINARY      0x2
+
+// Wire format, little endian, 8 bytes
+typedef struct __attribute__((packed)) {
+  uint8_t  opcode;      // same numbering as /control?var=car
+  uint8_t  speed;       // 0 keeps the current speed
+  uint16_t duration;    // ms, 0 keeps the default for the opcode
+  uint32_t seq;         // frames not newer than the last one are dropped
+} control_frame_t;
+
+extern bool robot_command(unsigned int op, int new_speed, int duration);
+extern robot_metrics_t metrics;
+
+static const char *WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+static bool ws_recv_all(int fd, uint8_t *buf, size_t len) {
+  while (len) {
+    int n = recv(fd, buf, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+// Header and payload go out in one send(): one segment, and no payload held
+// back by Nagle until the header is acknowledged
+static bool ws_send_frame(int fd, uint8_t opcode, const uint8_t *data, size_t len) {
+  if (len > WS_MAX_PAYLOAD) {
+    return false;
+  }
+  uint8_t frame[2 + WS_MAX_PAYLOAD];
+  frame[0] = 0x80 | opcode;
+  frame[1] = len;
+  if (len) {
+    memcpy(frame + 2, data, len);
+  }
+  return send(fd, frame, 2 + len, 0) == (int)(2 + len);
+}
+
+// A new connection is non-blocking until its upgrade request is complete,
+// and the control task reads it a piece at a time as select() reports data,
+// so a slow or stray client never holds up the controller's commands.
+typedef struct {
+  int fd;               // -1 when free
+  int64_t since;
+  size_t len;
+  char req[WS_REQ_MAX];
+} ws_pending_t;
+
+static ws_pending_t ws_pending[WS_PENDING];
+
+static void ws_pending_drop(ws_pending_t *p) {
+  close(p->fd);
+  p->fd = -1;
+}
+
+// Takes a new connection, dropping the one waiting longest if all are busy
+static void ws_pending_add(int fd, int64_t now) {
+  ws_pending_t *p = &ws_pending[0];
+  for (int i = 0; i < WS_PENDING; i++) {
+    if (ws_pending[i].fd < 0) {
+      p = &ws_pending[i];
+      break;
+    }
+    if (ws_pending[i].since < p->since) {
+      p = &ws_pending[i];
+    }
+  }
+  if (p->fd >= 0) {
+    ws_pending_drop(p);
+  }
+  fcntl(fd, F_SETFL, O_NONBLOCK);
+  p->fd = fd;
+  p->since = now;
+  p->len = 0;
+}
+
+// 1 when the request is complete, 0 for more to come, -1 to drop it
+static int ws_pending_read(ws_pending_t *p) {
+  int n = recv(p->fd, p->req + p->len, WS_REQ_MAX - 1 - p->len, 0);
+  if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    return 0;
+  }
+  if (n <= 0) {
+    return -1;
+  }
+  p->len += n;
+  p->req[p->len] = 0;
+  if (strstr(p->req, "\r\n\r\n")) {
+    return 1;
+  }
+  return p->len < WS_REQ_MAX - 1 ? 0 : -1;
+}
+
+// Answers a complete upgrade request
+static bool ws_handshake(int fd, char *req) {
+  char *key = strcasestr(req, "Sec-WebSocket-Key:");
+  if (!key) {
+    return false;
+  }
+  key += strlen("Sec-WebSocket-Key:");
+  while (*key == ' ') {
+    key++;
+  }
+  char *end = strstr(key, "\r\n");
+  if (!end || end - key > 32) {
+    return false;
+  }
+
+  char concat[96];
+  int clen = snprintf(concat, sizeof(concat), "%.*s%s", (int)(end - key), key, WS_GUID);
+  unsigned char sha[20];
+  unsigned char accept[32];
+  size_t alen = 0;
+  mbedtls_sha1_ret((const unsigned char *)concat, clen, sha);
+  mbedtls_base64_encode(accept, sizeof(accept), &alen, sha, sizeof(sha));
+
+  char rsp[160];
+  int rlen = snprintf(rsp, sizeof(rsp),
+                      "HTTP/1.1 101 Switching Protocols\r\n"
+                      "Upgrade: websocket\r\n"
+                      "Connection: Upgrade\r\n"
+                      "Sec-WebSocket-Accept: %.*s\r\n\r\n", (int)alen, accept);
+  return send(fd, rsp, rlen, 0) == rlen;
+}
+
+// Reads one client frame and acts on it. Returns false when the connection
+// should be dropped.
+static bool ws_handle_frame(int fd, uint32_t *last_seq) {
+  uint8_t hdr[2];
+  uint8_t mask[4];
+  uint8_t payload[WS_MAX_PAYLOAD];
+
+  if (!ws_recv_all(fd, hdr, 2)) {
+    return false;
+  }
+  uint8_t opcode = hdr[0] & 0x0F;
+  size_t len = hdr[1] & 0x7F;
+  if (!(hdr[1] & 0x80) || len > WS_MAX_PAYLOAD) {
+    return false;     // clients must mask, and we never take long frames
+  }
+  if (!ws_recv_all(fd, mask, 4) || !ws_recv_all(fd, payload, len)) {
+    return false;
+  }
+  for (size_t i = 0; i < len; i++) {
+    payload[i] ^= mask[i & 3];
+  }
+
+  switch (opcode) {
+    case WS_OP_CLOSE:
+      ws_send_frame(fd, WS_OP_CLOSE, NULL, 0);
+      return false;
+    case WS_OP_PING:
+      return ws_send_frame(fd, WS_OP_PONG, payload, len);
+    case WS_OP_BINARY:
+      break;
+    default:
+      return true;
+  }
+
+  if (len != sizeof(control_frame_t)) {
+    return true;
+  }
+  control_frame_t f;
+  memcpy(&f, payload, sizeof(f));
+  if ((int32_t)(f.seq - *last_seq) <= 0) {
+    return true;      // late or duplicated command
+  }
+  *last_seq = f.seq;
+  int64_t start = esp_timer_get_time();
+  robot_command(f.opcode, f.speed, f.duration);
+
+  // Ack with the sequence number so the client can measure round trips
+  bool ok = ws_send_frame(fd, WS_OP_BINARY, (const uint8_t *)&f.seq, sizeof(f.seq));
+  metrics.control_us.add_us(esp_timer_get_time() - start);
+  return ok;
+}
+
+// One controller at a time: a new connection replaces the old one.
+static void ws_control_task(void *arg) {
+  app_task_t *me = app_task_self(APP_TASK_WS_CONTROL);
+  int lfd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(WS_CONTROL_PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (lfd < 0 || bind(lfd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(lfd, 2) != 0) {
+    LOG_E("Control server failed");
+    vTaskDelete(NULL);
+    return;
+  }
+
+  for (int i = 0; i < WS_PENDING; i++) {
+    ws_pending[i].fd = -1;
+  }
+  int cfd = -1;
+  uint32_t last_seq = 0;
+  while (true) {
+    fd_set rfds;
+    FD_ZERO(&rfds);
+    FD_SET(lfd, &rfds);
+    int maxfd = lfd;
+    if (cfd >= 0) {
+      FD_SET(cfd, &rfds);
+      maxfd = cfd > maxfd ? cfd : maxfd;
+    }
+    bool waiting = false;
+    for (int i = 0; i < WS_PENDING; i++) {
+      if (ws_pending[i].fd >= 0) {
+        FD_SET(ws_pending[i].fd, &rfds);
+        maxfd = ws_pending[i].fd > maxfd ? ws_pending[i].fd : maxfd;
+        waiting = true;
+      }
+    }
+    // Wake up now and then while an upgrade is pending to time it out
+    struct timeval tick = {0, 250000};
+    if (select(maxfd + 1, &rfds, NULL, NULL, waiting ? &tick : NULL) < 0) {
+      continue;
+    }
+    int64_t now = esp_timer_get_time();
+
+    if (FD_ISSET(lfd, &rfds)) {
+      int nfd = accept(lfd, NULL, NULL);
+      if (nfd >= 0) {
+        ws_pending_add(nfd, now);
+      }
+    }
+
+    for (int i = 0; i < WS_PENDING; i++) {
+      ws_pending_t *p = &ws_pending[i];
+      if (p->fd < 0) {
+        continue;
+      }
+      int state = FD_ISSET(p->fd, &rfds) ? ws_pending_read(p) : 0;
+      if (state > 0) {
+        int nfd = p->fd;
+        p->fd = -1;
+        struct timeval tv = {WS_RECV_TIMEOUT, 0};
+        int one = 1;
+        fcntl(nfd, F_SETFL, 0);
+        setsockopt(nfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        setsockopt(nfd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        if (ws_handshake(nfd, p->req)) {
+          if (cfd >= 0) {
+            close(cfd);
+          }
+          cfd = nfd;
+          last_seq = 0;
+        } else {
+          close(nfd);
+        }
+      } else if (state < 0 || now - p->since > WS_UPGRADE_MS * 1000LL) {
+        ws_pending_drop(p);
+      }
+    }
+
+    if (cfd >= 0 && FD_ISSET(cfd, &rfds)) {
+      int64_t start = esp_timer_get_time();
+      if (!ws_handle_frame(cfd, &last_seq)) {
+        close(cfd);
+        cfd = -1;
+      }
+      app_task_active(me, esp_timer_get_time() - start);
+    }
+  }
+}
+
+void startControlServer()
+{
+  LOG_I("Starting control server on port: '%d'", WS_CONTROL_PORT);
+  app_task_start(APP_TASK_WS_CONTROL, ws_control_task, NULL);
+}
@@ -0,0 +1,154 @@
+// Host benchmark for esp32cam-robot-04/ball_detect.cpp on recorded frames.
+//
+// Takes a directory of JPEGs (frames saved from /capture, say) and runs each
+// through the vision task's first stage: the DC thumbnail from JpegDc, then
+// the coarse BallDetector with the area limit app_httpd.cpp gives it. Every
+// frame is run ROUNDS times; the time per frame is reported for the decode
+// and the detector apart, with the number of frames that had a ball, in
+// frame pixels. -v prints a line per frame.
+//
+// Build (C++11, POSIX):
+//   g++ -O2 -o ball_detect_bench ball_detect_bench.cpp ../esp32cam-robot-04/ball_detect.cpp ../esp32cam-robot-04/ball_segment.cpp ../esp32cam-robot-04/jpeg_dc.cpp
+//
+// Usage:
+//   ball_detect_bench [-v] <directory of .jpg files>
+
+#include <algorithm>
+#include <ctype.h>
+#include <dirent.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "check.h"
+#include "../esp32cam-robot-04/ball_detect.h"
+#include "../esp32cam-robot-04/jpeg_dc.h"
+
+#define ROUNDS  20
+
+static bool is_jpeg(const std::string &name) {
+  size_t dot = name.rfind('.');
+  if (dot == std::string::npos) {
+    return false;
+  }
+  std::string ext = name.substr(dot + 1);
+  for (char &c : ext) {
+    c = tolower((unsigned char)c);
+  }
+  return ext == "jpg" || ext == "jpeg";
+}
+
+static bool read_file(const std::string &path, std::vector<uint8_t> *out) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) {
+    return false;
+  }
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    out->insert(out->end(), buf, buf + n);
+  }
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  bool verbose = argc == 3 && !strcmp(argv[1], "-v");
+  if (argc != 2 && !verbose) {
+    fprintf(stderr, "usage: ball_detect_bench [-v] <directory of .jpg files>\n");
+    return 2;
+  }
+  const char *dir_path = argv[argc - 1];
+  DIR *dir = opendir(dir_path);
+  if (!dir) {
+    perror(dir_path);
+    return 1;
+  }
+  std::vector<std::string> names;
+  while (struct dirent *e = readdir(dir)) {
+    if (is_jpeg(e->d_name)) {
+      names.push_back(e->d_name);
+    }
+  }
+  closedir(dir);
+  std::sort(names.begin(), names.end());
+
+  // As app_httpd.cpp: one thumbnail block is 8x8 pixels
+  BallDetector coarse;
+  ball_color_t color = coarse.color();
+  color.area_min = 1;
+  coarse.set_color(color);
+  JpegDc dc;
+
+  std::vector<uint8_t> thumb(3 * 40 * 30);
+  std::vector<uint32_t> mask;
+  int frames = 0;
+  int failed = 0;
+  int found = 0;
+  size_t bytes = 0;
+  double decode_us = 0;
+  double detect_us = 0;
+
+  for (const std::string &name : names) {
+    std::vector<uint8_t> jpg;
+    if (!read_file(std::string(dir_path) + "/" + name, &jpg)) {
+      perror(name.c_str());
+      failed++;
+      continue;
+    }
+    size_t plane = thumb.size() / 3;
+    jpeg_dc_err_t err = dc.decode(jpg.data(), jpg.size(), &thumb[0], &thumb[plane], &thumb[2 * plane], plane);
+    if (err == JPEG_DC_SIZE) {
+      plane = (size_t)dc.width() * dc.height();
+      thumb.resize(3 * plane);
+      err = dc.decode(jpg.data(), jpg.size(), &thumb[0], &thumb[plane], &thumb[2 * plane], plane);
+    }
+    if (err != JPEG_DC_OK) {
+      if (verbose) {
+        printf("%s: JpegDc error %d\n", name.c_str(), err);
+      }
+      failed++;
+      continue;
+    }
+    int tw = dc.width();
+    int th = dc.height();
+    mask.resize((size_t)th * BALL_MASK_WORDS(tw));
+
+    ball_t ball = {0, 0, 0, 0, 0};
+    int64_t t0 = now_us();
+    for (int k = 0; k < ROUNDS; k++) {
+      dc.decode(jpg.data(), jpg.size(), &thumb[0], &thumb[plane], &thumb[2 * plane], plane);
+    }
+    int64_t t1 = now_us();
+    for (int k = 0; k < ROUNDS; k++) {
+      ball = coarse.detect(&thumb[0], &thumb[plane], &thumb[2 * plane], tw, th, mask.data());
+    }
+    int64_t t2 = now_us();
+
+    double dec = (double)(t1 - t0) / ROUNDS;
+    double det = (double)(t2 - t1) / ROUNDS;
+    decode_us += dec;
+    detect_us += det;
+    bytes += jpg.size();
+    frames++;
+    found += ball.confidence > 0;
+    if (verbose) {
+      printf("%s: %zu B, %dx%d thumbnail, decode %.0f us, detect %.1f us", name.c_str(), jpg.size(), tw, th, dec, det);
+      if (ball.confidence) {
+        printf(", ball at %d,%d r %d (%u%%)\n", ball.x * 8 + 4, ball.y * 8 + 4, ball.r * 8, ball.confidence);
+      } else {
+        printf(", no ball\n");
+      }
+    }
+  }
+
+  if (!frames) {
+    fprintf(stderr, "%s: no frame decoded (%d failed)\n", dir_path, failed);
+    return 1;
+  }
+  printf("%d frames (%zu B avg), %d failed: decode %.0f us, detect %.1f us, %.0f us/frame; ball in %d frames (%.0f%%)\n",
+         frames, bytes / frames, failed, decode_us / frames, detect_us / frames,
+         (decode_us + detect_us) / frames, found, 100.0 * found / frames);
+  CHECK(frames > 0);
+  return check_done("ball_detect_bench");
+}
@@ -0,0 +1,109 @@
+// Host tests for esp32cam-robot-04/ball_segment.h.
+//
+// The vector path has to give the scalar path's mask bit for bit. Both run
+// over random planes for many colour windows and lengths around the 32
+// pixel block, and must clear the unused bits of the last word without
+// writing past it. Then both are timed at QVGA and VGA.
+//
+// Build (C++11 with GCC, for the vector path):
+//   g++ -O2 -o ball_segment_test ball_segment_test.cpp ../esp32cam-robot-04/ball_segment.cpp
+
+#include <vector>
+
+#include "check.h"
+#include "../esp32cam-robot-04/ball_segment.h"
+
+#define SENTINEL  0xdeadbeefu
+
+static uint32_t lcg = 12345;
+
+static uint8_t random8() {
+  lcg = lcg * 1103515245u + 12345u;
+  return lcg >> 23;
+}
+
+typedef void (*segment_fn)(const uint8_t *, const uint8_t *, const uint8_t *, int,
+                           const ball_color_t &, uint32_t *);
+
+static std::vector<uint32_t> run(segment_fn fn, const std::vector<uint8_t> &p, int n,
+                                 const ball_color_t &c) {
+  std::vector<uint32_t> mask(BALL_MASK_WORDS(n) + 1, SENTINEL);
+  fn(p.data(), p.data() + n, p.data() + 2 * n, n, c, mask.data());
+  return mask;
+}
+
+static void test_paths_agree() {
+  const int lengths[] = {1, 7, 31, 32, 33, 63, 64, 65, 1000, 320 * 240 + 5};
+  int mismatches = 0;
+  int overruns = 0;
+  int dirty = 0;
+  int set = 0;
+  for (int t = 0; t < 64; t++) {
+    ball_color_t c = {(uint8_t)(random8() % 60), (uint8_t)(60 + random8() % 61),
+                      random8(), random8(), 1};
+    for (int n : lengths) {
+      std::vector<uint8_t> p(3 * n);
+      for (uint8_t &v : p) {
+        v = random8();
+      }
+      std::vector<uint32_t> s = run(ball_segment_scalar, p, n, c);
+#if BALL_SEGMENT_VECTOR
+      mismatches += run(ball_segment_vector, p, n, c) != s;
+#endif
+      int words = BALL_MASK_WORDS(n);
+      overruns += s[words] != SENTINEL;
+      dirty += n % 32 && s[words - 1] >> (n % 32);
+      for (int i = 0; i < words; i++) {
+        set += s[i] != 0;
+      }
+    }
+  }
+  CHECK(mismatches == 0);
+  CHECK(overruns == 0);
+  CHECK(dirty == 0);
+  CHECK(set > 0);     // the windows did select something
+}
+
+// Known colours either side of the window
+static void test_classify() {
+  ball_color_t c = {40, 90, 80, 80, 1};
+  const uint8_t r[] = {190, 200, 60, 250, 30, 190};
+  const uint8_t g[] = {220, 40, 200, 250, 30, 220};
+  const uint8_t b[] = {60, 40, 220, 250, 20, 215};
+  uint32_t mask = 0;
+  ball_segment_scalar(r, g, b, 6, c, &mask);
+  // yellow-green in, red out, blue out, white out (no saturation), dark out,
+  // and blue just too strong out
+  CHECK(mask == 0x1);
+}
+
+static void bench(int w, int h) {
+  int n = w * h;
+  std::vector<uint8_t> p(3 * n);
+  for (uint8_t &v : p) {
+    v = random8();
+  }
+  std::vector<uint32_t> mask(BALL_MASK_WORDS(n));
+  ball_color_t c = {40, 90, 80, 80, 1};
+  const int iterations = 100;
+  for (int path = 0; path < 1 + BALL_SEGMENT_VECTOR; path++) {
+    segment_fn fn = ball_segment_scalar;
+#if BALL_SEGMENT_VECTOR
+    fn = path ? ball_segment_vector : ball_segment_scalar;
+#endif
+    int64_t start = now_us();
+    for (int i = 0; i < iterations; i++) {
+      fn(p.data(), p.data() + n, p.data() + 2 * n, n, c, mask.data());
+    }
+    double us = now_us() - start;
+    printf("%dx%d %-6s %7.1f MP/s\n", w, h, path ? "vector" : "scalar", (double)n * iterations / us);
+  }
+}
+
+int main() {
+  test_paths_agree();
+  test_classify();
+  bench(320, 240);
+  bench(640, 480);
+  return check_done("ball_segment_test");
+}
@@ -0,0 +1,174 @@
+// Host replay benchmark for esp32cam-robot-04/ball_tracker.h.
+//
+// Renders a QVGA sequence of a ball bouncing over a noisy background, with
+// frames the vision task never sees and a stretch where the ball is hidden,
+// and replays it the way vision_detect() does: search the window the
+// tracker predicts, or the whole frame when there is no track. The same
+// sequence is then searched whole frame every time. Reports the hit rate in
+// windows, the pixels touched per frame and the time per frame for both.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o ball_tracker_bench ball_tracker_bench.cpp ../esp32cam-robot-04/ball_detect.cpp ../esp32cam-robot-04/ball_segment.cpp
+
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "check.h"
+#include "../esp32cam-robot-04/ball_detect.h"
+#include "../esp32cam-robot-04/ball_tracker.h"
+
+#define W         320
+#define H         240
+#define FRAMES    2000
+#define RADIUS    10
+
+static uint32_t lcg = 12345;
+
+static uint8_t random8() {
+  lcg = lcg * 1103515245u + 12345u;
+  return lcg >> 23;
+}
+
+typedef struct {
+  bool seen;            // the vision task got to this frame
+  bool visible;
+  int x, y;             // ball centre, frame pixels
+} truth_t;
+
+class Scene {
+  public:
+    Scene() : x_(30), y_(200), vx_(3.5), vy_(-2.25), plane_(W * H) {
+      lcg = 12345;    // both replays see the same sequence
+      for (int c = 0; c < 3; c++) {
+        background_[c].resize(plane_);
+      }
+      // Grey noise with a red box that must not be taken for the ball
+      for (int i = 0; i < plane_; i++) {
+        uint8_t v = 90 + random8() % 40;
+        bool box = i % W >= 200 && i % W < 240 && i / W >= 40 && i / W < 80;
+        background_[0][i] = box ? 200 : v;
+        background_[1][i] = box ? 40 : v + random8() % 8;
+        background_[2][i] = box ? 40 : v;
+      }
+    }
+
+    // Moves the ball on one frame and renders it into r, g, b
+    truth_t step(uint32_t seq, uint8_t *r, uint8_t *g, uint8_t *b) {
+      x_ += vx_;
+      y_ += vy_;
+      if (x_ < RADIUS || x_ > W - RADIUS) {
+        vx_ = -vx_;
+      }
+      if (y_ < RADIUS || y_ > H - RADIUS) {
+        vy_ = -vy_;
+      }
+      truth_t t = {random8() % 4 != 0, seq % 500 < 480, (int)x_, (int)y_};
+      memcpy(r, background_[0].data(), plane_);
+      memcpy(g, background_[1].data(), plane_);
+      memcpy(b, background_[2].data(), plane_);
+      for (int y = t.y - RADIUS; t.visible && y <= t.y + RADIUS; y++) {
+        for (int x = t.x - RADIUS; x <= t.x + RADIUS; x++) {
+          if (x >= 0 && x < W && y >= 0 && y < H &&
+              (x - t.x) * (x - t.x) + (y - t.y) * (y - t.y) <= RADIUS * RADIUS) {
+            int i = y * W + x;
+            r[i] = 185 + random8() % 10;
+            g[i] = 215 + random8() % 10;
+            b[i] = 60;
+          }
+        }
+      }
+      return t;
+    }
+
+  private:
+    double x_, y_, vx_, vy_;
+    int plane_;
+    std::vector<uint8_t> background_[3];
+};
+
+typedef struct {
+  track_stats_t stats;
+  int found;            // frames the ball was found in
+  int error_max;        // pixels between found and true centre
+  double us;
+} replay_t;
+
+// Copies a window out of the frame, as the decoder callback does
+static void crop(const uint8_t *src, const track_window_t &w, uint8_t *dst) {
+  int ww = w.x1 - w.x0;
+  for (int y = w.y0; y < w.y1; y++) {
+    memcpy(dst + (y - w.y0) * ww, src + y * W + w.x0, ww);
+  }
+}
+
+static replay_t replay(bool track) {
+  Scene scene;
+  BallDetector detector;
+  BallTracker tracker;
+  std::vector<uint8_t> frame(3 * W * H);
+  std::vector<uint8_t> win(3 * W * H);
+  std::vector<uint32_t> mask(H * BALL_MASK_WORDS(W));
+  replay_t out = {track_stats_t(), 0, 0, 0};
+  uint8_t *r = frame.data();
+  uint8_t *g = r + W * H;
+  uint8_t *b = g + W * H;
+
+  for (uint32_t seq = 1; seq <= FRAMES; seq++) {
+    truth_t t = scene.step(seq, r, g, b);
+    if (!t.seen) {
+      continue;
+    }
+    int64_t start = now_us();
+    track_window_t w = {0, 0, W, H};
+    bool windowed = track && tracker.predict(seq, W, H, &w);
+    ball_t ball;
+    int plane = (w.x1 - w.x0) * (w.y1 - w.y0);
+    if (windowed) {
+      crop(r, w, win.data());
+      crop(g, w, win.data() + plane);
+      crop(b, w, win.data() + 2 * plane);
+      ball = detector.detect(win.data(), win.data() + plane, win.data() + 2 * plane,
+                             w.x1 - w.x0, w.y1 - w.y0, mask.data());
+      ball.x += w.x0;
+      ball.y += w.y0;
+    } else {
+      ball = detector.detect(r, g, b, W, H, mask.data());
+    }
+    tracker.update(seq, ball, windowed, plane);
+    out.us += now_us() - start;
+
+    if (ball.confidence && t.visible) {
+      int e = abs(ball.x - t.x) + abs(ball.y - t.y);
+      out.error_max = e > out.error_max ? e : out.error_max;
+      out.found++;
+    }
+  }
+  out.stats = tracker.stats();
+  return out;
+}
+
+static void report(const char *name, const replay_t &r) {
+  const track_stats_t &s = r.stats;
+  printf("%-12s %4u frames  %4u windowed  %4u hits (%5.1f%%)  %u lost  %6.0f px/frame  %6.1f us/frame\n",
+         name, s.frames, s.windowed, s.hits, s.windowed ? 100.0 * s.hits / s.windowed : 0.0, s.lost,
+         (double)s.pixels_total / s.frames, r.us / s.frames);
+}
+
+int main() {
+  replay_t full = replay(false);
+  replay_t tracked = replay(true);
+  report("whole frame", full);
+  report("tracked", tracked);
+
+  const track_stats_t &s = tracked.stats;
+  CHECK(full.stats.windowed == 0 && full.stats.pixels_total == (uint64_t)W * H * full.stats.frames);
+  CHECK(s.frames == full.stats.frames);
+  CHECK(s.windowed > s.frames / 2);
+  CHECK(s.hits * 100 >= s.windowed * 90);     // at least 90% of windows hold the ball
+  CHECK(s.lost >= FRAMES / 500);             // every hidden stretch drops the track...
+  CHECK(tracked.found >= full.found * 98 / 100);   // ...and it is picked up again
+  CHECK(s.pixels_total * 4 < full.stats.pixels_total);
+  CHECK(tracked.error_max <= 2 && full.error_max <= 2);
+  return check_done("ball_tracker_bench");
+}
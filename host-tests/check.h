@@ -0,0 +1,36 @@
+// Checks shared by the host tests.
+//
+// CHECK() reports a failed expression with its line and keeps going, so one
+// run lists every failure; check_done() prints the tally and is what main()
+// returns. Benchmarks time with now_us().
+
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+static int check_failed = 0;
+static int check_passed = 0;
+
+#define CHECK(cond) do { \
+    if (cond) { \
+      check_passed++; \
+    } else { \
+      check_failed++; \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    } \
+  } while (0)
+
+static inline int check_done(const char *name) {
+  printf("%s: %d checks, %d failed\n", name, check_passed + check_failed, check_failed);
+  return check_failed ? 1 : 0;
+}
+
+static inline int64_t now_us() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#endif
@@ -0,0 +1,160 @@
+// Host tests for esp32cam-robot-04/cmd_table.h.
+//
+// Every control variable has to resolve to its own entry, with its range.
+// Names that are not variables must resolve to nothing: prefixes, longer
+// names, other cases, names too long for the handler's buffer, and every
+// string of up to four characters from the names' alphabet, tens of
+// thousands of them landing in a bucket a variable holds. No two may
+// share a bucket, and the table has to be the one the seed gives.
+//
+// Then the lookup is timed against the strcmp() chain /control used before,
+// over every name and some unknown ones.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o cmd_table_test cmd_table_test.cpp
+
+#include <string>
+
+#include "check.h"
+#include "../esp32cam-robot-04/cmd_table.h"
+
+#define BENCH_ROUNDS  200000
+
+static void test_names() {
+  bool found = true;
+  for (size_t i = 0; i < CMD_COUNT; i++) {
+    const cmd_var_t *v = cmd_lookup(cmd_vars[i].name);
+    found &= v == &cmd_vars[i] && v->id == i && v->min <= v->max;
+  }
+  CHECK(found);
+  CHECK(cmd_lookup("car")->max == 5 && cmd_lookup("snap_age")->max == 5000);
+  CHECK(cmd_lookup("framesize")->max == CMD_FRAMESIZE_MAX);
+}
+
+static void test_unknown() {
+  const char *names[] = {
+    "", "a", "al", "fram", "framesizes", "Car", "CAR", "flashof", "flash ",
+    " flash", "speed\t", "auto", "auto_", "nostop1", "snap-age", "quality=3",
+    "0123456789012345678901234567890",    // the longest a query gives
+  };
+  bool none = true;
+  for (const char *n : names) {
+    none &= cmd_lookup(n) == NULL;
+  }
+  CHECK(none);
+
+  bool cut = true;
+  for (size_t i = 0; i < CMD_COUNT; i++) {
+    std::string n = cmd_vars[i].name;
+    // "flash" is the start of "flashoff" and has to find itself
+    for (size_t len = 0; len < n.size(); len++) {
+      const cmd_var_t *v = cmd_lookup(n.substr(0, len).c_str());
+      cut &= v == NULL || v->name == n.substr(0, len);
+    }
+    cut &= cmd_lookup((n + "x").c_str()) == NULL && cmd_lookup((n + n).c_str()) == NULL;
+  }
+  CHECK(cut);
+}
+
+// Every string of 1 to 4 characters from the names' alphabet
+static void test_collisions() {
+  const char alphabet[] = "abcdefghijklmnopqrstuvwxyz_";
+  const int k = sizeof(alphabet) - 1;
+  bool taken[CMD_BUCKETS] = {false};
+  bool apart = true;
+  for (size_t i = 0; i < CMD_COUNT; i++) {
+    apart &= !taken[cmd_bucket(cmd_vars[i].name)];
+    taken[cmd_bucket(cmd_vars[i].name)] = true;
+    apart &= cmd_buckets[cmd_bucket(cmd_vars[i].name)] == i;
+  }
+  CHECK(apart);
+
+  int in_taken = 0;
+  int wrong = 0;
+  char s[5];
+  for (int len = 1; len <= 4; len++) {
+    int total = 1;
+    for (int i = 0; i < len; i++) {
+      total *= k;
+    }
+    for (int n = 0; n < total; n++) {
+      int x = n;
+      for (int i = 0; i < len; i++, x /= k) {
+        s[i] = alphabet[x % k];
+      }
+      s[len] = 0;
+      const cmd_var_t *v = cmd_lookup(s);
+      bool is_name = false;
+      for (size_t i = 0; i < CMD_COUNT; i++) {
+        is_name |= !strcmp(cmd_vars[i].name, s);
+      }
+      in_taken += !is_name && taken[cmd_bucket(s)];
+      wrong += is_name ? v == NULL || strcmp(v->name, s) : v != NULL;
+    }
+  }
+  printf("%d short names that are not variables share a bucket with one\n", in_taken);
+  CHECK(wrong == 0 && in_taken > 1000);
+}
+
+// As app_httpd.cpp before the table, returning what it would have run
+static int strcmp_chain(const char *variable) {
+  if (!strcmp(variable, "framesize"))     return CMD_FRAMESIZE;
+  else if (!strcmp(variable, "quality"))  return CMD_QUALITY;
+  else if (!strcmp(variable, "flash"))    return CMD_FLASH;
+  else if (!strcmp(variable, "flashoff")) return CMD_FLASHOFF;
+  else if (!strcmp(variable, "auto_on"))  return CMD_AUTO_ON;
+  else if (!strcmp(variable, "auto_off")) return CMD_AUTO_OFF;
+  else if (!strcmp(variable, "speed"))    return CMD_SPEED;
+  else if (!strcmp(variable, "nostop"))   return CMD_NOSTOP;
+  else if (!strcmp(variable, "car"))      return CMD_CAR;
+  else if (!strcmp(variable, "adaptive")) return CMD_ADAPTIVE;
+  else if (!strcmp(variable, "snap_age")) return CMD_SNAP_AGE;
+  return CMD_COUNT;
+}
+
+static void bench() {
+  // Copies, so neither side gets to compare pointers
+  char names[CMD_COUNT + 3][32];
+  for (size_t i = 0; i < CMD_COUNT; i++) {
+    strcpy(names[i], cmd_vars[i].name);
+  }
+  strcpy(names[CMD_COUNT], "speeds");
+  strcpy(names[CMD_COUNT + 1], "al");
+  strcpy(names[CMD_COUNT + 2], "joystick");
+  const int n = sizeof(names) / sizeof(names[0]);
+
+  bool same = true;
+  for (int i = 0; i < n; i++) {
+    const cmd_var_t *v = cmd_lookup(names[i]);
+    same &= (v ? v->id : (int)CMD_COUNT) == strcmp_chain(names[i]);
+  }
+  CHECK(same);
+
+  volatile int sink = 0;
+  int64_t t0 = now_us();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (int i = 0; i < n; i++) {
+      sink = sink + strcmp_chain(names[i]);
+    }
+  }
+  int64_t t1 = now_us();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (int i = 0; i < n; i++) {
+      const cmd_var_t *v = cmd_lookup(names[i]);
+      sink = sink + (v ? v->id : (int)CMD_COUNT);
+    }
+  }
+  int64_t t2 = now_us();
+  double chain_ns = (t1 - t0) * 1000.0 / BENCH_ROUNDS / n;
+  double table_ns = (t2 - t1) * 1000.0 / BENCH_ROUNDS / n;
+  printf("lookup of %d names: strcmp chain %.1f ns, hashed table %.1f ns (%.1fx)\n",
+         n, chain_ns, table_ns, chain_ns / table_ns);
+}
+
+int main() {
+  test_names();
+  test_unknown();
+  test_collisions();
+  bench();
+  return check_done("cmd_table_test");
+}
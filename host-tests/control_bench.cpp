@@ -0,0 +1,291 @@
+// Host benchmark for the two motor command paths of esp32cam-robot-04.
+//
+// A stand-in server on loopback answers both the way the robot does:
+// /control?var=car&val=N as an HTTP/1.1 request on a keep-alive connection,
+// what each fetch() of the old page costs, and the 8 byte binary frame of
+// ws_control.cpp on an upgraded WebSocket, acked with its sequence number.
+// The client sends one command at a time and waits for the reply, like a
+// driver holding a button, and reports commands/sec and round trip
+// percentiles for each path, with the bytes each command puts on the link.
+// On a PC both paths are mostly system calls and come out close; on the
+// robot the bytes go over a few Mbit/s of WiFi and every HTTP request is a
+// trip through httpd's parser, which is where the binary channel wins.
+//
+// Build (C++11 and POSIX, nothing else):
+//   g++ -O2 -pthread -o control_bench control_bench.cpp
+//
+// Usage:
+//   control_bench [commands]     (20000 per path by default)
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "check.h"
+
+#define REQ_MAX   1024
+
+// Same layout as control_frame_t in ws_control.cpp
+typedef struct __attribute__((packed)) {
+  uint8_t  opcode;
+  uint8_t  speed;
+  uint16_t duration;
+  uint32_t seq;
+} control_frame_t;
+
+static volatile unsigned commands_run = 0;
+
+static void robot_command(unsigned op) {
+  commands_run += op < 6;
+}
+
+static bool recv_all(int fd, void *buf, size_t len) {
+  uint8_t *p = (uint8_t *)buf;
+  while (len) {
+    ssize_t n = recv(fd, p, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool send_all(int fd, const void *buf, size_t len) {
+  return send(fd, buf, len, 0) == (ssize_t)len;
+}
+
+// Reads up to the blank line ending the headers
+static int recv_head(int fd, char *buf, size_t size) {
+  size_t len = 0;
+  while (len < size - 1) {
+    ssize_t n = recv(fd, buf + len, size - 1 - len, 0);
+    if (n <= 0) {
+      return -1;
+    }
+    len += n;
+    buf[len] = 0;
+    if (strstr(buf, "\r\n\r\n")) {
+      return len;
+    }
+  }
+  return -1;
+}
+
+// The query handling of cmd_handler: copy the query out, then find each key
+static bool query_value(const char *query, const char *key, char *val, size_t size) {
+  size_t klen = strlen(key);
+  for (const char *p = query; p && *p; p = strchr(p, '&'), p = p ? p + 1 : p) {
+    if (!strncmp(p, key, klen) && p[klen] == '=') {
+      size_t n = strcspn(p + klen + 1, "& ");
+      n = n < size - 1 ? n : size - 1;
+      memcpy(val, p + klen + 1, n);
+      val[n] = 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void serve_http(int fd) {
+  static const char rsp[] = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n"
+                            "Access-Control-Allow-Origin: *\r\n\r\n";
+  char req[REQ_MAX];
+  while (recv_head(fd, req, sizeof(req)) > 0) {
+    char *q = strchr(req, '?');
+    char *end = q ? strchr(q, ' ') : NULL;
+    if (!end) {
+      break;
+    }
+    char *query = (char *)malloc(end - q);
+    memcpy(query, q + 1, end - q - 1);
+    query[end - q - 1] = 0;
+    char var[32];
+    char val[32];
+    if (query_value(query, "var", var, sizeof(var)) && query_value(query, "val", val, sizeof(val)) &&
+        !strcmp(var, "car")) {
+      robot_command(atoi(val));
+    }
+    free(query);
+    if (!send_all(fd, rsp, sizeof(rsp) - 1)) {
+      break;
+    }
+  }
+}
+
+// The upgrade is not what is measured, so the accept key is not computed
+static void serve_ws(int fd) {
+  static const char rsp[] = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                            "Connection: Upgrade\r\nSec-WebSocket-Accept: x\r\n\r\n";
+  char req[REQ_MAX];
+  if (recv_head(fd, req, sizeof(req)) < 0 || !send_all(fd, rsp, sizeof(rsp) - 1)) {
+    return;
+  }
+  uint32_t last_seq = 0;
+  while (true) {
+    uint8_t hdr[2];
+    uint8_t mask[4];
+    uint8_t payload[125];
+    if (!recv_all(fd, hdr, 2)) {
+      return;
+    }
+    size_t len = hdr[1] & 0x7F;
+    if (!recv_all(fd, mask, 4) || !recv_all(fd, payload, len)) {
+      return;
+    }
+    for (size_t i = 0; i < len; i++) {
+      payload[i] ^= mask[i & 3];
+    }
+    if (len != sizeof(control_frame_t)) {
+      continue;
+    }
+    control_frame_t f;
+    memcpy(&f, payload, sizeof(f));
+    if ((int32_t)(f.seq - last_seq) <= 0) {
+      continue;
+    }
+    last_seq = f.seq;
+    robot_command(f.opcode);
+    uint8_t ack[6] = {0x82, 4};
+    memcpy(ack + 2, &f.seq, 4);
+    if (!send_all(fd, ack, sizeof(ack))) {
+      return;
+    }
+  }
+}
+
+static int listen_any(int *port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t alen = sizeof(addr);
+  if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) || listen(fd, 1) ||
+      getsockname(fd, (struct sockaddr *)&addr, &alen)) {
+    perror("listen");
+    exit(1);
+  }
+  *port = ntohs(addr.sin_port);
+  return fd;
+}
+
+static int connect_to(int port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  int one = 1;
+  if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr))) {
+    perror("connect");
+    exit(1);
+  }
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  return fd;
+}
+
+// Starts the server side on its own thread, returns the client's socket
+static int start(void (*serve)(int), std::thread *t) {
+  int port;
+  int lfd = listen_any(&port);
+  *t = std::thread([lfd, serve] {
+    int fd = accept(lfd, NULL, NULL);
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    serve(fd);
+    close(fd);
+    close(lfd);
+  });
+  return connect_to(port);
+}
+
+static void report(const char *name, std::vector<int64_t> &rtt, int64_t total_us, size_t bytes) {
+  std::sort(rtt.begin(), rtt.end());
+  size_t n = rtt.size();
+  printf("%-10s %8.0f cmd/s   p50 %5lld us   p99 %5lld us   max %6lld us   %4zu B/cmd\n", name,
+         n * 1e6 / total_us, (long long)rtt[n / 2], (long long)rtt[n * 99 / 100],
+         (long long)rtt[n - 1], bytes / n);
+}
+
+static bool bench_http(int n) {
+  std::thread server;
+  int fd = start(serve_http, &server);
+  std::vector<int64_t> rtt;
+  char req[256];
+  char rsp[REQ_MAX];
+  size_t bytes = 0;
+  int64_t begin = now_us();
+  for (int i = 0; i < n; i++) {
+    // What fetch() sends from the control page, give or take the browser
+    int len = snprintf(req, sizeof(req),
+                       "GET /control?var=car&val=%d HTTP/1.1\r\nHost: 192.168.4.1\r\n"
+                       "User-Agent: Mozilla/5.0\r\nAccept: */*\r\nConnection: keep-alive\r\n\r\n",
+                       1 + i % 5);
+    int64_t t = now_us();
+    int rlen = send_all(fd, req, len) ? recv_head(fd, rsp, sizeof(rsp)) : -1;
+    if (rlen < 0) {
+      return false;
+    }
+    rtt.push_back(now_us() - t);
+    bytes += len + rlen;
+  }
+  report("/control", rtt, now_us() - begin, bytes);
+  close(fd);
+  server.join();
+  return true;
+}
+
+static bool bench_ws(int n) {
+  std::thread server;
+  int fd = start(serve_ws, &server);
+  static const char upgrade[] = "GET / HTTP/1.1\r\nHost: 192.168.4.1\r\nUpgrade: websocket\r\n"
+                                "Connection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                                "Sec-WebSocket-Version: 13\r\n\r\n";
+  char rsp[REQ_MAX];
+  if (!send_all(fd, upgrade, sizeof(upgrade) - 1) || recv_head(fd, rsp, sizeof(rsp)) < 0) {
+    return false;
+  }
+  std::vector<int64_t> rtt;
+  int64_t begin = now_us();
+  for (int i = 0; i < n; i++) {
+    control_frame_t f = {(uint8_t)(1 + i % 5), 0, 0, (uint32_t)i + 1};
+    uint8_t msg[2 + 4 + sizeof(f)] = {0x82, 0x80 | sizeof(f), 0x12, 0x34, 0x56, 0x78};
+    memcpy(msg + 6, &f, sizeof(f));
+    for (size_t j = 0; j < sizeof(f); j++) {
+      msg[6 + j] ^= msg[2 + (j & 3)];
+    }
+    uint8_t ack[6];
+    int64_t t = now_us();
+    if (!send_all(fd, msg, sizeof(msg)) || !recv_all(fd, ack, sizeof(ack)) ||
+        memcmp(ack + 2, &f.seq, 4)) {
+      return false;
+    }
+    rtt.push_back(now_us() - t);
+  }
+  report("websocket", rtt, now_us() - begin, n * (2 + 4 + sizeof(control_frame_t) + 6));
+  close(fd);
+  server.join();
+  return true;
+}
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 20000;
+  if (n < 100) {
+    fprintf(stderr, "usage: control_bench [commands, at least 100]\n");
+    return 2;
+  }
+  bool ok = bench_http(n) && bench_ws(n);
+  CHECK(ok);
+  CHECK(commands_run == 2u * n);
+  return check_done("control_bench");
+}
@@ -0,0 +1,153 @@
+// Host tests for arduino-control-04/fast_io.h.
+//
+// fast_port() and fast_bit() of all 20 Uno pins are checked against the
+// core's digital_pin_to_port_PGM and digital_pin_to_bit_mask_PGM tables
+// (variants/standard/pins_arduino.h), copied below. Then every pin the
+// sketch uses, restated from arduino-control-04.ino and motor_control.ino,
+// is checked on its own and in the masks the sketch builds: the motor
+// direction pins, whose write may touch no other pin the sketch drives, the
+// line and ball sensors, all on port C for the PCINT1 handler, and the
+// echo pins on port B for the PCINT0 one. The masks are also checked at
+// compile time, so a pin moved in the sketch has to be moved here too.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o fast_io_test fast_io_test.cpp
+
+#include "check.h"
+#include "../arduino-control-04/fast_io.h"
+
+// Arduino.h port numbers and the standard variant's tables, pins 0 to 19
+#define PB 2
+#define PC 3
+#define PD 4
+
+static const uint8_t digital_pin_to_port[20] = {
+  PD, PD, PD, PD, PD, PD, PD, PD,
+  PB, PB, PB, PB, PB, PB,
+  PC, PC, PC, PC, PC, PC,
+};
+
+static const uint8_t digital_pin_to_bit_mask[20] = {
+  1 << 0, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7,
+  1 << 0, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5,
+  1 << 0, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5,
+};
+
+// digitalPinToPCICRbit(): which pin change interrupt a pin is on
+static uint8_t pcint_group(uint8_t pin) {
+  return pin <= 7 ? 2 : pin <= 13 ? 0 : 1;
+}
+
+static uint8_t core_port(uint8_t fast) {
+  return fast == FAST_PORT_B ? PB : fast == FAST_PORT_C ? PC : PD;
+}
+
+// As arduino-control-04.ino and motor_control.ino
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+
+const int wakePin     = 2;
+const int motorA1     = 3;
+const int motorA2     = 4;
+const int motorAspeed = 5;
+const int motorBspeed = 6;
+const int motorB1     = 7;
+const int motorB2     = 8;
+const int trig_down   = 9;
+const int echo_down   = 10;
+const int trig_up     = 11;
+const int echo_up     = 12;
+const int serpin      = 13;
+const int L_S         = A0;
+const int R_S         = A1;
+const int ball_detect = A2;
+const int encoderA    = A3;
+const int encoderB    = A4;   // the LED's pin, ledPin
+const uint32_t motor_pins = FastPins<motorA1, motorA2, motorB1, motorB2>::bits;
+const uint32_t ir_pins = FastPins<L_S, R_S, ball_detect>::bits;
+
+static_assert(fast_port_bits(motor_pins, FAST_PORT_D) == 0x98 &&
+              fast_port_bits(motor_pins, FAST_PORT_B) == 0x01 &&
+              fast_port_bits(motor_pins, FAST_PORT_C) == 0, "motor pins are PD3, PD4, PD7 and PB0");
+static_assert(ir_pins == (uint32_t)0x07 << (8 * FAST_PORT_C), "line and ball sensors are PC0-PC2");
+
+static const struct {
+  const char *name;
+  uint8_t pin;
+} used[] = {
+  {"wakePin", wakePin}, {"motorA1", motorA1}, {"motorA2", motorA2},
+  {"motorAspeed", motorAspeed}, {"motorBspeed", motorBspeed},
+  {"motorB1", motorB1}, {"motorB2", motorB2}, {"trig_down", trig_down},
+  {"echo_down", echo_down}, {"trig_up", trig_up}, {"echo_up", echo_up},
+  {"serpin", serpin}, {"L_S", L_S}, {"R_S", R_S}, {"ball_detect", ball_detect},
+  {"encoderA", encoderA}, {"encoderB", encoderB},
+};
+
+static void test_core_tables() {
+  bool same = true;
+  for (uint8_t pin = 0; pin < 20; pin++) {
+    uint32_t bits = fast_bits(pin);
+    same &= core_port(fast_port(pin)) == digital_pin_to_port[pin];
+    same &= (1 << fast_bit(pin)) == digital_pin_to_bit_mask[pin];
+    // One bit, in its port's byte only
+    same &= fast_port_bits(bits, fast_port(pin)) == digital_pin_to_bit_mask[pin];
+    same &= bits == (uint32_t)digital_pin_to_bit_mask[pin] << (8 * fast_port(pin));
+  }
+  CHECK(same);
+}
+
+static void test_sketch_pins() {
+  uint32_t all = 0;
+  bool apart = true;
+  for (const auto &u : used) {
+    uint32_t bits = fast_bits(u.pin);
+    bool ok = core_port(fast_port(u.pin)) == digital_pin_to_port[u.pin] &&
+              fast_port_bits(bits, fast_port(u.pin)) == digital_pin_to_bit_mask[u.pin];
+    if (!ok) {
+      fprintf(stderr, "%s (pin %u) resolves to the wrong port or bit\n", u.name, u.pin);
+    }
+    CHECK(ok);
+    apart &= !(all & bits);
+    all |= bits;
+  }
+  CHECK(apart);   // no two names on one pin
+
+  // Direction write: exactly the four direction pins, on two ports, and none
+  // of the other pins the sketch drives or reads
+  uint32_t motor = fast_bits(motorA1) | fast_bits(motorA2) | fast_bits(motorB1) | fast_bits(motorB2);
+  CHECK(motor_pins == motor);
+  CHECK(fast_port_bits(motor_pins, FAST_PORT_D) == (digital_pin_to_bit_mask[motorA1] | digital_pin_to_bit_mask[motorA2] |
+                                                    digital_pin_to_bit_mask[motorB1]));
+  CHECK(fast_port_bits(motor_pins, FAST_PORT_B) == digital_pin_to_bit_mask[motorB2]);
+  CHECK(!(motor_pins & (all ^ motor)));
+
+  // Sensors the PCINT1 handler reads from PINC, echo pins the PCINT0 one
+  // reads from PINB
+  CHECK(ir_pins == (fast_bits(L_S) | fast_bits(R_S) | fast_bits(ball_detect)));
+  CHECK(fast_port_bits(ir_pins, FAST_PORT_C) == (digital_pin_to_bit_mask[L_S] | digital_pin_to_bit_mask[R_S] |
+                                                 digital_pin_to_bit_mask[ball_detect]));
+  CHECK(!fast_port_bits(ir_pins, FAST_PORT_B) && !fast_port_bits(ir_pins, FAST_PORT_D));
+  CHECK(pcint_group(L_S) == 1 && pcint_group(R_S) == 1 && pcint_group(ball_detect) == 1 &&
+        pcint_group(encoderA) == 1 && pcint_group(encoderB) == 1);
+  CHECK(fast_port(encoderA) == FAST_PORT_C && fast_port(encoderB) == FAST_PORT_C);
+  CHECK(!(ir_pins & (fast_bits(encoderA) | fast_bits(encoderB))));
+  CHECK(pcint_group(echo_up) == 0 && pcint_group(echo_down) == 0);
+  CHECK(fast_port(echo_up) == FAST_PORT_B && fast_port(echo_down) == FAST_PORT_B);
+
+  // The direction of each wheel as motor_apply() sets it
+  uint32_t forward = fast_bits(motorA2) | fast_bits(motorB2);
+  uint32_t back = fast_bits(motorA1) | fast_bits(motorB1);
+  CHECK(!(forward & back) && (forward | back) == motor_pins);
+  printf("motor_pins PORTD %02x PORTB %02x, ir_pins PORTC %02x, %zu pins checked\n",
+         fast_port_bits(motor_pins, FAST_PORT_D), fast_port_bits(motor_pins, FAST_PORT_B),
+         fast_port_bits(ir_pins, FAST_PORT_C), sizeof(used) / sizeof(used[0]));
+}
+
+int main() {
+  test_core_tables();
+  test_sketch_pins();
+  return check_done("fast_io_test");
+}
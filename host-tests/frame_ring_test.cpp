@@ -0,0 +1,195 @@
+// Host tests for esp32cam-robot-04/frame_ring.h, one producer and several
+// readers on threads.
+//
+// Frames are heap buffers filled with their id, as the capture task's JPEG
+// copies are. The producer collects and publishes as fast as it can; each
+// reader pins the newest frame, checks it is whole, holds it a while, checks
+// it again and unpins it. Giving a frame back scribbles over it before
+// freeing it, so a pinned frame handed back or a slot refilled under a
+// reader shows up as a torn frame (and as a use after free or a race under
+// the sanitizers). Every frame has to be given back exactly once, each
+// reader has to see sequence numbers only go up, and once the readers are
+// gone every reader count has to be back to zero: all but the newest slot
+// free again, the newest one still there to be pinned. Both ring modes are
+// run, keeping the newest frame and giving it back too.
+//
+// Build (C++11, threads; run it under ThreadSanitizer too):
+//   g++ -O2 -pthread -o frame_ring_test frame_ring_test.cpp
+//   g++ -O1 -g -fsanitize=thread -pthread -o frame_ring_test frame_ring_test.cpp
+
+#include <atomic>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+#include "../esp32cam-robot-04/frame_ring.h"
+
+#define READERS       4
+#define SLOTS         (READERS + 2)     // a pin per reader, the newest, the next
+#define FRAMES        100000
+#define FRAME_WORDS   64
+
+typedef struct {
+  uint32_t id;
+  uint32_t *buf;
+} frame_t;
+
+typedef FrameRing<frame_t, SLOTS> ring_t;
+
+static std::atomic<uint8_t> given_back[FRAMES];
+static std::atomic<uint32_t> double_given_back;
+static std::atomic<uint32_t> torn;
+
+static bool whole(const frame_t &f) {
+  for (int i = 0; i < FRAME_WORDS; i++) {
+    if (f.buf[i] != f.id) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void frame_return(const frame_t &f) {
+  if (!whole(f)) {
+    torn++;
+  }
+  if (given_back[f.id].exchange(1)) {
+    double_given_back++;
+  }
+  memset(f.buf, 0xa5, FRAME_WORDS * sizeof(uint32_t));
+  free(f.buf);
+}
+
+typedef struct {
+  uint32_t pins;
+  uint32_t backwards;     // a pin older than the one before it
+} reader_stats_t;
+
+static void reader(ring_t *ring, std::atomic<bool> *stop, reader_stats_t *st) {
+  uint32_t last_seq = 0;
+  uint32_t spin = 0;
+  while (!stop->load()) {
+    ring_t::Slot *s = ring->acquire(last_seq);
+    if (!s) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (s->seq < last_seq) {
+      st->backwards++;
+    }
+    last_seq = s->seq;
+    frame_t f = s->item;
+    if (!whole(f)) {
+      torn++;
+    }
+    // Hold it for a while now and then, like a send the socket holds up,
+    // while the producer moves on
+    if (spin++ % 2) {
+      std::this_thread::yield();
+    }
+    if (!whole(s->item) || s->item.id != f.id) {
+      torn++;
+    }
+    ring->release(s, frame_return);
+    st->pins++;
+  }
+}
+
+static void run(bool keep_latest) {
+  ring_t ring(keep_latest);
+  for (int i = 0; i < FRAMES; i++) {
+    given_back[i] = 0;
+  }
+  double_given_back = 0;
+  torn = 0;
+
+  std::atomic<bool> stop(false);
+  reader_stats_t stats[READERS];
+  memset(stats, 0, sizeof(stats));
+  std::vector<std::thread> readers;
+  for (int r = 0; r < READERS; r++) {
+    readers.emplace_back(reader, &ring, &stop, &stats[r]);
+  }
+
+  uint32_t full = 0;
+  int64_t start = now_us();
+  for (uint32_t id = 0; id < FRAMES; id++) {
+    frame_t f = {id, (uint32_t *)malloc(FRAME_WORDS * sizeof(uint32_t))};
+    for (int i = 0; i < FRAME_WORDS; i++) {
+      f.buf[i] = id;
+    }
+    // The grab takes a while: let the readers in, so they pin all kinds of
+    // frames, the newest, one just replaced, one about to be given back
+    if (id % 3 == 0) {
+      std::this_thread::yield();
+    }
+    ring.collect(frame_return);
+    // A slot a reader is giving back right now is neither free nor pinned
+    while (!ring.publish(f)) {
+      full++;
+      std::this_thread::yield();
+      ring.collect(frame_return);
+    }
+  }
+  int64_t took = now_us() - start;
+  stop = true;
+  for (auto &t : readers) {
+    t.join();
+  }
+
+  uint32_t pins = 0;
+  uint32_t backwards = 0;
+  for (int r = 0; r < READERS; r++) {
+    pins += stats[r].pins;
+    backwards += stats[r].backwards;
+  }
+  printf("%s: %d frames in %lld us, %u pins by %d readers, publish retried %u times\n",
+         keep_latest ? "keep newest" : "give newest back", FRAMES, (long long)took, pins, READERS, full);
+  CHECK(torn == 0 && backwards == 0 && double_given_back == 0);
+  CHECK(pins > FRAMES / 10);
+
+  // Readers gone: every count is zero, so everything stale is collected
+  ring.collect(frame_return);
+  uint32_t back = 0;
+  for (int i = 0; i < FRAMES; i++) {
+    back += given_back[i];
+  }
+  uint32_t *newest = NULL;
+  if (keep_latest) {
+    CHECK(back == FRAMES - 1 && !given_back[FRAMES - 1]);
+    ring_t::Slot *s = ring.acquire(0);
+    CHECK(s && s->item.id == FRAMES - 1 && whole(s->item));
+    if (s) {
+      newest = s->item.buf;
+      ring.release(s, frame_return);
+    }
+    CHECK(!given_back[FRAMES - 1]);
+  } else {
+    CHECK(back == FRAMES);
+    CHECK(ring.acquire(0) == NULL);
+  }
+
+  // ...and every slot but the newest one takes a frame again
+  std::vector<uint32_t *> more;
+  for (int i = 0; i < SLOTS; i++) {
+    frame_t f = {0, (uint32_t *)calloc(FRAME_WORDS, sizeof(uint32_t))};
+    if (ring.publish(f)) {
+      more.push_back(f.buf);
+    } else {
+      free(f.buf);
+    }
+  }
+  CHECK((int)more.size() == (keep_latest ? SLOTS - 1 : SLOTS));
+  for (uint32_t *buf : more) {
+    free(buf);
+  }
+  free(newest);
+}
+
+int main() {
+  run(true);
+  run(false);
+  return check_done("frame_ring_test");
+}
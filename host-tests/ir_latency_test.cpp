@@ -0,0 +1,237 @@
+// Line-to-stop latency of arduino-control-04, simulated three ways.
+//
+// The robot drives onto the boundary line at cruise: both line sensors see
+// it for 20 to 125 ms (a 5 cm line at 0.4 m/s, crossed square or at an
+// angle). The latency is from the moment both see it to the moment the
+// direction pins are cut; a crossing nobody looks at in time is missed.
+//
+//   loop()     the original sketch: one pass of loop() runs ultrasonic_up()
+//              with pulseIn(), sensor_ir() with its delay(10), and the whole
+//              servo sweep with pulseIn() and delay(15) per degree, all
+//              printing at 9600 baud, and reads the sensors once
+//   1 kHz      the ir task of the cooperative scheduler (scheduler.h, run on
+//              a virtual clock with the sketch's task table) polling them
+//   interrupt  the PCINT1 handler of sensor_IR.ino, which cuts the pins
+//              itself: it waits only for an interrupt already running or a
+//              short noInterrupts() section in the sketch
+//
+// The run times given to the tasks and interrupts are assumed worst cases
+// at 16 MHz, each run taking 30 to 100% of its worst case.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o ir_latency_test ir_latency_test.cpp
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "check.h"
+#include "../arduino-control-04/scheduler.h"
+
+#define HORIZON_US    600000000.0   // 10 minutes of driving
+#define CROSSINGS     2000
+#define BYTE_US       1042          // 9600 baud
+#define ISR_ENTRY_US  3             // PCINT1 prologue to fast_write()
+
+static std::mt19937 rng(7);
+
+static double uniform(double lo, double hi) {
+  return lo + (hi - lo) * (rng() / 4294967296.0);
+}
+
+// Echo of an HC-SR04 at a random distance; no echo is a 38 ms pulse
+static double echo_us(double min_cm, double max_cm) {
+  return uniform(0, 1) < 0.03 ? 38000 : uniform(min_cm, max_cm) * 58.3;
+}
+
+// Serial with its 64 byte buffer: print() only waits when it is full
+typedef struct {
+  double t;
+  double free_at;       // when the last queued byte is out
+} serial_t;
+
+static void print(serial_t *s, int bytes) {
+  if (s->free_at < s->t) {
+    s->free_at = s->t;
+  }
+  s->free_at += bytes * BYTE_US;
+  double full = s->free_at - 64 * BYTE_US;
+  if (full > s->t) {
+    s->t = full;
+  }
+}
+
+// Times the original loop() reads the line sensors
+static std::vector<double> loop_samples() {
+  std::vector<double> samples;
+  serial_t s = {0, 0};
+  while (s.t < HORIZON_US) {
+    s.t += 12 + echo_us(30, 300);       // ultrasonic_up()
+    print(&s, 19);                      // "Up_Distance: 123"
+    samples.push_back(s.t);             // sensor_ir()
+    s.t += 10000;
+    print(&s, 9);                       // "forward"
+    for (int step = 0; step < 93; step++) {   // servo_control(), 90-120-60-90
+      s.t += 12 + echo_us(15, 80);
+      print(&s, 9);                     // "105,23."
+      s.t += 15000;
+    }
+  }
+  return samples;
+}
+
+// The sketch's task table with each task's assumed worst case run time
+static uint32_t vclock;
+static std::vector<double> ir_runs;
+
+static uint32_t clock_us() {
+  return vclock;
+}
+
+static void spend(double worst_us) {
+  vclock += (uint32_t)uniform(0.3 * worst_us, worst_us);
+}
+
+static void task_ir()       { ir_runs.push_back(vclock); spend(60); }
+static void motor_task()    { spend(400); }     // two PI steps, analogWrite
+static void ultrasonic_up() { spend(30); }
+static void task_servo()    { spend(60); }
+static void sleep_mode()    { spend(10); }
+static void blink()         { spend(5); }
+static void telem_state()   { spend(300); }     // frame build and CRC
+static void telem_pump()    { spend(150); }
+static void sched_report()  { spend(1500); }    // a frame per task
+
+static std::vector<double> sched_samples() {
+  sched_task_t tasks[] = {
+    SCHED_TASK("ir",         task_ir,       1000UL,    0),
+    SCHED_TASK("motor",      motor_task,    50000UL,   0),
+    SCHED_TASK("ultrasonic", ultrasonic_up, 1000UL,    0),
+    SCHED_TASK("servo",      task_servo,    2000UL,    0),
+    SCHED_TASK("sleep",      sleep_mode,    100000UL,  0),
+    SCHED_TASK("led",        blink,         10000UL,   0),
+    SCHED_TASK("state",      telem_state,   50000UL,   0),
+    SCHED_TASK("telemetry",  telem_pump,    5000UL,    0),
+    SCHED_TASK("report",     sched_report,  5000000UL, 0),
+  };
+  Scheduler sched(tasks, sizeof(tasks) / sizeof(tasks[0]), clock_us);
+  vclock = 0;
+  ir_runs.clear();
+  sched.begin();
+  while (vclock < HORIZON_US) {
+    if (!sched.run()) {
+      vclock += 8;
+    }
+  }
+  return ir_runs;
+}
+
+// Times interrupts are held off: other interrupts (AVR interrupts do not
+// nest) and the sketch's noInterrupts() sections, as [start, end)
+typedef struct {
+  double start;
+  double end;
+} window_t;
+
+static std::vector<window_t> masked_windows() {
+  std::vector<window_t> w;
+  struct {
+    double period_us;
+    double worst_us;
+  } sources[] = {
+    {1024, 6},      // timer0 overflow, millis()
+    {BYTE_US, 5},   // UART data register empty
+    {2500, 5},      // wheel encoder edges on PCINT1
+    {30000, 8},     // ranging echo edges
+    {1000, 2},      // encoder tick copy in motor_task(), the event queue pop
+    {50000, 2},     // motor_apply()
+  };
+  for (auto &s : sources) {
+    for (double t = uniform(0, s.period_us); t < HORIZON_US; t += s.period_us * uniform(0.8, 1.2)) {
+      w.push_back({t, t + uniform(0.3 * s.worst_us, s.worst_us)});
+    }
+  }
+  std::sort(w.begin(), w.end(), [](const window_t &a, const window_t &b) { return a.start < b.start; });
+  return w;
+}
+
+typedef struct {
+  const char *name;
+  int missed;
+  double worst;
+  double total;
+  int seen;
+  double bound;         // worst possible: the longest gap between looks, or window
+} result_t;
+
+static void report(const result_t &r) {
+  printf("%-9s  missed %4d of %d  latency avg %8.1f us  worst %9.1f us  worst possible %9.1f us\n",
+         r.name, r.missed, CROSSINGS, r.seen ? r.total / r.seen : 0, r.worst, r.bound);
+}
+
+// Latency of each crossing against the times something looks at the sensors
+static result_t polled(const char *name, const std::vector<double> &samples,
+                       const std::vector<double> &arrive, const std::vector<double> &dwell) {
+  result_t r = {name, 0, 0, 0, 0, 0};
+  for (size_t i = 1; i < samples.size(); i++) {
+    r.bound = std::max(r.bound, samples[i] - samples[i - 1]);
+  }
+  for (size_t i = 0; i < arrive.size(); i++) {
+    auto next = std::lower_bound(samples.begin(), samples.end(), arrive[i]);
+    if (next == samples.end() || *next >= arrive[i] + dwell[i]) {
+      r.missed++;
+      continue;
+    }
+    double latency = *next - arrive[i];
+    r.worst = std::max(r.worst, latency);
+    r.total += latency;
+    r.seen++;
+  }
+  return r;
+}
+
+static result_t interrupt(const std::vector<window_t> &masked, const std::vector<double> &arrive) {
+  result_t r = {"interrupt", 0, 0, 0, 0, 0};
+  for (const window_t &w : masked) {
+    r.bound = std::max(r.bound, w.end - w.start + ISR_ENTRY_US);
+  }
+  for (double a : arrive) {
+    // PCINT1 comes before the timer and UART vectors, so once whatever
+    // holds interrupts off at the edge is done, the handler runs next
+    auto w = std::upper_bound(masked.begin(), masked.end(), a,
+                              [](double t, const window_t &x) { return t < x.start; });
+    double start = a;
+    for (; w != masked.begin() && (w - 1)->start > a - 10; --w) {
+      start = std::max(start, (w - 1)->end);
+    }
+    double latency = start - a + ISR_ENTRY_US;
+    r.worst = std::max(r.worst, latency);
+    r.total += latency;
+    r.seen++;
+  }
+  return r;
+}
+
+int main() {
+  std::vector<double> arrive;
+  std::vector<double> dwell;
+  for (int i = 0; i < CROSSINGS; i++) {
+    arrive.push_back(uniform(60e6, HORIZON_US - 60e6));
+    dwell.push_back(uniform(20000, 125000));
+  }
+  std::sort(arrive.begin(), arrive.end());
+
+  result_t loop = polled("loop()", loop_samples(), arrive, dwell);
+  result_t poll = polled("1 kHz", sched_samples(), arrive, dwell);
+  result_t isr = interrupt(masked_windows(), arrive);
+  report(loop);
+  report(poll);
+  report(isr);
+
+  CHECK(loop.missed > CROSSINGS / 2);     // the reason for all this
+  CHECK(loop.bound > 1000000);
+  CHECK(poll.missed == 0 && poll.bound < 1000 + 1500 + 400);
+  CHECK(isr.missed == 0 && isr.bound < 20);
+  CHECK(isr.bound * 50 < poll.bound);
+  return check_done("ir_latency_test");
+}
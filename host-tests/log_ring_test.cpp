@@ -0,0 +1,262 @@
+// Host tests for esp32cam-robot-04/log_ring.h.
+//
+// One thread first: messages come out in order and cut to the slot length,
+// a full ring drops (and counts) new messages without touching the queued
+// ones, and the ring keeps working across many wraps. Then four producer
+// threads push into a ring drained by a fifth: retrying on a full ring no
+// message may be lost, reordered within its producer or mixed with another,
+// and without retrying every message must be either popped whole or
+// counted as dropped. LogLimit is checked the same way, one thread and
+// several racing through the same periods.
+//
+// Last the cost of a log call on the sending task is measured: formatting
+// into the ring with the drain keeping up, the same format alone, a call
+// into a full ring, and a call LogLimit holds back, against how long the
+// line takes on the UART at 115200 baud, which Serial.printf waited out
+// whenever its buffer was full.
+//
+// Build (C++11, threads):
+//   g++ -O2 -pthread -o log_ring_test log_ring_test.cpp
+
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+#include "../esp32cam-robot-04/log_ring.h"
+
+#define SLOTS       32      // as app_log.cpp
+#define LEN         96
+#define PRODUCERS   4
+#define PER_THREAD  100000
+
+typedef LogRing<SLOTS, LEN> Ring;
+
+static bool put(Ring &ring, const log_meta_t &meta, const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  bool ok = ring.push(meta, fmt, args);
+  va_end(args);
+  return ok;
+}
+
+static void test_order_and_full() {
+  Ring ring;
+  log_meta_t meta;
+  char text[LEN];
+  CHECK(!ring.pop(&meta, text));
+
+  for (int i = 0; i < SLOTS; i++) {
+    CHECK(put(ring, {(uint32_t)i, 0, LOG_INFO}, "msg %d", i));
+  }
+  // Full: the new ones are dropped, the queued ones stay as they were
+  for (int i = 0; i < 5; i++) {
+    CHECK(!put(ring, {99, 0, LOG_ERROR}, "late %d", i));
+  }
+  CHECK(ring.take_dropped() == 5 && ring.take_dropped() == 0);
+  bool ok = true;
+  for (int i = 0; i < SLOTS; i++) {
+    char want[16];
+    snprintf(want, sizeof(want), "msg %d", i);
+    ok &= ring.pop(&meta, text) && meta.ms == (uint32_t)i && !strcmp(text, want);
+  }
+  CHECK(ok && !ring.pop(&meta, text));
+
+  // Long messages are cut, still terminated
+  char longer[2 * LEN];
+  memset(longer, 'x', sizeof(longer) - 1);
+  longer[sizeof(longer) - 1] = 0;
+  CHECK(put(ring, {0, 7, LOG_WARN}, "%s", longer));
+  CHECK(ring.pop(&meta, text) && strlen(text) == LEN - 1 && meta.skipped == 7 && meta.level == LOG_WARN);
+
+  // Many times round, never more than a few queued
+  ok = true;
+  for (uint32_t i = 0; i < 100 * SLOTS; i++) {
+    ok &= put(ring, {i, 0, LOG_DEBUG}, "%u", i);
+    if (i % 3 == 2) {
+      for (int k = 0; k < 3; k++) {
+        ok &= ring.pop(&meta, text) && meta.ms == (uint32_t)atoi(text);
+      }
+    }
+  }
+  CHECK(ok && ring.take_dropped() == 0);
+}
+
+// Each message carries its producer and number twice, in the meta and in
+// a text long enough to span the slot, so a torn or mixed slot shows
+typedef struct {
+  uint32_t popped;
+  uint32_t bad;
+  uint32_t out_of_order;
+} drained_t;
+
+static bool intact(const log_meta_t &meta, const char *text, int *producer, uint32_t *n) {
+  char tail[LEN];
+  if (sscanf(text, "p%d n%u %s", producer, n, tail) != 3 || *producer < 0 || *producer >= PRODUCERS) {
+    return false;
+  }
+  for (const char *c = tail; *c; c++) {
+    if (*c != (char)('a' + (*n + *producer) % 26)) {
+      return false;
+    }
+  }
+  return strlen(tail) > 60 && meta.ms == *n && meta.level == *producer;
+}
+
+static drained_t run_producers(Ring &ring, bool retry) {
+  std::atomic<int> running(PRODUCERS);
+  drained_t d = {0, 0, 0};
+  std::thread drain([&] {
+    uint32_t last[PRODUCERS] = {0};
+    log_meta_t meta;
+    char text[LEN];
+    while (true) {
+      bool done = running.load() == 0;
+      bool any = false;
+      while (ring.pop(&meta, text)) {
+        int p;
+        uint32_t n;
+        any = true;
+        d.popped++;
+        if (!intact(meta, text, &p, &n)) {
+          d.bad++;
+        } else {
+          d.out_of_order += n <= last[p];
+          last[p] = n;
+        }
+      }
+      if (done && !any) {
+        break;
+      }
+      std::this_thread::yield();
+    }
+  });
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < PRODUCERS; p++) {
+    producers.emplace_back([&ring, &running, p, retry] {
+      char fill[72];
+      for (uint32_t n = 1; n <= PER_THREAD; n++) {
+        memset(fill, 'a' + (n + p) % 26, sizeof(fill) - 1);
+        fill[sizeof(fill) - 1] = 0;
+        log_meta_t meta = {n, 0, (uint8_t)p};
+        while (!put(ring, meta, "p%d n%u %s", p, n, fill) && retry) {
+          std::this_thread::yield();
+        }
+        if (n % 64 == 0) {
+          std::this_thread::yield();    // lets the others in on one core too
+        }
+      }
+      running--;
+    });
+  }
+  for (auto &t : producers) {
+    t.join();
+  }
+  drain.join();
+  return d;
+}
+
+static void test_producers() {
+  static Ring ring;
+  drained_t d = run_producers(ring, true);
+  uint32_t retries = ring.take_dropped();
+  printf("%d producers, retrying: popped %u of %u, %u full ring retries\n",
+         PRODUCERS, d.popped, PRODUCERS * PER_THREAD, retries);
+  CHECK(d.popped == PRODUCERS * PER_THREAD && d.bad == 0 && d.out_of_order == 0);
+
+  d = run_producers(ring, false);
+  uint32_t dropped = ring.take_dropped();
+  printf("%d producers, dropping: popped %u, dropped %u\n", PRODUCERS, d.popped, dropped);
+  CHECK(d.popped + dropped == PRODUCERS * PER_THREAD && d.bad == 0 && d.out_of_order == 0);
+}
+
+static void test_limit() {
+  LogLimit limit;
+  uint16_t skipped = 0xffff;
+  int passed = 0;
+  for (uint32_t ms = 1000; ms < 6000; ms++) {
+    passed += limit.allow(ms, 1000, &skipped);
+  }
+  CHECK(passed == 5 && skipped == 999);
+
+  // Many more held back than fit in the meta saturate
+  LogLimit burst;
+  CHECK(burst.allow(0, 10, &skipped) && skipped == 0);
+  for (int i = 0; i < 70000; i++) {
+    burst.allow(5, 10, &skipped);
+  }
+  CHECK(burst.allow(10, 10, &skipped) && skipped == 0xffff);
+
+  // Threads racing through the same periods: one call a period gets through
+  LogLimit shared;
+  std::atomic<int> through(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < PRODUCERS; t++) {
+    threads.emplace_back([&] {
+      uint16_t s;
+      for (uint32_t ms = 0; ms < 100000; ms++) {
+        through += shared.allow(ms / 1000 * 1000, 1000, &s);
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  CHECK(through == 100);
+}
+
+static void bench() {
+  const int calls = 1000000;
+  static Ring ring;
+  log_meta_t meta = {0, 0, LOG_DEBUG};
+  char text[LEN];
+
+  int64_t t0 = now_us();
+  for (int i = 0; i < calls; i++) {
+    put(ring, meta, "MJPG[%d]: %uB %ums (%.1ffps)", 54, 12000u + i % 999, 40u, 25.0);
+    if (i % 8 == 7) {
+      while (ring.pop(&meta, text)) {
+      }
+    }
+  }
+  int64_t t1 = now_us();
+  for (int i = 0; i < calls; i++) {
+    snprintf(text, LEN, "MJPG[%d]: %uB %ums (%.1ffps)", 54, 12000u + i % 999, 40u, 25.0);
+    asm volatile("" : : "r"(text) : "memory");
+  }
+  int64_t t2 = now_us();
+  while (put(ring, meta, "fill")) {
+  }
+  ring.take_dropped();
+  int64_t t3 = now_us();
+  for (int i = 0; i < calls; i++) {
+    put(ring, meta, "MJPG[%d]: %uB %ums (%.1ffps)", 54, 12000u, 40u, 25.0);
+  }
+  int64_t t4 = now_us();
+  LogLimit limit;
+  uint16_t skipped;
+  int passed = 0;
+  for (int i = 0; i < calls; i++) {
+    passed += limit.allow(1000 + i / 10000, 1000, &skipped);
+  }
+  int64_t t5 = now_us();
+  CHECK(ring.take_dropped() == (uint32_t)calls && passed == 1);
+
+  // The line as the old Serial.printf wrote it, 10 bits a byte
+  int line = snprintf(text, LEN, "MJPG: %uB %ums (%.1ffps)\n", 12000u, 40u, 25.0);
+  double uart_ns = line * 10 / 115200.0 * 1e9;
+  double push_ns = (t1 - t0) * 1000.0 / calls;
+  printf("per call: into the ring %.0f ns (format alone %.0f ns), full ring %.1f ns, "
+         "held back %.1f ns; UART at 115200 %.0f ns\n",
+         push_ns, (t2 - t1) * 1000.0 / calls, (t4 - t3) * 1000.0 / calls, (t5 - t4) * 1000.0 / calls, uart_ns);
+  CHECK(push_ns * 100 < uart_ns);
+}
+
+int main() {
+  test_order_and_full();
+  test_producers();
+  test_limit();
+  bench();
+  return check_done("log_ring_test");
+}
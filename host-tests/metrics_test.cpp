@@ -0,0 +1,164 @@
+// Host tests for esp32cam-robot-04/metrics.h.
+//
+// Every bucket edge is checked: 0 alone in bucket 0, 2^(b-1) and 2^b - 1
+// both in bucket b, and everything from 2^(HIST_BUCKETS - 2) up, UINT32_MAX
+// included, in the last one. add_us() has to count negative times as 0 and
+// clamp ones past 32 bits. The /metrics line is parsed back to check the
+// buckets, count and sum, and a short buffer has to get a cut, terminated
+// line while the full length is still returned. Last four threads add at
+// once and nothing may be lost.
+//
+// Build (C++11, threads):
+//   g++ -O2 -pthread -o metrics_test metrics_test.cpp
+
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+#include "../esp32cam-robot-04/metrics.h"
+
+typedef struct {
+  uint32_t count;
+  uint32_t sum;
+  uint32_t buckets[HIST_BUCKETS];
+} hist_line_t;
+
+// Reads a hist line back the way a scraper would; false if it is malformed
+static bool parse(const char *line, const char *name, hist_line_t *h) {
+  char prefix[64];
+  int n = snprintf(prefix, sizeof(prefix), "hist %s ", name);
+  if (strncmp(line, prefix, n)) {
+    return false;
+  }
+  char *p = (char *)line + n;
+  h->count = strtoul(p, &p, 10);
+  h->sum = strtoul(p, &p, 10);
+  for (int i = 0; i < HIST_BUCKETS; i++) {
+    if (*p != ' ') {
+      return false;
+    }
+    h->buckets[i] = strtoul(p, &p, 10);
+  }
+  return !strcmp(p, "\n");
+}
+
+static void test_buckets() {
+  CHECK(Histogram::bucket(0) == 0);
+  bool edges = true;
+  for (int b = 1; b < HIST_BUCKETS - 1; b++) {
+    edges &= Histogram::bucket(1u << (b - 1)) == b && Histogram::bucket((1u << b) - 1) == b;
+  }
+  CHECK(edges);
+  // The last bucket starts a power of two past the others and takes the rest
+  uint32_t last = 1u << (HIST_BUCKETS - 2);
+  CHECK(Histogram::bucket(last - 1) == HIST_BUCKETS - 2);
+  CHECK(Histogram::bucket(last) == HIST_BUCKETS - 1);
+  CHECK(Histogram::bucket(1u << 31) == HIST_BUCKETS - 1 && Histogram::bucket(UINT32_MAX) == HIST_BUCKETS - 1);
+  CHECK(last > 250000);     // microseconds: the last bucket starts past 250 ms
+
+  // Each value lands in its bucket and nowhere else
+  Histogram h;
+  const uint32_t values[] = {0, 1, 2, 3, 4, 1000, 1023, 1024, 40000, last - 1, last, 5000000};
+  uint32_t sum = 0;
+  for (uint32_t v : values) {
+    h.add(v);
+    sum += v;
+  }
+  char buf[512];
+  hist_line_t line;
+  CHECK(h.format(buf, sizeof(buf), "send_us") == (int)strlen(buf));
+  CHECK(parse(buf, "send_us", &line));
+  uint32_t want[HIST_BUCKETS] = {0};
+  for (uint32_t v : values) {
+    want[Histogram::bucket(v)]++;
+  }
+  CHECK(line.count == sizeof(values) / sizeof(values[0]) && line.sum == sum);
+  CHECK(!memcmp(line.buckets, want, sizeof(want)));
+  CHECK(line.buckets[0] == 1 && line.buckets[2] == 2 && line.buckets[11] == 1 && line.buckets[HIST_BUCKETS - 1] == 2);
+}
+
+static void test_add_us() {
+  Histogram h;
+  h.add_us(-5);
+  h.add_us(0);
+  h.add_us(INT64_MIN);
+  h.add_us(1LL << 33);
+  h.add_us(UINT32_MAX);
+  char buf[512];
+  hist_line_t line;
+  h.format(buf, sizeof(buf), "stop_late_us");
+  CHECK(parse(buf, "stop_late_us", &line));
+  CHECK(line.count == 5 && line.buckets[0] == 3 && line.buckets[HIST_BUCKETS - 1] == 2);
+  CHECK(line.sum == (uint32_t)(2ULL * UINT32_MAX));    // wraps, a scraper takes differences
+}
+
+static void test_format() {
+  Counter c;
+  c.add();
+  c.add(41);
+  char buf[64];
+  CHECK(c.format(buf, sizeof(buf), "frames_sent") == 23 && !strcmp(buf, "counter frames_sent 42\n"));
+
+  Histogram h;
+  for (uint32_t v = 1; v < 1000000; v *= 3) {
+    h.add(v);
+  }
+  char full[512];
+  int len = h.format(full, sizeof(full), "capture_us");
+  CHECK(len == (int)strlen(full) && full[len - 1] == '\n');
+
+  // Every size short of the line: cut, terminated, same start, full length returned
+  bool cut = true;
+  for (int size = 1; size <= len; size++) {
+    char small[512];
+    memset(small, '#', sizeof(small));
+    cut &= h.format(small, size, "capture_us") == len;
+    cut &= (int)strlen(small) == size - 1 && !strncmp(small, full, size - 1);
+    cut &= small[size] == '#';
+  }
+  CHECK(cut);
+}
+
+static void test_threads() {
+  static robot_metrics_t m;
+  const int threads = 4;
+  const int per_thread = 200000;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([t] {
+      for (int i = 0; i < per_thread; i++) {
+        m.send_us.add_us(i % 5000 + t);
+        m.frames_sent.add();
+      }
+    });
+  }
+  for (auto &w : workers) {
+    w.join();
+  }
+  uint32_t sum = 0;
+  for (int t = 0; t < threads; t++) {
+    for (int i = 0; i < per_thread; i++) {
+      sum += i % 5000 + t;
+    }
+  }
+  char buf[512];
+  hist_line_t line;
+  m.send_us.format(buf, sizeof(buf), "send_us");
+  CHECK(parse(buf, "send_us", &line));
+  uint32_t in_buckets = 0;
+  for (int i = 0; i < HIST_BUCKETS; i++) {
+    in_buckets += line.buckets[i];
+  }
+  CHECK(line.count == threads * per_thread && in_buckets == line.count && line.sum == sum);
+  CHECK(m.frames_sent.get() == threads * per_thread);
+}
+
+int main() {
+  test_buckets();
+  test_add_us();
+  test_format();
+  test_threads();
+  return check_done("metrics_test");
+}
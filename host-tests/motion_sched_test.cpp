@@ -0,0 +1,218 @@
+// Host tests for esp32cam-robot-04/motion_sched.h against a simulated clock.
+//
+// Sim plays the part of app_httpd.cpp: motion_run() drives the scheduler
+// the same way and a one-shot timer is a time to wake up at, optionally
+// late by a fixed latency, the way esp_timer and the motor task are.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o motion_sched_test motion_sched_test.cpp
+
+#include <vector>
+
+#include "check.h"
+#include "../esp32cam-robot-04/motion_sched.h"
+
+#define OP_FWD    1
+#define OP_LEFT   2
+#define OP_STOP   3
+#define OP_RIGHT  4
+#define MOTORS_OFF  0xff    // the queue ran dry and motion_run() stopped
+
+typedef struct {
+  int64_t at;
+  uint8_t op;
+} event_t;
+
+enum sim_mode_t {REPLACE, APPEND, FLUSH};
+
+class Sim {
+  public:
+    Sim() : now(0), latency(0), timer_at(-1) {}
+
+    // motion_submit()
+    int submit(std::vector<motion_step_t> steps, sim_mode_t mode) {
+      if (mode == REPLACE) {
+        timer_at = -1;
+        m.clear();
+      } else if (mode == FLUSH) {
+        m.flush();
+      }
+      int accepted = 0;
+      for (; accepted < (int)steps.size() && m.push(steps[accepted]); accepted++) {
+      }
+      if (!m.active()) {
+        run();
+      }
+      return accepted;
+    }
+
+    // Moves the clock to t, firing the timer on the way
+    void advance(int64_t t) {
+      while (timer_at >= 0 && timer_at + latency <= t) {
+        now = timer_at + latency;
+        timer_at = -1;
+        run();
+      }
+      now = t;
+    }
+
+    int64_t ms(int64_t v) const {
+      return v * 1000;
+    }
+
+    MotionScheduler m;
+    std::vector<event_t> log;
+    int64_t now;
+    int64_t latency;
+    int64_t timer_at;
+
+  private:
+    // motion_run()
+    void run() {
+      motion_step_t step;
+      int64_t delay;
+      while (true) {
+        switch (m.poll(now, &step, &delay)) {
+          case MOTION_RUN:
+            log.push_back({now, step.op});
+            if (!delay) {
+              continue;
+            }
+            // fall through
+          case MOTION_WAIT:
+            timer_at = now + delay;
+            return;
+          case MOTION_STOP:
+            log.push_back({now, MOTORS_OFF});
+            timer_at = -1;
+            return;
+          default:
+            return;
+        }
+      }
+    }
+};
+
+static bool is(const event_t &e, int64_t at, uint8_t op) {
+  return e.at == at && e.op == op;
+}
+
+// One move stops exactly at its deadline, not before
+static void test_deadline() {
+  Sim s;
+  s.submit({{OP_FWD, 0, 250}}, REPLACE);
+  CHECK(s.log.size() == 1 && is(s.log[0], 0, OP_FWD));
+  CHECK(s.m.deadline() == s.ms(250));
+  s.advance(s.ms(250) - 1);
+  CHECK(s.log.size() == 1);
+  s.advance(s.ms(250));
+  CHECK(s.log.size() == 2 && is(s.log[1], s.ms(250), MOTORS_OFF));
+  CHECK(!s.m.active());
+}
+
+// A new command cancels the old deadline and arms its own
+static void test_rearm() {
+  Sim s;
+  s.submit({{OP_FWD, 0, 250}}, REPLACE);
+  s.advance(s.ms(100));
+  s.submit({{OP_LEFT, 0, 200}}, REPLACE);
+  CHECK(s.timer_at == s.ms(300));
+  s.advance(s.ms(299));
+  CHECK(s.log.size() == 2 && is(s.log[1], s.ms(100), OP_LEFT));
+  s.advance(s.ms(1000));
+  CHECK(s.log.size() == 3 && is(s.log[2], s.ms(300), MOTORS_OFF));
+}
+
+// A late timer stops late by its latency only; a wake-up before the
+// deadline just re-arms for what is left
+static void test_latency_and_early_wake() {
+  Sim s;
+  s.latency = 3000;
+  s.submit({{OP_FWD, 0, 250}}, REPLACE);
+  s.advance(s.ms(1000));
+  CHECK(s.log.size() == 2 && is(s.log[1], s.ms(253), MOTORS_OFF));
+
+  MotionScheduler m;
+  motion_step_t step;
+  int64_t delay;
+  CHECK(m.poll(0, &step, &delay) == MOTION_IDLE);
+  m.push({OP_FWD, 0, 250});
+  CHECK(m.poll(0, &step, &delay) == MOTION_RUN && delay == 250000);
+  CHECK(m.poll(100000, &step, &delay) == MOTION_WAIT && delay == 150000);
+  CHECK(m.poll(250000, &step, &delay) == MOTION_STOP);
+  CHECK(m.poll(260000, &step, &delay) == MOTION_IDLE);
+}
+
+// A batch plays back to back: every step starts at the deadline of the one
+// before, so timer latency delays each start but never adds up
+static void test_batch_no_gaps() {
+  for (int64_t latency : {0, 5000}) {
+    Sim s;
+    s.latency = latency;
+    CHECK(s.submit({{OP_FWD, 0, 400}, {OP_RIGHT, 0, 150}, {OP_FWD, 0, 300}}, REPLACE) == 3);
+    s.advance(s.ms(2000));
+    CHECK(s.log.size() == 4);
+    CHECK(is(s.log[0], 0, OP_FWD));
+    CHECK(is(s.log[1], s.ms(400) + latency, OP_RIGHT));
+    CHECK(is(s.log[2], s.ms(550) + latency, OP_FWD));
+    CHECK(is(s.log[3], s.ms(850) + latency, MOTORS_OFF));
+  }
+}
+
+// Appending while a step runs queues behind it; flushing lets the running
+// step finish and drops the rest
+static void test_append_and_flush() {
+  Sim s;
+  s.submit({{OP_FWD, 0, 200}}, REPLACE);
+  s.advance(s.ms(50));
+  s.submit({{OP_LEFT, 0, 100}}, APPEND);
+  s.advance(s.ms(1000));
+  CHECK(s.log.size() == 3 && is(s.log[1], s.ms(200), OP_LEFT) && is(s.log[2], s.ms(300), MOTORS_OFF));
+
+  Sim f;
+  f.submit({{OP_FWD, 0, 200}, {OP_LEFT, 0, 100}, {OP_FWD, 0, 100}}, REPLACE);
+  f.advance(s.ms(50));
+  f.submit({}, FLUSH);
+  CHECK(f.m.pending() == 0 && f.m.active());
+  f.advance(s.ms(1000));
+  CHECK(f.log.size() == 2 && is(f.log[1], s.ms(200), MOTORS_OFF));
+}
+
+// Stop sent with replace drops the running step and the queue at once
+static void test_stop_preempts() {
+  Sim s;
+  s.submit({{OP_FWD, 0, 400}, {OP_RIGHT, 0, 150}, {OP_FWD, 0, 300}}, REPLACE);
+  s.advance(s.ms(100));
+  s.submit({{OP_STOP, 0, 0}}, REPLACE);
+  CHECK(s.log.size() == 3);
+  CHECK(is(s.log[1], s.ms(100), OP_STOP) && is(s.log[2], s.ms(100), MOTORS_OFF));
+  CHECK(!s.m.active() && s.m.pending() == 0 && s.timer_at < 0);
+  s.advance(s.ms(2000));
+  CHECK(s.log.size() == 3);
+}
+
+// The queue is bounded; zero length steps run in the same instant
+static void test_full_and_zero_length() {
+  Sim s;
+  std::vector<motion_step_t> many(MOTION_QUEUE_LEN + 4, motion_step_t{OP_FWD, 0, 10});
+  CHECK(s.submit(many, APPEND) == MOTION_QUEUE_LEN);
+  CHECK(s.log.size() == 1 && s.m.pending() == MOTION_QUEUE_LEN - 1);
+  s.advance(s.ms(1000));
+  CHECK(s.log.size() == MOTION_QUEUE_LEN + 1 && is(s.log.back(), s.ms(10 * MOTION_QUEUE_LEN), MOTORS_OFF));
+
+  Sim z;
+  z.submit({{OP_FWD, 200, 0}, {OP_LEFT, 0, 0}, {OP_FWD, 0, 100}}, REPLACE);
+  CHECK(z.log.size() == 3 && is(z.log[1], 0, OP_LEFT) && is(z.log[2], 0, OP_FWD));
+  CHECK(z.timer_at == z.ms(100));
+}
+
+int main() {
+  test_deadline();
+  test_rearm();
+  test_latency_and_early_wake();
+  test_batch_no_gaps();
+  test_append_and_flush();
+  test_stop_preempts();
+  test_full_and_zero_length();
+  return check_done("motion_sched_test");
+}
@@ -0,0 +1,149 @@
+// Host tests for arduino-control-04/motor_pi.h.
+//
+// Each wheel is a first order DC motor: a dead band up to MOTOR_FF_START,
+// then speed proportional to PWM with a 120 ms time constant, a gain that
+// can be 30% off what the feed-forward assumes, and a load that takes
+// ticks/s off. The encoder counts whole ticks. A 10 s run sets off to
+// cruise, speeds up, reverses and stops; the mean tracking error and the
+// overshoot are printed open and closed loop for every gain and load, and
+// closed loop has to track within a few ticks/s.
+//
+// Then the ramps as motor_control.ino's drive() chooses them, with the
+// command sent again every 1 ms the way sensor_ir() does: setting off has to
+// keep MOTOR_ACCEL_TPS2 all the way to cruise, a turn while moving has to
+// reverse the wheel within a step, and the wheel whose target did not
+// change keeps the ramp it had.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o motor_pi_test motor_pi_test.cpp
+
+#include <math.h>
+#include <stdlib.h>
+
+#define MOTOR_ENCODERS 1
+#include "check.h"
+#include "../arduino-control-04/motor_pi.h"
+
+#define STEP_S   (MOTOR_PERIOD_US / 1e6)
+
+typedef struct {
+  double kv;          // ticks/s per PWM above the dead band
+  double load;        // ticks/s lost to load
+  double w;           // ticks/s, signed
+  double pos;         // ticks counted, both directions
+} plant_t;
+
+static void plant_step(plant_t *p, int pwm, double dt) {
+  double drive = abs(pwm) > MOTOR_FF_START ? (abs(pwm) - MOTOR_FF_START) * p->kv * (pwm > 0 ? 1 : -1) : 0;
+  double load = p->w > 0 ? p->load : p->w < 0 ? -p->load : 0;
+  p->w += (drive - load - p->w) * dt / 0.12;
+  p->pos += fabs(p->w) * dt;
+}
+
+typedef struct {
+  double err;         // mean |speed - setpoint| once the ramp is done
+  double over;        // ticks/s above cruise while at cruise
+} run_t;
+
+static run_t run(bool closed, double kv, double load) {
+  plant_t p = {kv, load, 0, 0};
+  MotorPI m;
+  long counted = 0;
+  double err = 0;
+  int n = 0;
+  run_t r = {0, 0};
+  for (int k = 0; k < 200; k++) {
+    double t = k * STEP_S;
+    m.target(t < 4 ? MOTOR_CRUISE_TPS : t < 7 ? 120 : t < 8 ? -MOTOR_CRUISE_TPS : 0);
+    long ticks = (long)p.pos - counted;
+    counted += ticks;
+    int pwm = m.step(ticks, MOTOR_PERIOD_US);
+    if (!closed) {      // the feed-forward alone, as built without encoders
+      int sp = abs(m.setpoint());
+      pwm = sp ? (MOTOR_FF_START + ((sp * MOTOR_FF_Q8) >> 8)) * (m.setpoint() < 0 ? -1 : 1) : 0;
+    }
+    for (int i = 0; i < 50; i++) {
+      plant_step(&p, pwm, STEP_S / 50);
+    }
+    if ((t > 1.5 && t < 4) || (t > 5 && t < 7)) {
+      err += fabs(p.w - m.setpoint());
+      n++;
+    }
+    if (t < 4 && p.w - MOTOR_CRUISE_TPS > r.over) {
+      r.over = p.w - MOTOR_CRUISE_TPS;
+    }
+  }
+  r.err = err / n;
+  return r;
+}
+
+static void test_tracking() {
+  const double gains[] = {0.93, 0.7, 1.2};
+  const double loads[] = {0, 20};
+  for (double kv : gains) {
+    for (double load : loads) {
+      run_t open = run(false, kv, load);
+      run_t closed = run(true, kv, load);
+      printf("gain %.2f load %2.0f: |error| open %5.1f closed %4.1f ticks/s, overshoot open %4.1f closed %4.1f\n",
+             kv, load, open.err, closed.err, open.over, closed.over);
+      CHECK(closed.err < 5 && closed.over < 35);
+      CHECK(load == 0 || closed.err < open.err / 3);
+    }
+  }
+}
+
+// As motor_control.ino
+static MotorPI motorA, motorB;
+
+static void drive_wheel(MotorPI &m, int16_t tps, bool moving) {
+  if (tps != m.target()) {
+    m.target(tps, moving ? MOTOR_STEER_TPS2 : MOTOR_ACCEL_TPS2);
+  }
+}
+
+static void drive(int16_t tpsA, int16_t tpsB) {
+  bool moving = motorA.setpoint() || motorB.setpoint();
+  drive_wheel(motorA, tpsA, moving);
+  drive_wheel(motorB, tpsB, moving);
+}
+
+// One motor period with the command sent every millisecond
+static void period(int16_t tpsA, int16_t tpsB) {
+  for (unsigned ms = 0; ms < MOTOR_PERIOD_US / 1000; ms++) {
+    drive(tpsA, tpsB);
+  }
+  motorA.step(0, MOTOR_PERIOD_US);
+  motorB.step(0, MOTOR_PERIOD_US);
+}
+
+static void test_ramps() {
+  const int per_step = MOTOR_ACCEL_TPS2 * MOTOR_PERIOD_US / 1000000;
+  int steps = 0;
+  bool ramped = true;
+  while (motorA.setpoint() < MOTOR_CRUISE_TPS && steps < 100) {
+    period(MOTOR_CRUISE_TPS, MOTOR_CRUISE_TPS);
+    steps++;
+    ramped &= motorA.setpoint() <= steps * per_step;
+  }
+  CHECK(ramped && steps == (MOTOR_CRUISE_TPS + per_step - 1) / per_step);
+
+  // Turning: the right wheel reverses within a step, the left one holds
+  period(MOTOR_CRUISE_TPS, -MOTOR_CRUISE_TPS);
+  CHECK(motorB.setpoint() == -MOTOR_CRUISE_TPS && motorA.setpoint() == MOTOR_CRUISE_TPS);
+  period(MOTOR_CRUISE_TPS, MOTOR_CRUISE_TPS);
+  CHECK(motorB.setpoint() == MOTOR_CRUISE_TPS);
+
+  // A turn while still setting off: the wheel that keeps its target keeps
+  // the gentle ramp
+  motorA.stop();
+  motorB.stop();
+  period(MOTOR_CRUISE_TPS, MOTOR_CRUISE_TPS);
+  period(MOTOR_CRUISE_TPS, -MOTOR_CRUISE_TPS);
+  CHECK(motorA.setpoint() == 2 * per_step && motorB.setpoint() == -MOTOR_CRUISE_TPS);
+}
+
+int main() {
+  test_tracking();
+  test_ramps();
+  return check_done("motor_pi_test");
+}
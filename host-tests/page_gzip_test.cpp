@@ -0,0 +1,76 @@
+// Host tests for esp32cam-robot-04/html_control_gz.h, the gzipped control
+// page page-gzip/page_gzip.cpp builds from html_control.ino.
+//
+// The blob has to inflate back to exactly the page in html_control.ino and
+// its ETag has to be the page's hash, so a page edited without running
+// page_gzip again fails here. Then what a page load puts on the air is
+// compared: the page as it was sent before, gzipped, and the 304 a reload
+// gets, in body bytes and TCP segments.
+//
+// Build (C++11 and zlib):
+//   g++ -O2 -o page_gzip_test page_gzip_test.cpp -lz
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <zlib.h>
+
+#include "check.h"
+
+#define PROGMEM
+#include "../esp32cam-robot-04/html_control.ino"
+#include "../esp32cam-robot-04/html_control_gz.h"
+
+#define MSS   1436      // lwIP TCP_MSS on the ESP32
+
+static bool gunzip(const uint8_t *in, size_t len, std::vector<uint8_t> *out) {
+  z_stream z;
+  memset(&z, 0, sizeof(z));
+  if (inflateInit2(&z, 15 + 16) != Z_OK) {
+    return false;
+  }
+  out->resize(64 * 1024);
+  z.next_in = (Bytef *)in;
+  z.avail_in = len;
+  z.next_out = out->data();
+  z.avail_out = out->size();
+  int r = inflate(&z, Z_FINISH);
+  out->resize(z.total_out);
+  bool whole = r == Z_STREAM_END && z.avail_in == 0;
+  inflateEnd(&z);
+  return whole;
+}
+
+static void test_round_trip() {
+  size_t len = sizeof(INDEX_HTML) - 1;
+  std::vector<uint8_t> page;
+  CHECK(sizeof(INDEX_HTML_GZ) == INDEX_HTML_GZ_LEN);
+  CHECK(gunzip(INDEX_HTML_GZ, INDEX_HTML_GZ_LEN, &page));
+  CHECK(page.size() == len && !memcmp(page.data(), INDEX_HTML, len));
+
+  // Magic, deflate, no flags (no name), mtime 0: the same page gives the same bytes
+  CHECK(INDEX_HTML_GZ[0] == 0x1f && INDEX_HTML_GZ[1] == 0x8b && INDEX_HTML_GZ[2] == 8 && INDEX_HTML_GZ[3] == 0);
+  CHECK(!memcmp(INDEX_HTML_GZ + 4, "\0\0\0\0", 4));
+
+  uint64_t h = 14695981039346656037ull;
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ (uint8_t)INDEX_HTML[i]) * 1099511628211ull;
+  }
+  char etag[24];
+  snprintf(etag, sizeof(etag), "\"%016llx\"", (unsigned long long)h);
+  CHECK(!strcmp(etag, INDEX_HTML_ETAG));
+}
+
+static void test_on_air() {
+  size_t plain = sizeof(INDEX_HTML) - 1;
+  size_t gz = INDEX_HTML_GZ_LEN;
+  printf("page load: plain %zu B in %zu segments, gzip %zu B in %zu segments (%.0f%% saved), reload 304 with no body\n",
+         plain, (plain + MSS - 1) / MSS, gz, (gz + MSS - 1) / MSS, 100.0 * (plain - gz) / plain);
+  CHECK(gz * 3 < plain * 2);
+}
+
+int main() {
+  test_round_trip();
+  test_on_air();
+  return check_done("page_gzip_test");
+}
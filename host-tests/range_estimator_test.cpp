@@ -0,0 +1,167 @@
+// Host tests for libraries/RangeEstimator/RangeEstimator.h.
+//
+// The conversion is checked against the speed of sound, the median against
+// single bad echoes, and the gate against a real jump in distance, which
+// has to be believed after RANGE_REJECT_MAX rejections. Then a recorded
+// style run is replayed: the robot closes on a wall at 300 mm/s every 30 ms,
+// stops, and backs off, with 10 mm sensor noise, 5% missing echoes and 3%
+// echoes from something else. Raw and filtered distances are compared on
+// error, closing speed and how often a 20 cm stop threshold flips.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o range_estimator_test range_estimator_test.cpp
+
+#include <math.h>
+#include <stdlib.h>
+#include <random>
+
+#include "check.h"
+#include "../libraries/RangeEstimator/RangeEstimator.h"
+
+#define PERIOD_US   30000
+
+static std::mt19937 rng(1);
+
+static double uniform() {
+  return (rng() >> 8) / 16777216.0;
+}
+
+// Irwin-Hall approximation, the same on every standard library
+static double gaussian(double sigma) {
+  double s = 0;
+  for (int i = 0; i < 12; i++) {
+    s += uniform();
+  }
+  return (s - 6) * sigma;
+}
+
+// Round trip at 20 C for mm, what the sensor's echo pulse lasts
+static uint32_t echo_for(double mm) {
+  return (uint32_t)(2 * mm / 0.34342 + 0.5);
+}
+
+static void test_conversion() {
+  uint16_t s20 = range_speed(20);
+  CHECK(abs(s20 - 11253) <= 1);     // 343.4 m/s / 2, Q16
+  CHECK(range_speed(0) < s20 && range_speed(35) > s20);
+  CHECK(abs(range_echo_mm(5831, s20) - 1001) <= 1);
+  CHECK(range_echo_mm(0, s20) == RANGE_MAX_MM);
+  CHECK(range_echo_mm(RANGE_TIMEOUT_US, s20) == RANGE_MAX_MM);
+  CHECK(range_echo_mm(30000, s20) == RANGE_MAX_MM);    // 5 m, past the sensor's limit
+}
+
+// Steady wall at 800 mm: single bad echoes never reach the output
+static void test_median() {
+  RangeEstimator e;
+  CHECK(!e.valid());
+  uint32_t t = 0;
+  uint16_t worst = 0;
+  for (int i = 0; i < 100; i++) {
+    uint32_t echo = echo_for(800 + gaussian(RANGE_NOISE_MM));
+    if (i % 7 == 3) {
+      echo = 0;                         // no echo
+    } else if (i % 7 == 5) {
+      echo = echo_for(250);             // cross talk
+    }
+    e.update(echo, t += PERIOD_US);
+    if (i >= RANGE_MEDIAN) {
+      int err = abs(e.mm() - 800);
+      worst = err > worst ? err : worst;
+    }
+  }
+  CHECK(e.valid());
+  CHECK(worst <= 2 * RANGE_NOISE_MM);
+  CHECK(e.rejected() == 0);         // the median took them all
+  CHECK(abs(e.closing_mm_s()) < 100);
+}
+
+// Something steps in front of the sensor: the filter refuses it for a few
+// readings, then starts again from it
+static void test_gate() {
+  RangeEstimator e;
+  uint32_t t = 0;
+  for (int i = 0; i < 50; i++) {
+    e.update(echo_for(1500), t += PERIOD_US);
+  }
+  int readings = 0;
+  while (abs(e.mm() - 400) > RANGE_NOISE_MM && readings < 20) {
+    e.update(echo_for(400), t += PERIOD_US);
+    readings++;
+  }
+  // Half the median window to get through it, then the rejections
+  CHECK(readings == RANGE_MEDIAN / 2 + RANGE_REJECT_MAX);
+  CHECK(e.rejected() == RANGE_REJECT_MAX);
+  CHECK(e.raw_mm() == range_echo_mm(echo_for(400), range_speed(20)));
+
+  // A long gap counts as RANGE_DT_MAX_MS, not as a velocity blow up
+  e.update(echo_for(400), t += 60000000);
+  CHECK(abs(e.mm() - 400) <= RANGE_NOISE_MM && abs(e.closing_mm_s()) < 100);
+}
+
+static void test_replay() {
+  RangeEstimator e;
+  uint32_t t = 0xFFFFFFFFu - 10 * PERIOD_US;    // crosses the micros() wrap
+  double d = 1500;
+  double v = -300;
+  int flips_raw = 0;
+  int flips_filtered = 0;
+  bool near_raw = false;
+  bool near_filtered = false;
+  double err_raw = 0;
+  double err_filtered = 0;
+  double err_speed = 0;
+  int n = 0;
+  int moving = 0;
+
+  for (int i = 0; i < 1000; i++) {
+    t += PERIOD_US;
+    d += v * PERIOD_US / 1e6;
+    if (d < 150) {
+      d = 150;
+      v = 0;
+    }
+    if (i == 700) {
+      v = 200;
+    }
+    uint32_t echo = echo_for(d + gaussian(RANGE_NOISE_MM));
+    double r = uniform();
+    if (r < 0.05) {
+      echo = 0;
+    } else if (r < 0.08) {
+      echo = echo_for(150 + uniform() * 1500);
+    }
+    e.update(echo, t);
+
+    uint16_t raw = range_echo_mm(echo, range_speed(20));
+    bool nr = raw < 200;
+    bool nf = e.mm() < 200;
+    if (i > RANGE_MEDIAN) {
+      flips_raw += nr != near_raw;
+      flips_filtered += nf != near_filtered;
+      err_raw += fabs(raw - d);
+      err_filtered += fabs(e.mm() - d);
+      n++;
+      // closing speed, away from the moments the robot changes speed
+      if (i > 20 && (i < 140 || i > 200) && (i < 700 || i > 760)) {
+        err_speed += fabs(e.closing_mm_s() + v);
+        moving++;
+      }
+    }
+    near_raw = nr;
+    near_filtered = nf;
+  }
+  printf("replay: threshold flips raw %d filtered %d (2 true), mean error raw %.1f mm filtered %.1f mm, "
+         "speed error %.0f mm/s, %u rejected\n",
+         flips_raw, flips_filtered, err_raw / n, err_filtered / n, err_speed / moving, e.rejected());
+  CHECK(flips_filtered <= 4 && flips_raw > 10 * flips_filtered);
+  CHECK(err_filtered / n < RANGE_NOISE_MM * 1.5 && err_raw / n > 10 * err_filtered / n);
+  CHECK(err_speed / moving < 50);
+}
+
+int main() {
+  test_conversion();
+  test_median();
+  test_gate();
+  test_replay();
+  return check_done("range_estimator_test");
+}
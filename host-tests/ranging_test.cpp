@@ -0,0 +1,231 @@
+// Host tests for arduino-control-04/ranging.h against simulated sensors.
+//
+// Bench plays the two HC-SR04s and the sketch around Ranging: when poll()
+// asks for a trigger, the echo pin of that sensor goes high after the
+// sensor's burst delay and low again after the round trip, and each edge
+// reaches edge() from the "interrupt" a few microseconds late. The main
+// loop only gets to poll() every so often, like loop() between scheduler
+// tasks. micros() starts just short of the 32 bit wrap. Besides the checks,
+// the ping rate per sensor and the time from the falling edge to the
+// published distance are printed.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -I../libraries/RangeEstimator -o ranging_test ranging_test.cpp
+
+#include <algorithm>
+#include <stdlib.h>
+#include <vector>
+
+#include "check.h"
+#include "../arduino-control-04/ranging.h"
+
+#define BURST_US    450     // trigger to rising edge, the 40 kHz burst
+#define NO_ECHO_US  38000   // how long the pin stays high with nothing in range
+
+typedef struct {
+  uint32_t at;
+  uint8_t sensor;
+  bool level;
+} edge_t;
+
+static uint32_t lcg = 12345;
+
+static uint32_t random32() {
+  lcg = lcg * 1103515245u + 12345u;
+  return lcg >> 8;
+}
+
+class Bench {
+  public:
+    Bench() : now(0xFFFF0000u), loop_us(200), loop_jitter_us(0), isr_us(4), crosstalk(false) {
+      mm[RANGING_UP] = 500;
+      mm[RANGING_DOWN] = 1200;
+      for (int i = 0; i < RANGING_SENSORS; i++) {
+        pings[i] = 0;
+        unplugged[i] = false;
+        last_count[i] = 0;
+      }
+    }
+
+    // Round trip at 20 C, 0 for no echo
+    static uint32_t echo_us(uint32_t mm) {
+      return mm ? (uint32_t)(2.0 * mm / 0.34342 + 0.5) : 0;
+    }
+
+    // Runs the main loop for us microseconds
+    void run(uint32_t us) {
+      uint32_t end = now + us;
+      while ((int32_t)(end - now) > 0) {
+        uint32_t step = loop_us + (loop_jitter_us ? random32() % loop_jitter_us : 0);
+        deliver(now + step);
+        now += step;
+        int8_t s = r.poll(now);
+        if (s >= 0) {
+          trigger(s);
+        }
+        for (int i = 0; i < RANGING_SENSORS; i++) {
+          if (r.count(i) != last_count[i]) {
+            last_count[i] = r.count(i);
+            latency.push_back(now - fell[i]);
+          }
+        }
+      }
+    }
+
+    Ranging r;
+    uint32_t now;
+    uint32_t loop_us;
+    uint32_t loop_jitter_us;
+    uint32_t isr_us;
+    bool crosstalk;             // the other sensor hears every ping as well
+    uint32_t mm[RANGING_SENSORS];     // 0 for nothing in range
+    bool unplugged[RANGING_SENSORS];  // the echo pin never moves
+    int pings[RANGING_SENSORS];
+    std::vector<uint8_t> order;
+    std::vector<uint32_t> latency;
+
+  private:
+    void trigger(uint8_t s) {
+      pings[s]++;
+      order.push_back(s);
+      if (unplugged[s]) {
+        fell[s] = now;
+        return;
+      }
+      uint32_t rise = now + 10 + BURST_US;
+      uint32_t width = mm[s] ? echo_us(mm[s]) : NO_ECHO_US;
+      edges.push_back({rise, s, true});
+      edges.push_back({rise + width, s, false});
+      fell[s] = rise + width;
+      if (crosstalk) {
+        edges.push_back({rise + width / 2, (uint8_t)(s ^ 1), true});
+        edges.push_back({rise + width / 2 + 300, (uint8_t)(s ^ 1), false});
+      }
+    }
+
+    // Interrupts for every edge before t, in time order
+    void deliver(uint32_t t) {
+      std::stable_sort(edges.begin(), edges.end(), [this](const edge_t &a, const edge_t &b) {
+        return (int32_t)(a.at - now) < (int32_t)(b.at - now);
+      });
+      size_t i = 0;
+      for (; i < edges.size() && (int32_t)(edges[i].at - t) < 0; i++) {
+        r.edge(edges[i].sensor, edges[i].level, edges[i].at + isr_us);
+      }
+      edges.erase(edges.begin(), edges.begin() + i);
+    }
+
+    std::vector<edge_t> edges;
+    uint32_t fell[RANGING_SENSORS];
+    uint8_t last_count[RANGING_SENSORS];
+};
+
+static int cm_error(const Bench &b, uint8_t s) {
+  return abs((int)b.r.cm(s) - (int)(b.mm[s] + 5) / 10);
+}
+
+// Both sensors read their distance and take turns, across the micros() wrap
+static void test_distances_and_turns() {
+  Bench b;
+  b.run(1000000);
+  CHECK(cm_error(b, RANGING_UP) <= 1 && cm_error(b, RANGING_DOWN) <= 1);
+  CHECK(b.r.echo_us(RANGING_UP) >= Bench::echo_us(500) && b.r.echo_us(RANGING_UP) <= Bench::echo_us(500) + 8);
+  bool alternate = true;
+  for (size_t i = 1; i < b.order.size(); i++) {
+    alternate &= b.order[i] != b.order[i - 1];
+  }
+  CHECK(alternate && b.pings[RANGING_UP] > 10);
+  // Each ping costs its echo, a gap and up to a loop period either side
+  uint32_t cycle = 2 * (BURST_US + RANGING_GAP_US) + Bench::echo_us(500) + Bench::echo_us(1200);
+  CHECK(b.pings[RANGING_UP] >= (int)(1000000 / (cycle + 4 * b.loop_us)));
+  CHECK(b.pings[RANGING_UP] <= (int)(1000000 / cycle) + 1);
+  CHECK(*std::max_element(b.latency.begin(), b.latency.end()) <= b.loop_us);
+}
+
+// Nothing in range is the sensor's 38 ms pulse and reads as the far limit.
+// An echo that never ends, or ends after the timeout, is published as no
+// echo once the timeout is up, and the other sensor is not held up longer.
+static void test_no_echo() {
+  Bench b;
+  b.mm[RANGING_DOWN] = 0;
+  b.run(500000);
+  CHECK(b.r.cm(RANGING_DOWN) == RANGE_MAX_MM / 10 && b.r.echo_us(RANGING_DOWN) == NO_ECHO_US);
+  CHECK(cm_error(b, RANGING_UP) <= 1);
+
+  b.unplugged[RANGING_DOWN] = true;
+  int before = b.pings[RANGING_DOWN];
+  b.run(500000);
+  CHECK(b.r.cm(RANGING_DOWN) == RANGING_NO_ECHO && b.r.echo_us(RANGING_DOWN) == 0);
+  CHECK(cm_error(b, RANGING_UP) <= 1);
+  int cycle = RANGING_TIMEOUT_US + 2 * RANGING_GAP_US + BURST_US + Bench::echo_us(500) + 4 * b.loop_us;
+  CHECK(b.pings[RANGING_DOWN] - before >= 500000 / cycle);
+  CHECK(*std::max_element(b.latency.begin(), b.latency.end()) <= RANGING_TIMEOUT_US + b.loop_us);
+
+  b.unplugged[RANGING_DOWN] = false;
+  b.mm[RANGING_DOWN] = 7000;
+  b.run(200000);
+  CHECK(b.r.cm(RANGING_DOWN) == RANGING_NO_ECHO);
+}
+
+// Edges on the sensor not being pinged are ignored
+static void test_crosstalk() {
+  Bench b;
+  b.crosstalk = true;
+  b.run(500000);
+  CHECK(cm_error(b, RANGING_UP) <= 1 && cm_error(b, RANGING_DOWN) <= 1);
+}
+
+// A sensor out of turn is only pinged on request, and a request goes next
+static void test_request() {
+  Bench b;
+  b.r.automatic(RANGING_UP, false);
+  b.run(300000);
+  CHECK(b.pings[RANGING_UP] == 0 && b.pings[RANGING_DOWN] > 5);
+  b.r.request(RANGING_UP);
+  b.order.clear();
+  b.run(100000);
+  CHECK(b.pings[RANGING_UP] == 1 && !b.order.empty() && b.order[0] == RANGING_UP);
+
+  b.r.automatic(RANGING_DOWN, false);
+  int before = b.pings[RANGING_DOWN];
+  b.run(100000);
+  CHECK(b.pings[RANGING_DOWN] == before && b.pings[RANGING_UP] == 1);
+}
+
+// The same echo is a shorter distance in colder air
+static void test_temperature() {
+  Bench b;
+  b.run(100000);
+  uint16_t warm = b.r.cm(RANGING_DOWN);
+  b.r.temperature(-10);
+  b.run(100000);
+  int cold = warm * range_speed(-10) / range_speed(20);
+  CHECK(b.r.cm(RANGING_DOWN) < warm && abs(b.r.cm(RANGING_DOWN) - cold) <= 1);
+}
+
+// A slow, uneven main loop delays publishing but not the measurement
+static void bench_latency() {
+  const uint32_t loops[] = {200, 2000, 10000};
+  for (uint32_t l : loops) {
+    Bench b;
+    b.loop_us = l / 2;
+    b.loop_jitter_us = l;
+    b.run(5000000);
+    std::sort(b.latency.begin(), b.latency.end());
+    size_t n = b.latency.size();
+    printf("loop %5u us: %5.1f pings/s per sensor, publish latency p50 %5u us max %5u us\n", l,
+           b.pings[RANGING_UP] / 5.0, b.latency[n / 2], b.latency[n - 1]);
+    CHECK(cm_error(b, RANGING_UP) <= 1 && cm_error(b, RANGING_DOWN) <= 1);
+    CHECK(b.latency[n - 1] <= b.loop_us + b.loop_jitter_us);
+  }
+}
+
+int main() {
+  test_distances_and_turns();
+  test_no_echo();
+  test_crosstalk();
+  test_request();
+  test_temperature();
+  bench_latency();
+  return check_done("ranging_test");
+}
@@ -0,0 +1,161 @@
+// Host tests for arduino-control-04/scheduler.h on a virtual clock.
+//
+// Tasks take the time they are given off the clock instead of doing work,
+// and the loop around run() idles in small steps when nothing ran, like
+// loop() on the robot. The clock starts just short of the 32 bit micros()
+// wrap. Each run is logged against its release on the period grid, so the
+// tests can check the period, the start jitter, overruns and skipped
+// releases; the jitter of each task is printed as well.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o scheduler_test scheduler_test.cpp
+
+#include <algorithm>
+#include <vector>
+
+#include "check.h"
+#include "../arduino-control-04/scheduler.h"
+
+#define IDLE_US   8     // one pass of loop() with nothing due
+
+static uint32_t vclock;
+
+static uint32_t clock_us() {
+  return vclock;
+}
+
+// Cost of each run and the start of every run, per task
+static std::vector<uint32_t> cost[3];
+static std::vector<uint32_t> starts[3];
+static std::vector<uint8_t> order;
+
+template <int I>
+static void task() {
+  starts[I].push_back(vclock);
+  order.push_back(I);
+  size_t n = starts[I].size() - 1;
+  vclock += cost[I].empty() ? 0 : cost[I][n % cost[I].size()];
+}
+
+static void reset(uint32_t start = 0xFFFF0000u) {
+  vclock = start;
+  for (int i = 0; i < 3; i++) {
+    cost[i].clear();
+    starts[i].clear();
+  }
+  order.clear();
+}
+
+static void run_for(Scheduler &s, uint32_t us) {
+  uint32_t begin = vclock;
+  while (vclock - begin < us) {
+    if (!s.run()) {
+      vclock += IDLE_US;
+    }
+  }
+}
+
+// How late each run started after its release on the grid
+static std::vector<uint32_t> lateness(int i, uint32_t begin, uint32_t period) {
+  std::vector<uint32_t> late;
+  for (uint32_t t : starts[i]) {
+    late.push_back((t - begin) % period);
+  }
+  return late;
+}
+
+static void report(const char *name, int i, uint32_t begin, uint32_t period, const sched_task_t &t) {
+  std::vector<uint32_t> late = lateness(i, begin, period);
+  std::sort(late.begin(), late.end());
+  size_t n = late.size();
+  printf("%-6s %5zu runs  period %6u us  jitter p50 %4u p99 %4u max %4u us  max run %4u us  %u overruns  %u skipped\n",
+         name, n, period, late[n / 2], late[n * 99 / 100], late[n - 1], t.max_us, t.overruns, t.skipped);
+}
+
+// Three tasks at different rates, across the clock wrap: every task keeps
+// its rate, and the fast one is never held up by more than the longest
+// run of the others plus an idle pass
+static void test_rates_and_jitter() {
+  reset();
+  cost[0] = {20};
+  cost[1] = {100};
+  cost[2] = {300, 300, 300, 300, 300, 300, 300, 300, 300, 900};
+  sched_task_t tasks[] = {SCHED_TASK("ir", task<0>, 1000, 0), SCHED_TASK("us", task<1>, 50000, 0),
+                          SCHED_TASK("slow", task<2>, 16667, 0)};
+  Scheduler s(tasks, 3, clock_us);
+  s.begin();
+  uint32_t begin = vclock;
+  run_for(s, 1000000);
+
+  CHECK(starts[0].size() == 1000 && starts[1].size() == 20 && starts[2].size() == 60);
+  std::vector<uint32_t> late = lateness(0, begin, 1000);
+  CHECK(*std::max_element(late.begin(), late.end()) <= 900 + 100 + IDLE_US);
+  for (int i = 0; i < 3; i++) {
+    CHECK(tasks[i].overruns == 0 && tasks[i].skipped == 0);
+  }
+  CHECK(tasks[2].max_us == 900);
+  report("ir", 0, begin, 1000, tasks[0]);
+  report("us", 1, begin, 50000, tasks[1]);
+  report("slow", 2, begin, 16667, tasks[2]);
+}
+
+// A late run does not shift the grid: the next release is where it would
+// have been
+static void test_grid() {
+  reset(0);
+  cost[0] = {10, 10, 10, 700, 10};
+  sched_task_t tasks[] = {SCHED_TASK("a", task<0>, 1000, 0)};
+  Scheduler s(tasks, 1, clock_us);
+  s.begin();
+  run_for(s, 10000);
+  CHECK(starts[0].size() == 10);
+  bool on_grid = true;
+  for (size_t k = 0; k < starts[0].size(); k++) {
+    on_grid &= starts[0][k] >= k * 1000 && starts[0][k] < k * 1000 + IDLE_US;
+  }
+  CHECK(on_grid);
+}
+
+// A run past the deadline is an overrun; one past whole periods drops those
+// releases instead of running back to back to catch up
+static void test_overruns_and_skips() {
+  reset();
+  cost[0] = {100, 100, 600, 100, 2500, 100, 100, 100};
+  sched_task_t tasks[] = {SCHED_TASK("a", task<0>, 1000, 500)};
+  Scheduler s(tasks, 1, clock_us);
+  s.begin();
+  uint32_t begin = vclock;
+  run_for(s, 8000);
+  CHECK(tasks[0].overruns == 2);
+  CHECK(tasks[0].skipped == 2);
+  CHECK(starts[0].size() == 6);
+  bool spaced = true;
+  for (size_t k = 1; k < starts[0].size(); k++) {
+    spaced &= starts[0][k] - starts[0][k - 1] >= 500;
+  }
+  CHECK(spaced);
+  CHECK((starts[0][5] - begin) % 1000 < IDLE_US);   // back on the grid after the skip
+}
+
+// Tasks due together run in table order, each once per pass
+static void test_order() {
+  reset();
+  sched_task_t tasks[] = {SCHED_TASK("a", task<0>, 1000, 0), SCHED_TASK("b", task<1>, 1000, 0),
+                          SCHED_TASK("c", task<2>, 2000, 0)};
+  Scheduler s(tasks, 3, clock_us);
+  s.begin();
+  CHECK(s.run() == 3 && s.run() == 0);
+  vclock += 1000;
+  CHECK(s.run() == 2);
+  vclock += 1000;
+  CHECK(s.run() == 3);
+  CHECK(order == std::vector<uint8_t>({0, 1, 2, 0, 1, 0, 1, 2}));
+}
+
+int main() {
+  test_rates_and_jitter();
+  test_grid();
+  test_overruns_and_skips();
+  test_order();
+  return check_done("scheduler_test");
+}
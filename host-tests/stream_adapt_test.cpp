@@ -0,0 +1,204 @@
+// Host tests for esp32cam-robot-04/stream_adapt.h.
+//
+// The controller is fed frames one at a time to check each rule of the
+// control law: the budget, stepping down after ADAPT_DOWN_FRAMES over it
+// (quality, then framesize, then nothing), the settle frames after a step,
+// stepping up quality first after ADAPT_UP_FRAMES with room, a backed up
+// socket counting as over budget, and the wait before a step up doubling
+// when one is undone and halving when one holds. Then a link whose rate
+// changes in phases is simulated, socket buffer included, and the frame
+// rate, latency and steps per phase are printed.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o stream_adapt_test stream_adapt_test.cpp
+
+#include <stdlib.h>
+
+#include "check.h"
+#include "../esp32cam-robot-04/stream_adapt.h"
+
+#define FS_MIN    5       // QVGA
+#define FS_MAX    8       // VGA
+#define Q_BEST    10
+#define BUDGET    100000  // 10 fps is shorter than the 150 ms latency limit
+
+// Feeds the same frame until the setting changes; frames fed, or -1
+static int until_step(StreamAdapt &a, uint32_t send_us, uint32_t wait_us = 0, int limit = 1000) {
+  for (int n = 1; n <= limit; n++) {
+    if (a.frame(10000, send_us, wait_us)) {
+      return n;
+    }
+  }
+  return -1;
+}
+
+static StreamAdapt make(int framesize, int quality) {
+  StreamAdapt a;
+  a.limits(FS_MIN, FS_MAX, Q_BEST, ADAPT_QUALITY_WORST);
+  a.reset(framesize, quality);
+  return a;
+}
+
+static bool is(const StreamAdapt &a, int framesize, int quality) {
+  return a.setting().framesize == framesize && a.setting().quality == quality;
+}
+
+static void test_budget_and_limits() {
+  StreamAdapt a;
+  CHECK(a.budget_us() == BUDGET);
+  a.budget(5, 150);
+  CHECK(a.budget_us() == 150000);
+  a.budget(0, 1000);
+  CHECK(a.budget_us() == 1000000);
+
+  StreamAdapt b = make(12, 2);
+  CHECK(is(b, FS_MAX, Q_BEST));
+  b = make(0, 99);
+  CHECK(is(b, FS_MIN, ADAPT_QUALITY_WORST));
+}
+
+// Over budget: quality goes down a step at a time, then the framesize, and
+// at the bottom of both nothing changes
+static void test_step_down() {
+  StreamAdapt a = make(FS_MAX, Q_BEST);
+  CHECK(until_step(a, 2 * BUDGET) == ADAPT_DOWN_FRAMES);
+  CHECK(is(a, FS_MAX, Q_BEST + ADAPT_QUALITY_STEP));
+  // The frames still in flight at the old setting do not count
+  CHECK(until_step(a, 2 * BUDGET) == ADAPT_SETTLE_FRAMES + ADAPT_DOWN_FRAMES);
+
+  int steps = 2;
+  while (a.setting().quality < ADAPT_QUALITY_WORST) {
+    CHECK(until_step(a, 2 * BUDGET) > 0);
+    steps++;
+  }
+  CHECK(is(a, FS_MAX, ADAPT_QUALITY_WORST));
+  CHECK(until_step(a, 2 * BUDGET) > 0 && is(a, FS_MAX - 1, ADAPT_QUALITY_WORST));
+  while (a.setting().framesize > FS_MIN) {
+    CHECK(until_step(a, 2 * BUDGET) > 0);
+  }
+  CHECK(until_step(a, 2 * BUDGET, 0, 200) == -1 && is(a, FS_MIN, ADAPT_QUALITY_WORST));
+  CHECK(a.steps() == (uint32_t)(steps + FS_MAX - FS_MIN));
+}
+
+// One slow frame is averaged away; a socket still full from the last frame
+// is over budget however fast the sends look
+static void test_over_budget() {
+  StreamAdapt a = make(FS_MAX, Q_BEST);
+  for (int i = 0; i < 50; i++) {
+    CHECK(!a.frame(10000, i % 10 == 9 ? 2 * BUDGET : 20000, 0));
+  }
+  CHECK(until_step(a, 1000, BUDGET + 1) == ADAPT_DOWN_FRAMES);
+  CHECK(is(a, FS_MAX, Q_BEST + ADAPT_QUALITY_STEP));
+}
+
+// Room to spare: quality comes back first, then the framesize a step below
+// the best quality, and never past what the operator set
+static void test_step_up() {
+  StreamAdapt a = make(FS_MAX - 1, Q_BEST + 2 * ADAPT_QUALITY_STEP);
+  CHECK(until_step(a, 20000) == ADAPT_UP_FRAMES);
+  CHECK(is(a, FS_MAX - 1, Q_BEST + ADAPT_QUALITY_STEP));
+  CHECK(until_step(a, 20000) > 0 && is(a, FS_MAX - 1, Q_BEST));
+  CHECK(until_step(a, 20000) > 0 && is(a, FS_MAX, Q_BEST + ADAPT_QUALITY_STEP));
+  CHECK(until_step(a, 20000) > 0 && is(a, FS_MAX, Q_BEST));
+  CHECK(until_step(a, 20000, 0, 500) == -1);
+
+  // Close to the budget there is no room for the next step's bytes
+  StreamAdapt b = make(FS_MAX, Q_BEST + ADAPT_QUALITY_STEP);
+  CHECK(until_step(b, BUDGET * 3 / 5, 0, 500) == -1);
+  CHECK(until_step(b, BUDGET * 2 / 5) > 0);   // x1.5 bytes fits in 3/4 of the budget
+}
+
+// A step up that is undone makes the next one wait twice as long; one that
+// holds for twice its wait halves it again
+static void test_hysteresis() {
+  StreamAdapt a = make(FS_MAX, Q_BEST + ADAPT_QUALITY_STEP);
+  CHECK(until_step(a, 20000) == ADAPT_UP_FRAMES);
+  CHECK(until_step(a, 2 * BUDGET) == ADAPT_SETTLE_FRAMES + ADAPT_DOWN_FRAMES);
+  CHECK(until_step(a, 20000) == ADAPT_SETTLE_FRAMES + 2 * ADAPT_UP_FRAMES);
+  CHECK(until_step(a, 2 * BUDGET) == ADAPT_SETTLE_FRAMES + ADAPT_DOWN_FRAMES);
+  CHECK(until_step(a, 20000) == ADAPT_SETTLE_FRAMES + 4 * ADAPT_UP_FRAMES);
+
+  // Holds: after twice its wait at the best setting the wait is back down
+  for (int i = 0; i < 2 * 4 * ADAPT_UP_FRAMES; i++) {
+    a.frame(10000, 20000, 0);
+  }
+  CHECK(until_step(a, 2 * BUDGET) > 0);
+  CHECK(until_step(a, 20000) == ADAPT_SETTLE_FRAMES + 2 * ADAPT_UP_FRAMES);
+
+  // The wait stops growing at ADAPT_UP_FRAMES_MAX
+  for (int i = 0; i < 6; i++) {
+    until_step(a, 2 * BUDGET);
+    until_step(a, 20000);
+  }
+  CHECK(until_step(a, 2 * BUDGET) > 0);
+  CHECK(until_step(a, 20000) == ADAPT_SETTLE_FRAMES + ADAPT_UP_FRAMES_MAX);
+}
+
+static uint32_t lcg = 12345;
+
+static double random01() {
+  lcg = lcg * 1103515245u + 12345u;
+  return (lcg >> 8) / 16777216.0;
+}
+
+// Pixels of framesizes 0 to 9 of the OV2640 driver
+static const int PIXELS[] = {96 * 96, 160 * 120, 176 * 144, 240 * 176, 240 * 240,
+                             320 * 240, 400 * 296, 480 * 320, 640 * 480, 800 * 600};
+
+// The link in phases. send() returns once the rest of the frame fits in the
+// socket buffer, the next part header waits for the buffer to drain.
+static void test_link() {
+  struct {
+    const char *name;
+    double kbps;
+    double secs;
+  } phases[] = {{"6 Mbit", 6000, 20}, {"1.5 Mbit", 1500, 30}, {"400 kbit", 400, 30},
+                {"900 kbit", 900, 40}, {"5 Mbit", 5000, 40}};
+  const double sndbuf = 5744;
+  StreamAdapt a = make(FS_MAX, Q_BEST);
+  double t = 0;
+  double drained = 0;
+  for (auto &p : phases) {
+    double end = t + p.secs * 1e6;
+    int frames = 0;
+    double worst = 0;
+    double total = 0;
+    uint32_t steps = a.steps();
+    while (t < end) {
+      adapt_setting_t s = a.setting();
+      double bytes = PIXELS[s.framesize] * 1.3 / s.quality * (0.9 + 0.2 * random01());
+      double rate = p.kbps * (0.8 + 0.4 * random01()) / 8000;     // bytes per us
+      double start = t;
+      double wait = drained > t ? drained - t : 0;
+      t += wait;
+      t += bytes > sndbuf ? (bytes - sndbuf) / rate : 0;
+      drained = t + (bytes < sndbuf ? bytes : sndbuf) / rate;
+      double latency = drained - start;
+      total += latency;
+      worst = latency > worst ? latency : worst;
+      frames++;
+      a.frame((uint32_t)bytes, (uint32_t)(t - start), (uint32_t)wait);
+      t = start + 40000 > t + 2000 ? start + 40000 : t + 2000;    // 25 fps camera
+    }
+    adapt_setting_t s = a.setting();
+    printf("%-9s %5.1f fps  latency avg %4.0f ms worst %5.0f ms  %2u steps  now framesize %d quality %d\n",
+           p.name, frames / p.secs, total / frames / 1000, worst / 1000, a.steps() - steps, s.framesize, s.quality);
+    if (p.kbps >= 5000) {
+      CHECK(s.framesize == FS_MAX);
+    }
+    if (p.kbps <= 400) {
+      CHECK(total / frames < 2 * BUDGET && s.framesize < FS_MAX);
+    }
+    CHECK(a.steps() - steps <= 12);   // no flicker on a boundary
+  }
+}
+
+int main() {
+  test_budget_and_limits();
+  test_step_down();
+  test_over_budget();
+  test_step_up();
+  test_hysteresis();
+  test_link();
+  return check_done("stream_adapt_test");
+}
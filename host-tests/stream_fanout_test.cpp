@@ -0,0 +1,164 @@
+// Host tests for esp32cam-robot-04/stream_fanout.h over frame_ring.h.
+//
+// 1, 2, 4 and 8 /stream viewers are simulated on a 1 ms virtual clock: the
+// capture task publishes a 12 KB frame every 40 ms into the ring the
+// firmware uses, and each viewer takes its next frame the way
+// stream_client_task() does, holding it pinned for as long as its link
+// needs to send it. Every viewer on a fast link has to get the camera's
+// frame rate however many there are, with the ring never full. Then one of
+// them is put on a slow link: it drops to what its link carries and the
+// others have to keep the full rate. For comparison the frame rate each
+// viewer got before the ring, with every viewer grabbing its own frames
+// from the driver, is printed too.
+//
+// The firmware takes STREAM_MAX_CLIENTS (4) viewers; 8 checks the ring
+// still holds with twice as many.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o stream_fanout_test stream_fanout_test.cpp
+
+#include <string.h>
+#include <vector>
+
+#include "check.h"
+#include "../esp32cam-robot-04/frame_ring.h"
+#include "../esp32cam-robot-04/stream_fanout.h"
+
+#define STREAM_MAX_CLIENTS  4
+#define FRAME_RING_SLOTS    (STREAM_MAX_CLIENTS + 4)   // as app_httpd.cpp
+#define FRAME_MS            40                         // 25 fps
+#define FRAME_BYTES         12000
+#define RUN_MS              10000
+#define SETTLE_MS           1000                       // not counted
+#define FAST_BPMS           1000    // bytes per ms, 8 Mbit/s
+#define SLOW_BPMS           100     // 0.8 Mbit/s
+
+typedef struct {
+  uint32_t id;
+  size_t len;
+} frame_t;
+
+typedef FrameRing<frame_t, FRAME_RING_SLOTS> ring_t;
+
+static int frames_out = 0;      // published and not given back yet
+
+static void frame_return(const frame_t &) {
+  frames_out--;
+}
+
+typedef struct {
+  StreamCursor<ring_t> *cursor;
+  ring_t::Slot *sending;
+  uint32_t bpms;
+  uint32_t done_at;       // ms the frame being sent is out
+  uint32_t counted;       // frames sent after SETTLE_MS
+} viewer_t;
+
+typedef struct {
+  double fps[8];
+  uint32_t ring_full;
+  uint32_t skipped;
+} result_t;
+
+static size_t part_bytes(size_t len) {
+  char hdr[STREAM_PART_LEN];
+  return stream_part_header(hdr, len) + len + strlen(STREAM_BOUNDARY);
+}
+
+static result_t run(int viewers, int slow) {
+  ring_t ring;
+  std::vector<StreamCursor<ring_t> > cursors(viewers, StreamCursor<ring_t>(&ring));
+  std::vector<viewer_t> v(viewers);
+  for (int i = 0; i < viewers; i++) {
+    v[i] = {&cursors[i], NULL, i < slow ? (uint32_t)SLOW_BPMS : (uint32_t)FAST_BPMS, 0, 0};
+  }
+  result_t r;
+  memset(&r, 0, sizeof(r));
+  uint32_t id = 0;
+  frames_out = 0;
+
+  for (uint32_t ms = 0; ms < RUN_MS; ms++) {
+    if (ms % FRAME_MS == 0) {
+      ring.collect(frame_return);
+      frame_t f = {id++, FRAME_BYTES};
+      frames_out++;
+      if (!ring.publish(f)) {
+        r.ring_full++;
+        frame_return(f);
+      }
+    }
+    // Viewers in a different order every ms, as their tasks would run
+    for (int k = 0; k < viewers; k++) {
+      viewer_t &x = v[(k + ms) % viewers];
+      if (x.sending && ms >= x.done_at) {
+        x.cursor->done(x.sending, true, frame_return);
+        x.sending = NULL;
+        x.counted += ms >= SETTLE_MS;
+      }
+      if (!x.sending && (x.sending = x.cursor->next()) != NULL) {
+        x.done_at = ms + (part_bytes(x.sending->item.len) + x.bpms - 1) / x.bpms;
+      }
+    }
+  }
+  for (int i = 0; i < viewers; i++) {
+    r.fps[i] = v[i].counted * 1000.0 / (RUN_MS - SETTLE_MS);
+    r.skipped += v[i].cursor->skipped();
+    if (v[i].sending) {
+      v[i].cursor->done(v[i].sending, false, frame_return);
+    }
+  }
+  ring.collect(frame_return);
+  // Only the newest frame is still held by the ring
+  CHECK(frames_out == 1);
+  return r;
+}
+
+// Before the ring: each viewer called esp_camera_fb_get() itself, so the
+// camera's frames were shared out between them
+static double fps_before(int viewers) {
+  return 1000.0 / FRAME_MS / viewers;
+}
+
+static void report(const char *what, int viewers, const result_t &r) {
+  printf("%d viewers, %s: fps", viewers, what);
+  for (int i = 0; i < viewers; i++) {
+    printf(" %5.1f", r.fps[i]);
+  }
+  printf("  (each %.1f before)  skipped %u, ring full %u\n", fps_before(viewers), r.skipped, r.ring_full);
+}
+
+static void test_fast() {
+  const int counts[] = {1, 2, 4, 8};
+  for (int n : counts) {
+    result_t r = run(n, 0);
+    report("fast links", n, r);
+    bool full_rate = true;
+    for (int i = 0; i < n; i++) {
+      full_rate &= r.fps[i] > 1000.0 / FRAME_MS - 0.5;
+    }
+    CHECK(full_rate && r.ring_full == 0 && r.skipped == 0);
+  }
+}
+
+static void test_one_slow() {
+  const int counts[] = {2, 4, 8};
+  for (int n : counts) {
+    result_t r = run(n, 1);
+    report("one slow", n, r);
+    // The slow viewer gets the newest frame each time it is done, so what
+    // its link carries rounded down to whole frame periods
+    double link_fps = 1000.0 * SLOW_BPMS / part_bytes(FRAME_BYTES);
+    CHECK(r.fps[0] > link_fps * 0.6 && r.fps[0] <= link_fps);
+    bool full_rate = true;
+    for (int i = 1; i < n; i++) {
+      full_rate &= r.fps[i] > 1000.0 / FRAME_MS - 0.5;
+    }
+    CHECK(full_rate && r.ring_full == 0 && r.skipped > 0);
+  }
+}
+
+int main() {
+  test_fast();
+  test_one_slow();
+  return check_done("stream_fanout_test");
+}
@@ -0,0 +1,235 @@
+// Host tests for arduino-control-04/telemetry.h.
+//
+// Checks the CRC against the standard CRC-8 check value and that every
+// single bit error in a frame is caught, that the decoder finds the next
+// frame after garbage, and that a full ring drops (and counts) the new
+// frame without touching the queued ones, across the ring's wrap point.
+//
+// Then the link is simulated the way telemetry.ino drives it: telem_pump()
+// every 5 ms tops the Serial buffer up to TELEM_BACKLOG bytes, and the UART
+// sends them at 9600 baud. With the sketch's own traffic a sweep has to
+// arrive within one 50 ms state period of being queued; with a flood of
+// text the low priority frames are dropped, the receiver's sequence gaps
+// have to match what the robot counted, and a sweep may only be held up
+// by the one text frame already going out.
+//
+// Build (C++11, nothing else):
+//   g++ -O2 -o telemetry_test telemetry_test.cpp
+
+#include <algorithm>
+#include <vector>
+
+#include "check.h"
+#include "../arduino-control-04/telemetry.h"
+
+#define SCAN_POINTS     13      // sweep.h: 60 to 120 degrees in 5 degree steps
+#define BYTE_US         1042    // 10 bits at 9600 baud
+#define PUMP_US         5000    // the "telemetry" scheduler task
+
+static std::vector<uint8_t> drain(TelemetryTx &tx) {
+  std::vector<uint8_t> out;
+  for (int b; (b = tx.next()) >= 0;) {
+    out.push_back(b);
+  }
+  return out;
+}
+
+static void test_crc() {
+  uint8_t crc = 0;
+  for (const char *p = "123456789"; *p; p++) {
+    crc = telem_crc8(crc, *p);
+  }
+  CHECK(crc == 0xF4);     // CRC-8 (poly 0x07, init 0) check value
+
+  TelemetryTx tx;
+  const uint8_t p[] = {10, 20, 30, 40, 50};
+  tx.send(TELEM_HIGH, TELEM_STATE, p, sizeof(p));
+  std::vector<uint8_t> frame = drain(tx);
+  CHECK(frame.size() == sizeof(p) + TELEM_OVERHEAD);
+  int caught = 0;
+  int bits = 0;
+  for (size_t i = 1; i < frame.size(); i++) {     // the sync byte is not covered
+    for (int bit = 0; bit < 8; bit++) {
+      std::vector<uint8_t> bad = frame;
+      bad[i] ^= 1 << bit;
+      TelemetryRx rx;
+      bool ok = false;
+      for (uint8_t b : bad) {
+        ok |= rx.feed(b);
+      }
+      caught += !ok;
+      bits++;
+    }
+  }
+  CHECK(caught == bits);
+}
+
+// Garbage, a corrupted frame and a truncated one, then a good frame
+static void test_resync() {
+  TelemetryTx tx;
+  TelemetryRx rx;
+  const uint8_t p[] = {1, 2, 3};
+  std::vector<uint8_t> stream = {0x00, TELEM_SYNC, 0xff, 'x', TELEM_SYNC, 0x04, 0x00, 40};
+  tx.send(TELEM_LOW, TELEM_TEXT, p, 3);
+  std::vector<uint8_t> bad = drain(tx);
+  bad[5] ^= 0x10;
+  tx.send(TELEM_LOW, TELEM_TEXT, p, 3);
+  std::vector<uint8_t> good = drain(tx);
+  stream.insert(stream.end(), bad.begin(), bad.end());
+  stream.insert(stream.end(), good.begin(), good.end());
+  int frames = 0;
+  for (uint8_t b : stream) {
+    frames += rx.feed(b);
+  }
+  CHECK(frames == 1 && rx.crc_errors() == 1);
+  CHECK(rx.frame().seq == 1 && rx.frame().len == 3 && !memcmp(rx.frame().payload, p, 3));
+}
+
+// A full ring refuses the frame whole, counts it, and burns its sequence
+// number so the receiver sees the gap
+static void test_ring_overflow() {
+  TelemetryTx tx;
+  TelemetryRx rx;
+  uint8_t scan[6 + SCAN_POINTS] = {0};
+  int sent = 0;
+  for (int round = 0; round < 50; round++) {
+    // Offsets the ring by a frame and a bit each round so the wrap moves
+    const uint8_t pad[] = {'p', 'a', 'd'};
+    tx.send(TELEM_MID, TELEM_TEXT, pad, round % 4);
+    scan[0] = round;
+    for (int i = 0; i < 3; i++) {
+      scan[1] = i;
+      sent += tx.send(TELEM_MID, TELEM_SCAN, scan, sizeof(scan));
+    }
+    for (int b; (b = tx.next()) >= 0;) {
+      if (rx.feed(b) && rx.frame().type == TELEM_SCAN) {
+        CHECK(rx.frame().payload[0] == round && rx.frame().payload[1] == 0);
+      }
+    }
+  }
+  // A pad frame and one sweep fit in the 48 byte ring, a second sweep not
+  CHECK(sent == 50 && tx.dropped(TELEM_MID) == 100);
+  // The receiver sees the last gap with the next frame
+  tx.send(TELEM_MID, TELEM_TEXT, scan, 0);
+  for (uint8_t b : drain(tx)) {
+    rx.feed(b);
+  }
+  CHECK(rx.lost() == tx.dropped(TELEM_MID));
+  CHECK(rx.crc_errors() == 0 && tx.idle());
+
+  // Payloads over the limit are dropped too
+  uint8_t big[TELEM_MAX_PAYLOAD + 1] = {0};
+  CHECK(!tx.send(TELEM_LOW, TELEM_TEXT, big, sizeof(big)) && tx.dropped(TELEM_LOW) == 1);
+}
+
+typedef struct {
+  uint32_t frames[TELEM_PRIOS];
+  std::vector<uint32_t> scan_us;    // queued to last byte received
+  uint32_t lost;
+  uint32_t dropped;
+  uint32_t bytes;
+} link_t;
+
+// Runs the link for ms milliseconds; text_every_ms 0 for no text flood
+static link_t run_link(uint32_t ms, uint32_t text_every_ms) {
+  TelemetryTx tx;
+  TelemetryRx rx;
+  link_t out = link_t();
+  std::vector<uint8_t> serial;
+  std::vector<uint32_t> scan_queued;
+  uint32_t next_byte = 0;
+  uint16_t scan_seq = 0;
+
+  for (uint32_t us = 0; us < ms * 1000; us += 1000) {
+    uint32_t now = us / 1000;
+    // Quiet for the last second, then one frame of each priority so the
+    // receiver sees every gap
+    if (now == ms - 500) {
+      for (uint8_t p = 0; p < TELEM_PRIOS; p++) {
+        tx.send(p, TELEM_TEXT, NULL, 0);
+      }
+    }
+    bool traffic = now < ms - 1000;
+    if (traffic && now % 50 == 0) {
+      uint8_t p[5] = {(uint8_t)now, (uint8_t)(now >> 8), 60, 1, TELEM_FORWARD};
+      tx.send(TELEM_HIGH, TELEM_STATE, p, sizeof(p));
+    }
+    if (traffic && now % 430 == 17) {     // a sweep takes about this long
+      uint8_t p[6 + SCAN_POINTS] = {(uint8_t)scan_seq, (uint8_t)(scan_seq >> 8), 1, 60, 5, SCAN_POINTS};
+      scan_seq++;
+      if (tx.send(TELEM_MID, TELEM_SCAN, p, sizeof(p))) {
+        scan_queued.push_back(us);
+      }
+    }
+    if (traffic && now % 5000 == 1234) {  // sched_report(), one frame per task that overran
+      for (uint8_t task = 0; task < 3; task++) {
+        uint8_t p[7] = {task, 1, 0, 0, 0, 0xe8, 0x03};
+        tx.send(TELEM_LOW, TELEM_SCHED, p, sizeof(p));
+      }
+    }
+    if (traffic && text_every_ms && now % text_every_ms == 3) {
+      tx.send(TELEM_LOW, TELEM_TEXT, (const uint8_t *)"obstacle, turning", 17);
+    }
+    if (us % PUMP_US == 0) {
+      for (int b; serial.size() < TELEM_BACKLOG && (b = tx.next()) >= 0;) {
+        serial.push_back(b);
+      }
+    }
+    // UART: a byte starts every BYTE_US while the buffer has any, and is
+    // received when its stop bit is done
+    if (next_byte < us) {
+      next_byte = us;
+    }
+    while (!serial.empty() && next_byte < us + 1000) {
+      next_byte += BYTE_US;
+      uint8_t b = serial.front();
+      serial.erase(serial.begin());
+      out.bytes++;
+      if (rx.feed(b)) {
+        out.frames[rx.frame().prio]++;
+        if (rx.frame().type == TELEM_SCAN) {
+          out.scan_us.push_back(next_byte - scan_queued[out.scan_us.size()]);
+        }
+      }
+    }
+  }
+  out.lost = rx.lost();
+  for (int p = 0; p < TELEM_PRIOS; p++) {
+    out.dropped += tx.dropped(p);
+  }
+  return out;
+}
+
+static void report(const char *name, link_t &l, uint32_t ms) {
+  std::sort(l.scan_us.begin(), l.scan_us.end());
+  size_t n = l.scan_us.size();
+  printf("%-8s %4.0f B/s  frames H %u M %u L %u  dropped %u  sweep latency p50 %5.1f ms max %5.1f ms\n",
+         name, l.bytes * 1000.0 / ms, l.frames[TELEM_HIGH], l.frames[TELEM_MID], l.frames[TELEM_LOW],
+         l.dropped, l.scan_us[n / 2] / 1000.0, l.scan_us[n - 1] / 1000.0);
+}
+
+static void test_link() {
+  // One sweep plus a state frame is on the wire within a state period
+  CHECK((6 + SCAN_POINTS + 5 + TELEM_OVERHEAD * 2) * BYTE_US <= 50000);
+
+  const uint32_t ms = 60000;
+  link_t normal = run_link(ms, 0);
+  report("normal", normal, ms);
+  CHECK(normal.dropped == 0 && normal.lost == 0);
+  CHECK(normal.frames[TELEM_HIGH] == (ms - 1000) / 50 + 1 && normal.frames[TELEM_MID] == normal.scan_us.size() + 1);
+  CHECK(normal.scan_us.back() <= 50000);
+
+  link_t flood = run_link(ms, 10);
+  report("flood", flood, ms);
+  CHECK(flood.dropped > 0 && flood.lost == flood.dropped);
+  CHECK(flood.frames[TELEM_HIGH] == normal.frames[TELEM_HIGH] && flood.scan_us.size() == normal.scan_us.size());
+  CHECK(flood.scan_us.back() <= 50000 + (17 + TELEM_OVERHEAD) * BYTE_US);
+}
+
+int main() {
+  test_crc();
+  test_resync();
+  test_ring_overflow();
+  test_link();
+  return check_done("telemetry_test");
+}
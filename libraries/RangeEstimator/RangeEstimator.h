@@ -0,0 +1,193 @@
+// Distance from HC-SR04 echo times, shared by the sketches.
+//
+// Each echo goes through three steps:
+//   1. Conversion at the speed of sound for the air temperature, so every
+//      sketch uses the same constant. No echo, or one past RANGE_MAX_MM,
+//      reads as RANGE_MAX_MM: nothing in range.
+//   2. A running median of the last RANGE_MEDIAN readings, which removes
+//      single bad echoes before they reach the filter.
+//   3. A constant velocity Kalman filter giving distance and closing speed.
+//      A median that is still more than RANGE_GATE standard deviations off
+//      the prediction is rejected; after RANGE_REJECT_MAX rejections in a
+//      row the filter believes the sensor and starts again from it.
+//
+// Integer arithmetic only (64 bit for a few products), no floats, so it is
+// cheap on the AVR. Plain C++ with time passed in, so recorded echoes can be
+// replayed on a PC.
+
+#ifndef RANGE_ESTIMATOR_H
+#define RANGE_ESTIMATOR_H
+
+#include <stdint.h>
+
+#define RANGE_MAX_MM        4000    // HC-SR04 limit, also what no echo reads as
+#define RANGE_TIMEOUT_US    40000UL // pulseIn timeout; no echo is a 38 ms pulse
+#define RANGE_TEMP_C        20      // until temperature() is called
+#define RANGE_MEDIAN        5       // odd
+#define RANGE_NOISE_MM      10      // sensor standard deviation
+#define RANGE_ACCEL_MM_S2   2000    // how hard the distance can change speed
+#define RANGE_SPEED_MM_S    1000    // initial closing speed uncertainty
+#define RANGE_GATE          3       // standard deviations
+#define RANGE_REJECT_MAX    3
+#define RANGE_DT_MAX_MS     500     // longer gaps count as this
+
+// Echo time to mm, one way, for mm_per_us from range_speed()
+static inline uint16_t range_echo_mm(uint32_t echo_us, uint16_t mm_per_us) {
+  if (!echo_us || echo_us >= RANGE_TIMEOUT_US) {
+    return RANGE_MAX_MM;
+  }
+  uint32_t mm = (echo_us * mm_per_us) >> 16;
+  return mm > RANGE_MAX_MM ? RANGE_MAX_MM : mm;
+}
+
+// Millimetres per microsecond of echo (there and back) at celsius, Q16.
+// Sound travels at 331.3 + 0.606 T m/s.
+static inline uint16_t range_speed(int8_t celsius) {
+  uint32_t mm_per_s = 331300L + 606L * celsius;
+  return (mm_per_s * 4096 + 62500) / 125000;    // * 65536 / 2000000
+}
+
+class RangeEstimator {
+  public:
+    RangeEstimator() : mm_per_us_(range_speed(RANGE_TEMP_C)) {
+      reset();
+    }
+
+    void reset() {
+      count_ = 0;
+      next_ = 0;
+      rejects_ = 0;
+      valid_ = false;
+      rejected_ = 0;
+      last_mm_ = 0;
+      t_ = 0;
+      d_ = 0;
+      v_ = 0;
+      p00_ = 0;
+      p01_ = 0;
+      p11_ = 0;
+    }
+
+    void temperature(int8_t celsius) {
+      mm_per_us_ = range_speed(celsius);
+    }
+
+    // One echo, 0 for none, taken at now_us
+    void update(uint32_t echo_us, uint32_t now_us) {
+      uint16_t z = range_echo_mm(echo_us, mm_per_us_);
+      last_mm_ = z;
+      window_[next_] = z;
+      next_ = next_ + 1 == RANGE_MEDIAN ? 0 : next_ + 1;
+      if (count_ < RANGE_MEDIAN) {
+        count_++;
+      }
+      filter(median(), now_us);
+    }
+
+    // Filtered distance
+    uint16_t mm() const {
+      int32_t d = (d_ + 8) >> 4;
+      return d < 0 ? 0 : d > RANGE_MAX_MM ? RANGE_MAX_MM : d;
+    }
+
+    uint16_t cm() const {
+      return (mm() + 5) / 10;
+    }
+
+    // Positive while the distance is shrinking
+    int16_t closing_mm_s() const {
+      return -((v_ + 8) >> 4);
+    }
+
+    // Last reading after conversion, before any filtering
+    uint16_t raw_mm() const {
+      return last_mm_;
+    }
+
+    // False until the first echo
+    bool valid() const {
+      return valid_;
+    }
+
+    uint16_t rejected() const {
+      return rejected_;
+    }
+
+  private:
+    uint16_t median() const {
+      uint16_t v[RANGE_MEDIAN];
+      for (uint8_t i = 0; i < count_; i++) {
+        uint16_t x = window_[i];
+        uint8_t j = i;
+        for (; j > 0 && v[j - 1] > x; j--) {
+          v[j] = v[j - 1];
+        }
+        v[j] = x;
+      }
+      return v[count_ / 2];
+    }
+
+    void start(uint16_t z, uint32_t now) {
+      d_ = (int32_t)z << 4;
+      v_ = 0;
+      p00_ = (int32_t)RANGE_NOISE_MM * RANGE_NOISE_MM;
+      p01_ = 0;
+      p11_ = (int32_t)RANGE_SPEED_MM_S * RANGE_SPEED_MM_S;
+      t_ = now;
+      rejects_ = 0;
+      valid_ = true;
+    }
+
+    // d_ and v_ are in 1/16 mm and 1/16 mm/s, the covariance in mm and s
+    void filter(uint16_t z, uint32_t now) {
+      if (!valid_) {
+        start(z, now);
+        return;
+      }
+
+      // Predict
+      uint32_t dt = (now - t_) / 1000;
+      if (dt > RANGE_DT_MAX_MS) {
+        dt = RANGE_DT_MAX_MS;
+      }
+      t_ = now;
+      const int64_t a2 = (int64_t)RANGE_ACCEL_MM_S2 * RANGE_ACCEL_MM_S2;
+      int64_t dt2 = (int64_t)dt * dt;
+      d_ += v_ * (int32_t)dt / 1000;
+      p00_ += (int32_t)((2 * (int64_t)dt * p01_ * 1000 + dt2 * p11_ + a2 * dt2 * dt2 / 4000000) / 1000000);
+      p01_ += (int32_t)((dt * (int64_t)p11_ * 1000 + a2 * dt2 * dt / 2000) / 1000000);
+      p11_ += (int32_t)(a2 * dt2 / 1000000);
+
+      // Gate, then update
+      int32_t y = ((int32_t)z << 4) - d_;
+      int64_t s = (int64_t)p00_ + RANGE_NOISE_MM * RANGE_NOISE_MM;
+      if ((int64_t)y * y > (int64_t)RANGE_GATE * RANGE_GATE * s * 256) {
+        rejected_++;
+        if (++rejects_ >= RANGE_REJECT_MAX) {
+          start(z, now);
+        }
+        return;
+      }
+      rejects_ = 0;
+      d_ += (int32_t)(p00_ * (int64_t)y / s);
+      v_ += (int32_t)(p01_ * (int64_t)y / s);
+      int32_t p00 = p00_, p01 = p01_;
+      p00_ -= (int32_t)((int64_t)p00 * p00 / s);
+      p01_ -= (int32_t)((int64_t)p00 * p01 / s);
+      p11_ -= (int32_t)((int64_t)p01 * p01 / s);
+    }
+
+    uint16_t mm_per_us_;    // range_speed()
+    uint16_t window_[RANGE_MEDIAN];
+    uint8_t  count_;
+    uint8_t  next_;
+    uint16_t last_mm_;
+    bool     valid_;
+    uint8_t  rejects_;      // in a row
+    uint16_t rejected_;
+    uint32_t t_;
+    int32_t  d_, v_;
+    int32_t  p00_, p01_, p11_;
+};
+
+#endif
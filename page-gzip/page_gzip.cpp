@@ -0,0 +1,134 @@
+// Build step for the ESP32 control page.
+//
+// Reads a sketch file holding pages as
+//   static const char PROGMEM NAME[] = R"rawliteral(...)rawliteral";
+// and writes a header with each one gzipped for the server to send as it
+// is, with Content-Encoding: gzip:
+//   NAME_GZ[]      the gzip stream, in PROGMEM
+//   NAME_GZ_LEN    its length
+//   NAME_ETAG      a strong ETag, FNV-1a 64 of the page, quoted
+// The gzip header carries no file name or time, so the same page always
+// gives the same bytes and the same ETag, and the header only changes in
+// git when the page does. Run it again after every edit of the page.
+//
+// Build (C++11 and zlib):
+//   g++ -O2 -o page_gzip page_gzip.cpp -lz
+//
+// Usage:
+//   page_gzip ../esp32cam-robot-04/html_control.ino ../esp32cam-robot-04/html_control_gz.h
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#define LITERAL_OPEN   "R\"rawliteral("
+#define LITERAL_CLOSE  ")rawliteral\""
+
+static bool read_file(const char *path, std::string *out) {
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    return false;
+  }
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    out->append(buf, n);
+  }
+  fclose(f);
+  return true;
+}
+
+static uint64_t fnv1a64(const std::string &s) {
+  uint64_t h = 14695981039346656037ull;
+  for (unsigned char c : s) {
+    h = (h ^ c) * 1099511628211ull;
+  }
+  return h;
+}
+
+// gzip at the best level, no name and mtime 0 in the header
+static bool gzip(const std::string &in, std::vector<uint8_t> *out) {
+  z_stream z;
+  memset(&z, 0, sizeof(z));
+  if (deflateInit2(&z, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+    return false;
+  }
+  out->resize(deflateBound(&z, in.size()) + 32);
+  z.next_in = (Bytef *)in.data();
+  z.avail_in = in.size();
+  z.next_out = out->data();
+  z.avail_out = out->size();
+  int r = deflate(&z, Z_FINISH);
+  out->resize(z.total_out);
+  deflateEnd(&z);
+  return r == Z_STREAM_END;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: page_gzip <sketch file> <header to write>\n");
+    return 2;
+  }
+  std::string src;
+  if (!read_file(argv[1], &src)) {
+    perror(argv[1]);
+    return 1;
+  }
+  FILE *out = fopen(argv[2], "w");
+  if (!out) {
+    perror(argv[2]);
+    return 1;
+  }
+  const char *base = strrchr(argv[1], '/') ? strrchr(argv[1], '/') + 1 : argv[1];
+  std::string guard = strrchr(argv[2], '/') ? strrchr(argv[2], '/') + 1 : argv[2];
+  for (char &c : guard) {
+    c = isalnum((unsigned char)c) ? toupper((unsigned char)c) : '_';
+  }
+  fprintf(out, "/*\n  ESP32CAM Robot Car\n  generated from %s by page-gzip/page_gzip.cpp, do not edit\n"
+          "  Gzipped pages with their ETags, sent by app_httpd.cpp.\n*/\n\n"
+          "#ifndef %s\n#define %s\n\n#include <stdint.h>\n", base, guard.c_str(), guard.c_str());
+
+  int pages = 0;
+  for (size_t at = src.find(LITERAL_OPEN); at != std::string::npos; at = src.find(LITERAL_OPEN, at)) {
+    // The name is the identifier before "[]"
+    size_t bracket = src.rfind("[]", at);
+    size_t begin = at + strlen(LITERAL_OPEN);
+    size_t end = src.find(LITERAL_CLOSE, begin);
+    if (bracket == std::string::npos || end == std::string::npos) {
+      fprintf(stderr, "%s: raw literal without a name or an end\n", argv[1]);
+      return 1;
+    }
+    size_t name_start = src.find_last_of(" \t\n", bracket) + 1;
+    std::string name = src.substr(name_start, bracket - name_start);
+    std::string page = src.substr(begin, end - begin);
+    at = end;
+
+    std::vector<uint8_t> gz;
+    if (!gzip(page, &gz)) {
+      fprintf(stderr, "%s: gzip failed\n", name.c_str());
+      return 1;
+    }
+    fprintf(out, "\n// %s: %zu bytes, %zu gzipped\n", name.c_str(), page.size(), gz.size());
+    fprintf(out, "#define %s_GZ_LEN %zu\n", name.c_str(), gz.size());
+    fprintf(out, "#define %s_ETAG \"\\\"%016llx\\\"\"\n", name.c_str(), (unsigned long long)fnv1a64(page));
+    fprintf(out, "static const uint8_t PROGMEM %s_GZ[] = {", name.c_str());
+    for (size_t i = 0; i < gz.size(); i++) {
+      fprintf(out, "%s0x%02x,", i % 16 ? " " : "\n  ", gz[i]);
+    }
+    fprintf(out, "\n};\n");
+    printf("%s: %zu -> %zu bytes\n", name.c_str(), page.size(), gz.size());
+    pages++;
+  }
+  fprintf(out, "\n#endif\n");
+  fclose(out);
+  if (!pages) {
+    fprintf(stderr, "%s: no raw literal pages found\n", argv[1]);
+    return 1;
+  }
+  return 0;
+}
@@ -1,12 +1,12 @@
 #include <Servo.h>
+#include "radar_sweep.h"
 Servo My_servo;
 int trig=6;
 int vcc=7;
 int gnd=4;
 int echo=5;
-float min_val=0;
-float ultra_distance[90]={0};
-int angle[91]={0};
+RadarSweep radar(0);   // quét thô 10 độ rồi quét mịn quanh điểm gần nhất (radar_sweep.h)
+uint16_t reported=0;
 
 void setup() {
   My_servo.attach(9,600,2300);
@@ -22,59 +22,20 @@ void setup() {
  Serial.begin(9600);
 }
 
+// Không chặn: mỗi lần gọi chạy một bước của radar, quét lại khi vật
+// dịch chuyển từ 2 cm
 void loop()
-{My_servo.write(0);
-delay(600);
- int j=0;
- int index=-2;// check index value
-  
-     for (int i=0; i<=100;i+=1)
-          {
-          My_servo.write(i);
-         delay(50);
-         angle[j]=i;
-         ultra_distance[j]=measure_distance_cm();
-         delay(20);
-         Serial.print(" the iteration = ");
-         Serial.print(i);
-          Serial.print("  ultra_distance =   ");
-         Serial.println(ultra_distance[j]);
-         j+=1;   
-         if (i==90){break;} 
-         }
-       for (j=0;j<=90;j+=1)
-       {min_val=max(min_val,ultra_distance[j]);
-      
-        }
-         
-   for (j=0;j<=90;j+=1)
-       {if (min_val>ultra_distance[j])
-       {
-        min_val=ultra_distance[j];
-        index=j;}
-       
-        }
-        
-       Serial.print("the min value =");
-              Serial.println(min_val);
+{
+  if (radar.tick(millis(), measure_distance_cm))
+  {My_servo.write(radar.angle());
+  }
+  if (radar.locks()!=reported)
+  {reported=radar.locks();
+   Serial.print("the min value =");
+              Serial.println(radar.min_cm());
   Serial.print("the index value =");
-              Serial.println(index);
-       
-
-        My_servo.write(angle[index]);
-        delay(1000);  
-     while(true)
-        {
-          float new_val=0;
-        
-        new_val= measure_distance_cm();
-        Serial.print(" new value  = ");
-        Serial.print(new_val);
-          if (abs(ultra_distance[index]-new_val)>=2.0)
-             {break;
-              }}
-          
-        
+              Serial.println(radar.min_deg());
+  }
 }
 
 float measure_distance_cm()
@@ -84,7 +45,7 @@ float measure_distance_cm()
   digitalWrite(trig,HIGH);
   delayMicroseconds(10);
   digitalWrite(trig,LOW);
-  time_value=pulseIn(echo,HIGH);
+  time_value=pulseIn(echo,HIGH,40000UL);  // không có vật: xung 38 ms, trả về 0
   distance=0.033*time_value/2;
   return distance;
     }
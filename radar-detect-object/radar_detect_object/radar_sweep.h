@@ -0,0 +1,171 @@
+// Servo sweep that finds the nearest object and keeps watching it.
+//
+// A coarse pass pings every RADAR_COARSE_DEG from RADAR_MIN_DEG to
+// RADAR_MAX_DEG, then a fine pass pings every RADAR_FINE_DEG within half a
+// coarse step either side of the nearest reading. The minimum is kept as the
+// readings come in, so there is no pass over the table afterwards. The
+// servo then stays on the nearest angle and pings it every RADAR_TRACK_MS;
+// once the distance moves by RADAR_TRACK_CM a new sweep starts.
+//
+// tick() never waits: the servo is given time to settle in proportion to
+// the size of the move and the caller is told when to write it. Plain C++
+// with time passed in, so the sweep can be run on a PC against a fake
+// sensor.
+
+#ifndef RADAR_SWEEP_H
+#define RADAR_SWEEP_H
+
+#include <stdint.h>
+
+#define RADAR_MIN_DEG         0
+#define RADAR_MAX_DEG         90
+#define RADAR_POINTS          (RADAR_MAX_DEG - RADAR_MIN_DEG + 1)
+#define RADAR_COARSE_DEG      10    // narrower than the HC-SR04 beam, so a ball is not missed
+#define RADAR_FINE_DEG        1
+#define RADAR_SETTLE_MS       20    // after any move
+#define RADAR_SETTLE_MS_PER_DEG 2   // SG90 turns about 60 degrees in 0.1 s
+#define RADAR_TRACK_MS        60    // between pings while tracking
+#define RADAR_TRACK_CM        2.0   // change that starts a new sweep
+#define RADAR_NOT_SEEN        0     // no echo, or not pinged in this sweep
+
+typedef float (*radar_measure_t)();   // blocking ping, cm, 0 for no echo
+
+class RadarSweep {
+  public:
+    // start_deg is where the servo is now
+    RadarSweep(uint8_t start_deg) : state_(COARSE), angle_(start_deg), pending_(false), moved_(0), settle_(0),
+      last_ping_(0), min_deg_(0), min_cm_(RADAR_NOT_SEEN), fine_end_(0), fine_skip_(0), locks_(0) {
+      start();
+    }
+
+    // One step. Returns true when the servo has to be written with angle().
+    bool tick(uint32_t now, radar_measure_t measure) {
+      if (pending_) {
+        pending_ = false;
+        moved_ = now;
+        return true;
+      }
+      if (now - moved_ < settle_) {
+        return false;
+      }
+
+      if (state_ == TRACK) {
+        if (now - last_ping_ < RADAR_TRACK_MS) {
+          return false;
+        }
+        last_ping_ = now;
+        float cm = measure();
+        float change = cm - min_cm_;
+        if (change >= RADAR_TRACK_CM || change <= -RADAR_TRACK_CM) {
+          start();
+        }
+        return false;
+      }
+
+      float cm = measure();
+      cm_[index(angle_)] = cm;
+      if (cm > RADAR_NOT_SEEN && (min_cm_ == RADAR_NOT_SEEN || cm < min_cm_)) {
+        min_cm_ = cm;
+        min_deg_ = angle_;
+      }
+
+      if (state_ == COARSE) {
+        if (angle_ + RADAR_COARSE_DEG <= RADAR_MAX_DEG) {
+          move(angle_ + RADAR_COARSE_DEG);
+        } else if (min_cm_ == RADAR_NOT_SEEN) {
+          start();                          // nothing in range, look again
+        } else {
+          // Fine pass around the candidate, which is already measured
+          int lo = min_deg_ - RADAR_COARSE_DEG / 2;
+          int hi = min_deg_ + RADAR_COARSE_DEG / 2;
+          fine_end_ = hi > RADAR_MAX_DEG ? RADAR_MAX_DEG : hi;
+          fine_skip_ = min_deg_;
+          state_ = FINE;
+          fine_step((lo < RADAR_MIN_DEG ? RADAR_MIN_DEG : lo) - RADAR_FINE_DEG);
+        }
+      } else {
+        fine_step(angle_);
+      }
+      return false;
+    }
+
+    uint8_t angle() const {
+      return angle_;
+    }
+
+    // True while the servo is held on the nearest angle
+    bool tracking() const {
+      return state_ == TRACK;
+    }
+
+    uint8_t min_deg() const {
+      return min_deg_;
+    }
+
+    float min_cm() const {
+      return min_cm_;
+    }
+
+    // Reading at deg from the current sweep, RADAR_NOT_SEEN if not pinged
+    float cm(uint8_t deg) const {
+      return cm_[index(deg)];
+    }
+
+    // Goes up by one with every sweep that ends in tracking
+    uint16_t locks() const {
+      return locks_;
+    }
+
+  private:
+    enum { COARSE, FINE, TRACK };
+
+    static uint8_t index(uint8_t deg) {
+      return deg - RADAR_MIN_DEG;
+    }
+
+    void start() {
+      for (uint8_t i = 0; i < RADAR_POINTS; i++) {
+        cm_[i] = RADAR_NOT_SEEN;
+      }
+      min_cm_ = RADAR_NOT_SEEN;
+      state_ = COARSE;
+      move(RADAR_MIN_DEG);
+    }
+
+    // Moves on to the fine angle after from, or to tracking past the end
+    void fine_step(int from) {
+      int next = from + RADAR_FINE_DEG;
+      if (next == fine_skip_) {
+        next += RADAR_FINE_DEG;
+      }
+      if (next <= fine_end_) {
+        move(next);
+        return;
+      }
+      state_ = TRACK;
+      locks_++;
+      move(min_deg_);
+    }
+
+    void move(uint8_t deg) {
+      uint8_t from = angle_;
+      angle_ = deg;
+      settle_ = RADAR_SETTLE_MS + RADAR_SETTLE_MS_PER_DEG * (from > deg ? from - deg : deg - from);
+      pending_ = true;
+    }
+
+    uint8_t  state_;
+    uint8_t  angle_;
+    bool     pending_;      // servo write owed to the caller
+    uint32_t moved_;
+    uint32_t settle_;
+    uint32_t last_ping_;
+    uint8_t  min_deg_;
+    float    min_cm_;
+    uint8_t  fine_end_;
+    uint8_t  fine_skip_;    // the coarse reading the fine pass started from
+    uint16_t locks_;
+    float    cm_[RADAR_POINTS];   // index deg - RADAR_MIN_DEG
+};
+
+#endif
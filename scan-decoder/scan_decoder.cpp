@@ -0,0 +1,678 @@
+// Host side decoder for the robot's serial output.
+//
+// Reads a live serial port or a recorded log and understands both what the
+// older sketches print for Processing ("deg,dis." lines, arduino-control-02
+// and 03) and the binary telemetry frames of arduino-control-04
+// (telemetry.h), even mixed in one stream. Every distance goes into a
+// rolling polar occupancy map and every complete sweep can be exported as a
+// CSV row for offline analysis.
+//
+// The stream is decoded a byte at a time straight out of a fixed read
+// buffer, so nothing is allocated per line or per frame.
+//
+// Build (C++11 and POSIX, nothing else):
+//   g++ -O2 -o scan_decoder scan_decoder.cpp
+//
+// Usage:
+//   scan_decoder [-s scans.csv] [-m map.pgm] [-l] <log file | serial port>
+//   scan_decoder --bench [hours]
+//
+//   -s       write every complete sweep: seq,dir,first_deg,step_deg,n,cm...
+//            (cm 0 for no echo)
+//   -m       write the occupancy map when the input ends, one row per
+//            degree, one column per MAP_CELL_CM of range, free space white
+//   -l       redraw the map in the terminal after every sweep
+//   --bench  decode a synthetic log of a whole match (1 hour by default) in
+//            each format, written at the full 9600 baud, and report the
+//            throughput
+//
+// A serial port is set to 9600 8N1 raw, like Serial.begin(9600).
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <vector>
+
+#include "../arduino-control-04/telemetry.h"
+
+#define MAP_DEGREES   181
+#define MAP_CELL_CM   2
+#define MAP_CELLS     200   // 4 m, past what the HC-SR04 reports reliably
+#define MAP_HIT       3
+#define MAP_MISS      1
+#define MAP_LIMIT     12    // evidence saturates, so a few sweeps overwrite old readings
+
+#define READ_BYTES    65536
+#define EXPORT_BYTES  65536
+
+#define VIEW_RADIUS   30    // terminal rows for the full map range
+
+// Polar occupancy grid. Each reading adds evidence for an obstacle at its
+// range and against one anywhere closer along the same bearing. Evidence is
+// clamped at +-MAP_LIMIT, which is what makes the map rolling: a cell that
+// changes is overwritten within a few sweeps without any decay pass.
+class PolarMap {
+  public:
+    PolarMap() {
+      memset(cell_, 0, sizeof(cell_));
+    }
+
+    // cm 0 (no echo) carries no information
+    void add(int deg, int cm) {
+      if (deg < 0 || deg >= MAP_DEGREES || cm <= 0) {
+        return;
+      }
+      int8_t *row = cell_[deg];
+      int hit = cm / MAP_CELL_CM;
+      int free_end = hit < MAP_CELLS ? hit : MAP_CELLS;
+      for (int i = 0; i < free_end; i++) {
+        row[i] = row[i] > -MAP_LIMIT + MAP_MISS ? row[i] - MAP_MISS : -MAP_LIMIT;
+      }
+      if (hit < MAP_CELLS) {
+        row[hit] = row[hit] < MAP_LIMIT - MAP_HIT ? row[hit] + MAP_HIT : MAP_LIMIT;
+      }
+    }
+
+    int at(int deg, int cell) const {
+      return cell_[deg][cell];
+    }
+
+    // Binary PGM, white free, black occupied, grey unknown
+    bool write_pgm(const char *path) const {
+      FILE *f = fopen(path, "wb");
+      if (!f) {
+        return false;
+      }
+      fprintf(f, "P5\n%d %d\n255\n", MAP_CELLS, MAP_DEGREES);
+      uint8_t line[MAP_CELLS];
+      for (int d = 0; d < MAP_DEGREES; d++) {
+        for (int c = 0; c < MAP_CELLS; c++) {
+          line[c] = 128 - cell_[d][c] * 127 / MAP_LIMIT;
+        }
+        fwrite(line, 1, sizeof(line), f);
+      }
+      return fclose(f) == 0;
+    }
+
+  private:
+    int8_t cell_[MAP_DEGREES][MAP_CELLS];
+};
+
+// Half disc view of the map for a terminal, robot at the bottom centre and
+// 90 degrees straight up. The cell behind every character is worked out
+// once.
+class MapView {
+  public:
+    MapView() {
+      for (int y = 0; y <= VIEW_RADIUS; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+          double dx = (x - VIEW_RADIUS) / 2.0;    // characters are about twice as tall as wide
+          double dy = VIEW_RADIUS - y;
+          double r = sqrt(dx * dx + dy * dy);
+          Spot &s = spot_[y][x];
+          s.deg = -1;
+          if (r <= VIEW_RADIUS && r > 0) {
+            s.deg = (int16_t)lround(atan2(dy, dx) * 180 / M_PI);
+            s.cell = (int16_t)(r * (MAP_CELLS - 1) / VIEW_RADIUS);
+          }
+        }
+      }
+    }
+
+    void draw(FILE *out, const PolarMap &map) const {
+      char line[WIDTH + 1];
+      fputs("\033[H\033[2J", out);
+      for (int y = 0; y <= VIEW_RADIUS; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+          const Spot &s = spot_[y][x];
+          if (y == VIEW_RADIUS && x == VIEW_RADIUS) {
+            line[x] = '^';
+          } else if (s.deg < 0 || s.deg >= MAP_DEGREES) {
+            line[x] = ' ';
+          } else {
+            int v = map.at(s.deg, s.cell);
+            line[x] = v > 2 ? '#' : v < -2 ? '.' : ' ';
+          }
+        }
+        line[WIDTH] = 0;
+        fprintf(out, "%s\n", line);
+      }
+    }
+
+  private:
+    enum { WIDTH = 4 * VIEW_RADIUS + 1 };
+
+    struct Spot {
+      int16_t deg;
+      int16_t cell;
+    };
+
+    Spot spot_[VIEW_RADIUS + 1][WIDTH];
+};
+
+// Buffered CSV writer for complete sweeps
+class ScanExport {
+  public:
+    ScanExport() : file_(NULL), used_(0) {}
+
+    ~ScanExport() {
+      close();
+    }
+
+    bool open(const char *path) {
+      file_ = fopen(path, "wb");
+      if (!file_) {
+        return false;
+      }
+      text("seq,dir,first_deg,step_deg,n,cm...\n");
+      return true;
+    }
+
+    bool close() {
+      if (!file_) {
+        return true;
+      }
+      flush();
+      bool ok = fclose(file_) == 0;
+      file_ = NULL;
+      return ok;
+    }
+
+    void scan(uint32_t seq, int dir, int first, int step, int n, const uint16_t *cm) {
+      if (!file_) {
+        return;
+      }
+      if (used_ > EXPORT_BYTES - 32 - 6 * MAP_DEGREES) {
+        flush();
+      }
+      number(seq);
+      buf_[used_++] = ',';
+      if (dir < 0) {
+        buf_[used_++] = '-';
+        dir = -dir;
+      }
+      number(dir);
+      buf_[used_++] = ',';
+      number(first);
+      buf_[used_++] = ',';
+      number(step);
+      buf_[used_++] = ',';
+      number(n);
+      for (int i = 0; i < n; i++) {
+        buf_[used_++] = ',';
+        number(cm[i]);
+      }
+      buf_[used_++] = '\n';
+    }
+
+  private:
+    void text(const char *s) {
+      while (*s) {
+        buf_[used_++] = *s++;
+      }
+    }
+
+    void number(uint32_t v) {
+      char tmp[10];
+      int n = 0;
+      do {
+        tmp[n++] = '0' + v % 10;
+        v /= 10;
+      } while (v);
+      while (n) {
+        buf_[used_++] = tmp[--n];
+      }
+    }
+
+    void flush() {
+      fwrite(buf_, 1, used_, file_);
+      used_ = 0;
+    }
+
+    FILE  *file_;
+    size_t used_;
+    char   buf_[EXPORT_BYTES];
+};
+
+typedef struct {
+  uint32_t bytes;
+  uint32_t points;      // "deg,dis." lines
+  uint32_t scans;       // complete sweeps, either format
+  uint32_t frames;      // good telemetry frames
+} decode_stats_t;
+
+class Decoder {
+  public:
+    Decoder(ScanExport &out) : out_(out), view_(NULL), ascii_(A_DEG), deg_(0), dis_(0), digits_(0),
+      dir_(0), last_(-1), lo_(MAP_DEGREES), hi_(-1), step_(0), by_turn_(0), seq_(0), up_cm_(0), ir_(0),
+      action_(TELEM_STOP) {
+      memset(&stats_, 0, sizeof(stats_));
+      memset(by_deg_, 0, sizeof(by_deg_));
+      text_[0] = 0;
+    }
+
+    // Redraw the map on out after every sweep
+    void live(const MapView *view) {
+      view_ = view;
+    }
+
+    void feed(const uint8_t *p, size_t n) {
+      stats_.bytes += n;
+      for (const uint8_t *end = p + n; p < end; p++) {
+        uint8_t b = *p;
+        if (rx_.feed(b)) {
+          frame(rx_.frame());
+          ascii_ = A_SKIP;
+        } else if (rx_.in_frame()) {
+          ascii_ = A_SKIP;
+        } else {
+          ascii(b);
+        }
+      }
+    }
+
+    // Sends the sweep being collected from text lines, if any
+    void finish() {
+      if (hi_ >= lo_) {
+        ascii_scan();
+      }
+    }
+
+    const PolarMap &map() const {
+      return map_;
+    }
+
+    const decode_stats_t &stats() const {
+      return stats_;
+    }
+
+    const TelemetryRx &rx() const {
+      return rx_;
+    }
+
+  private:
+    enum { A_DEG, A_DIS, A_SKIP };
+
+    // "deg,dis." then CR LF; anything else skips to the end of the line
+    void ascii(uint8_t c) {
+      if (c == '\n') {
+        ascii_ = A_DEG;
+        deg_ = 0;
+        digits_ = 0;
+        return;
+      }
+      if (ascii_ == A_SKIP) {
+        return;
+      }
+      if (c >= '0' && c <= '9') {
+        uint16_t &v = ascii_ == A_DEG ? deg_ : dis_;
+        if (++digits_ > 4) {
+          ascii_ = A_SKIP;
+          return;
+        }
+        v = v * 10 + (c - '0');
+      } else if (c == ',' && ascii_ == A_DEG && digits_) {
+        ascii_ = A_DIS;
+        dis_ = 0;
+        digits_ = 0;
+      } else if (c == '.' && ascii_ == A_DIS && digits_) {
+        ascii_ = A_SKIP;
+        point(deg_, dis_);
+      } else if (c != '\r' || ascii_ != A_DEG || digits_) {
+        ascii_ = A_SKIP;
+      }
+    }
+
+    // A sweep ends where the servo turns round; the turning point also
+    // starts the next one, as in sweep.h
+    void point(int deg, int cm) {
+      if (deg >= MAP_DEGREES) {
+        return;
+      }
+      stats_.points++;
+      map_.add(deg, cm);
+
+      int d = last_ < 0 || deg == last_ ? 0 : deg > last_ ? 1 : -1;
+      if (d && dir_ && d != dir_) {
+        int turn = last_;
+        ascii_scan();
+        add(turn, by_turn_);
+      }
+      if (d) {
+        if (!step_ || abs(deg - last_) < step_) {
+          step_ = abs(deg - last_);
+        }
+        dir_ = d;
+      }
+      by_turn_ = cm;
+      last_ = deg;
+      add(deg, cm);
+    }
+
+    void add(int deg, int cm) {
+      by_deg_[deg] = cm;
+      if (deg < lo_) {
+        lo_ = deg;
+      }
+      if (deg > hi_) {
+        hi_ = deg;
+      }
+    }
+
+    void ascii_scan() {
+      int step = step_ ? step_ : 1;
+      int n = (hi_ - lo_) / step + 1;
+      for (int i = 0; i < n; i++) {
+        cm_[i] = by_deg_[lo_ + i * step];
+      }
+      scan(seq_++, dir_, lo_, step, n);
+      memset(by_deg_ + lo_, 0, (hi_ - lo_ + 1) * sizeof(by_deg_[0]));
+      lo_ = MAP_DEGREES;
+      hi_ = -1;
+    }
+
+    void frame(const TelemetryRx::Frame &f) {
+      stats_.frames++;
+      const uint8_t *p = f.payload;
+      switch (f.type) {
+        case TELEM_SCAN: {
+          if (f.len < 6 || f.len - 6 < p[5]) {
+            return;
+          }
+          int first = p[3];
+          int step = p[4];
+          int n = p[5];
+          for (int i = 0; i < n; i++) {
+            cm_[i] = p[6 + i] * TELEM_CM_UNIT;
+            map_.add(first + i * step, cm_[i]);
+          }
+          scan(p[0] | p[1] << 8, (int8_t)p[2], first, step, n);
+          break;
+        }
+        case TELEM_STATE:
+          if (f.len >= 5) {
+            up_cm_ = p[2] * TELEM_CM_UNIT;
+            ir_ = p[3];
+            action_ = p[4];
+          }
+          break;
+        case TELEM_TEXT:
+          memcpy(text_, p, f.len);
+          text_[f.len] = 0;
+          break;
+      }
+    }
+
+    void scan(uint32_t seq, int dir, int first, int step, int n) {
+      stats_.scans++;
+      out_.scan(seq, dir, first, step, n, cm_);
+      if (view_) {
+        static const char *const actions[] = {"forward", "left", "right", "stop"};
+        view_->draw(stdout, map_);
+        printf("sweep %u  up %u cm  ir %c%c%c  %s  %s\n", seq, up_cm_,
+          ir_ & 1 ? 'L' : '-', ir_ & 2 ? 'R' : '-', ir_ & 4 ? 'B' : '-',
+          action_ < 4 ? actions[action_] : "?", text_);
+        fflush(stdout);
+      }
+    }
+
+    ScanExport    &out_;
+    const MapView *view_;
+    PolarMap      map_;
+    TelemetryRx   rx_;
+    decode_stats_t stats_;
+
+    // Text lines
+    uint8_t  ascii_;
+    uint16_t deg_;
+    uint16_t dis_;
+    uint8_t  digits_;
+    int      dir_;
+    int      last_;
+    int      lo_, hi_;      // degrees seen in the sweep being collected
+    int      step_;
+    int      by_turn_;
+    uint32_t seq_;
+    uint16_t by_deg_[MAP_DEGREES];
+
+    uint16_t cm_[MAP_DEGREES];    // sweep being handed out
+
+    // Last state and text frames, for the live view
+    uint16_t up_cm_;
+    uint8_t  ir_;
+    uint8_t  action_;
+    char     text_[TELEM_MAX_PAYLOAD + 1];
+};
+
+static int open_input(const char *path) {
+  int fd = open(path, O_RDONLY | O_NOCTTY);
+  if (fd < 0 || !isatty(fd)) {
+    return fd;
+  }
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, B9600);
+    cfsetospeed(&tio, B9600);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  return fd;
+}
+
+static void print_stats(const char *what, const Decoder &dec) {
+  const decode_stats_t &s = dec.stats();
+  fprintf(stderr, "%s: %u bytes, %u points, %u sweeps, %u frames (%u crc errors, %u lost)\n",
+    what, s.bytes, s.points, s.scans, s.frames, dec.rx().crc_errors(), dec.rx().lost());
+}
+
+// Simulated room: walls of a 3 by 4 m box with the robot 1 m from the back
+// wall, and a ball that drifts across in front of it
+static int room_cm(int deg, double t) {
+  double a = deg * M_PI / 180;
+  double c = cos(a), s = sin(a);
+  double r = 300 / (s > 1e-3 ? s : 1e-3);
+  if (c > 1e-3 && 150 / c < r) {
+    r = 150 / c;
+  }
+  if (c < -1e-3 && -150 / c < r) {
+    r = -150 / c;
+  }
+  int ball = 90 + (int)(60 * sin(t / 7));
+  if (abs(deg - ball) <= 3 && r > 80) {
+    r = 80;
+  }
+  return r > 400 ? 0 : (int)r;
+}
+
+static uint32_t noise(uint32_t &state) {
+  state = state * 1664525 + 1013904223;
+  return state >> 24;
+}
+
+// "deg,dis." lines as arduino-control-03 prints them, 0 to 180 and back
+static void bench_ascii(std::vector<uint8_t> &log, size_t bytes) {
+  uint32_t rnd = 1;
+  int deg = 0, dir = 1;
+  double t = 0;
+  char line[16];
+  while (log.size() < bytes) {
+    int cm = room_cm(deg, t);
+    if (cm) {
+      cm += noise(rnd) % 5 - 2;
+    }
+    int n = snprintf(line, sizeof(line), "%d,%d.\r\n", deg, cm);
+    log.insert(log.end(), line, line + n);
+    t += n / 960.0;
+    if ((deg == 180 && dir > 0) || (deg == 0 && dir < 0)) {
+      dir = -dir;
+    } else {
+      deg += dir;
+    }
+  }
+}
+
+static void drain(TelemetryTx &tx, std::vector<uint8_t> &log) {
+  for (int b; (b = tx.next()) >= 0;) {
+    log.push_back(b);
+  }
+}
+
+// Telemetry frames as arduino-control-04 sends them: a state frame every
+// 50 ms and a sweep when one completes, written back to back
+static void bench_frames(std::vector<uint8_t> &log, size_t bytes) {
+  TelemetryTx tx;
+  uint32_t rnd = 1;
+  uint16_t seq = 0;
+  double t = 0;
+  while (log.size() < bytes) {
+    uint8_t p[6 + MAP_DEGREES];
+    for (int k = 0; k < 9; k++) {
+      uint16_t ms = (uint16_t)(t * 1000);
+      uint8_t state[5] = {(uint8_t)ms, (uint8_t)(ms >> 8), telem_cm(room_cm(90, t)), (uint8_t)(noise(rnd) & 7),
+        (uint8_t)(noise(rnd) & 3)};
+      tx.send(TELEM_HIGH, TELEM_STATE, state, sizeof(state));
+      drain(tx, log);
+      t += 0.05;
+    }
+    int n = 13;
+    p[0] = seq;
+    p[1] = seq >> 8;
+    p[2] = seq & 1 ? -1 : 1;
+    p[3] = 60;
+    p[4] = 5;
+    p[5] = n;
+    for (int i = 0; i < n; i++) {
+      p[6 + i] = telem_cm(room_cm(60 + 5 * i, t));
+    }
+    tx.send(TELEM_MID, TELEM_SCAN, p, 6 + n);
+    drain(tx, log);
+    seq++;
+  }
+}
+
+static int bench(double hours) {
+  size_t bytes = (size_t)(hours * 3600 * 960);    // 9600 baud, 8N1
+  const char *names[] = {"text lines", "frames"};
+  for (int kind = 0; kind < 2; kind++) {
+    std::vector<uint8_t> log;
+    log.reserve(bytes + 64);
+    if (kind == 0) {
+      bench_ascii(log, bytes);
+    } else {
+      bench_frames(log, bytes);
+    }
+
+    double best = 1e9;
+    for (int run = 0; run < 3; run++) {
+      ScanExport out;
+      if (!out.open("/dev/null")) {
+        perror("/dev/null");
+        return 1;
+      }
+      Decoder dec(out);
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < log.size(); i += READ_BYTES) {
+        dec.feed(&log[i], log.size() - i < READ_BYTES ? log.size() - i : READ_BYTES);
+      }
+      dec.finish();
+      out.close();
+      double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      if (s < best) {
+        best = s;
+      }
+      if (run == 0) {
+        print_stats(names[kind], dec);
+      }
+    }
+    fprintf(stderr, "  %g h log, %.2f MB in %.1f ms, %.0f MB/s\n", hours, log.size() / 1e6, best * 1e3,
+      log.size() / 1e6 / best);
+  }
+  return 0;
+}
+
+static int usage() {
+  fprintf(stderr, "usage: scan_decoder [-s scans.csv] [-m map.pgm] [-l] <log | serial port>\n"
+    "       scan_decoder --bench [hours]\n");
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  const char *scans = NULL;
+  const char *map = NULL;
+  const char *input = NULL;
+  bool live = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--bench")) {
+      return bench(i + 1 < argc ? atof(argv[i + 1]) : 1);
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      scans = argv[++i];
+    } else if (!strcmp(argv[i], "-m") && i + 1 < argc) {
+      map = argv[++i];
+    } else if (!strcmp(argv[i], "-l")) {
+      live = true;
+    } else if (argv[i][0] != '-' && !input) {
+      input = argv[i];
+    } else {
+      return usage();
+    }
+  }
+  if (!input) {
+    return usage();
+  }
+
+  int fd = open_input(input);
+  if (fd < 0) {
+    perror(input);
+    return 1;
+  }
+  ScanExport out;
+  if (scans && !out.open(scans)) {
+    perror(scans);
+    return 1;
+  }
+  static MapView view;
+  Decoder dec(out);
+  if (live) {
+    dec.live(&view);
+  }
+
+  static uint8_t buf[READ_BYTES];
+  for (;;) {
+    ssize_t n = read(fd, buf, sizeof(buf));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      if (n < 0) {
+        perror(input);
+      }
+      break;
+    }
+    dec.feed(buf, n);
+  }
+  close(fd);
+  dec.finish();
+
+  print_stats(input, dec);
+  if (!out.close()) {
+    perror(scans);
+    return 1;
+  }
+  if (map && !dec.map().write_pgm(map)) {
+    perror(map);
+    return 1;
+  }
+  return 0;
+}